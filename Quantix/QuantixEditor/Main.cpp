@@ -2,16 +2,191 @@
 //
 
 #include <iostream>
+#include <string>
 
 #include <Editor.h>
+#include <PhysicBenchmark.h>
 #include <Core/Profiler/Profiler.h>
+#include <Core/Platform/HeadlessContext.h>
+#include <Core/Physic/PhysicHandler.h>
+#include <Core/Physic/PhysicReplay.h>
+
+// Width and height of the heat map of a replay by default
+#define REPLAY_HEAT_MAP_SIZE 512
+
+/**
+ * @brief Read the physics arguments shared by the editor and the benchmark, before the application starts:
+ * [--pvd host] connects the PhysX Visual Debugger, it is not connected otherwise
+ *
+ * @param argc number of arguments
+ * @param argv arguments
+ */
+void ReadPhysicArguments(int argc, char** argv)
+{
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (std::string(argv[i]) == "--pvd")
+			Quantix::Core::Physic::PhysicHandler::GetInstance()->SetPvdHost(argv[++i]);
+	}
+}
+
+/**
+ * @brief Read a physics capture without starting the engine and write its summary, the arguments are
+ * --replay capture [--output file] [--heat-map file] [--heat-map-size N]. The summary lists the steps with the longest
+ * solver and the bodies and places moving during the spikes, the heat map draws where the bodies moved weighted by the
+ * solver times
+ *
+ * @param argc number of arguments
+ * @param argv arguments
+ * @return int 0 if the summary was written
+ */
+int RunReplay(int argc, char** argv)
+{
+	std::string		capture;
+	std::string		output = "physics_summary.json";
+	std::string		heat_map;
+	unsigned int	heat_map_size = REPLAY_HEAT_MAP_SIZE;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		bool has_value = i + 1 < argc;
+
+		if (arg == "--replay" && has_value)
+			capture = argv[++i];
+		else if (arg == "--output" && has_value)
+			output = argv[++i];
+		else if (arg == "--heat-map" && has_value)
+			heat_map = argv[++i];
+		else if (arg == "--heat-map-size" && has_value)
+			heat_map_size = std::stoul(argv[++i]);
+	}
+
+	Quantix::Core::Physic::PhysicReplay	replay;
+	if (!replay.Load(capture) || !replay.WriteSummary(output))
+		return 1;
+
+	if (!heat_map.empty() && !replay.WriteHeatMap(heat_map, heat_map_size))
+		return 1;
+
+	return 0;
+}
+
+/**
+ * @brief Draw a scene without the editor and write the timings of the passes and of the physics, the arguments are
+ * --benchmark scene [--frames N] [--warmup N] [--size width height] [--path file] [--output file]
+ * [--capture directory] [--capture-interval N] [--bodies N] [--blocking-physics] [--rays N] [--block N]
+ * [--deformable-block] [--crowd N] [--serial-crowd] [--record capture]. --record writes the physics steps of the
+ * measured frames in a capture read by --replay. Two runs with and without --blocking-physics compare the frame
+ * time of the asynchronous simulation on the same bodies, two runs with and without --deformable-block compare the
+ * fracture of a block of N * N * N cubes with the object per cube of the DeformableMesh, two runs of --crowd 500 with
+ * and without --serial-crowd compare the moves of 500 character controllers on the workers and on one thread
+ *
+ * @param argc number of arguments
+ * @param argv arguments
+ * @return int 0 if the report was written
+ */
+int RunBenchmark(int argc, char** argv)
+{
+	Quantix::Core::Platform::BenchmarkConfig	config;
+	PhysicBenchmarkConfig						physic;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		bool has_value = i + 1 < argc;
+
+		if (arg == "--benchmark" && has_value)
+			config.scene = argv[++i];
+		else if (arg == "--frames" && has_value)
+			config.frames = std::stoul(argv[++i]);
+		else if (arg == "--warmup" && has_value)
+			config.warmup = std::stoul(argv[++i]);
+		else if (arg == "--size" && i + 2 < argc)
+		{
+			config.width = std::stoul(argv[++i]);
+			config.height = std::stoul(argv[++i]);
+		}
+		else if (arg == "--path" && has_value)
+		{
+			if (!Quantix::Core::Platform::RenderBenchmark::LoadPath(argv[++i], config.path))
+				return 1;
+		}
+		else if (arg == "--output" && has_value)
+			config.output = argv[++i];
+		else if (arg == "--capture" && has_value)
+			config.captureDir = argv[++i];
+		else if (arg == "--capture-interval" && has_value)
+			config.captureInterval = std::stoul(argv[++i]);
+		else if (arg == "--bodies" && has_value)
+			physic.bodies = std::stoul(argv[++i]);
+		else if (arg == "--blocking-physics")
+			physic.asyncPhysics = false;
+		else if (arg == "--rays" && has_value)
+			physic.rays = std::stoul(argv[++i]);
+		else if (arg == "--block" && has_value)
+			physic.block = std::stoul(argv[++i]);
+		else if (arg == "--deformable-block")
+			physic.deformableBlock = true;
+		else if (arg == "--crowd" && has_value)
+			physic.crowd = std::stoul(argv[++i]);
+		else if (arg == "--serial-crowd")
+			physic.serialCrowd = true;
+		else if (arg == "--record" && has_value)
+			physic.record = argv[++i];
+	}
+
+	ReadPhysicArguments(argc, argv);
+
+	Quantix::Core::Platform::HeadlessContext	context(config.width, config.height);
+	Quantix::Core::Platform::Application		app(config.width, config.height);
+	PhysicBenchmark								benchmark(app, config, physic);
+
+	return benchmark.Run() ? 0 : 1;
+}
 
 int WinMain()
 {
+	for (int i = 1; i < __argc; ++i)
+	{
+		if (std::string(__argv[i]) == "--replay")
+		{
+			int result = RunReplay(__argc, __argv);
+			Quantix::Core::Debugger::Logger::GetInstance()->CloseLogger();
+			return result;
+		}
+
+		if (std::string(__argv[i]) == "--benchmark")
+		{
+			int result = 1;
+			try
+			{
+				result = RunBenchmark(__argc, __argv);
+			}
+			catch (const std::exception& e)
+			{
+				std::cout << "Benchmark failed : " << e.what() << std::endl;
+			}
+
+			Quantix::Core::Debugger::Logger::GetInstance()->CloseLogger();
+			return result;
+		}
+	}
+
+	ReadPhysicArguments(__argc, __argv);
+
 	try
 	{
 		Editor							editor(1920, 900);
 		editor.Init();
+
+		// [--record capture] writes the physics steps of the session
+		for (int i = 1; i + 1 < __argc; ++i)
+		{
+			if (std::string(__argv[i]) == "--record")
+				Quantix::Core::Physic::PhysicHandler::GetInstance()->StartRecording(__argv[i + 1]);
+		}
+
 		editor.Update();
 	}
 	catch (const std::exception& e)
@@ -250,6 +250,12 @@ public:
 	 */
 	void												ShowCollider() noexcept;
 
+	/**
+	 * @brief Change the frames in flight of the pipeline and show its metrics
+	 *
+	 */
+	void												ShowPipeline() noexcept;
+
 	/**
 	 * @brief Draw Game
 	 *
@@ -0,0 +1,162 @@
+#ifndef _PHYSICBENCHMARK_H_
+#define _PHYSICBENCHMARK_H_
+
+#include <vector>
+#include <Core/Platform/RenderBenchmark.h>
+#include <Core/Components/CharacterController.h>
+
+// Bodies dropped per row and layer of the physics grid, and the distance between them
+#define BENCHMARK_BODY_ROW 20
+#define BENCHMARK_BODY_SPACING 1.5f
+// Half size of the square covered by the rays, cast down from BENCHMARK_RAY_HEIGHT
+#define BENCHMARK_RAY_EXTENT 50.f
+#define BENCHMARK_RAY_HEIGHT 50.f
+// Height the block falls from and the force breaking its cubes apart
+#define BENCHMARK_BLOCK_HEIGHT 10.f
+#define BENCHMARK_BLOCK_BREAK_FORCE 1000.f
+// Distance between the character controllers of the crowd and the speed they walk around the center at
+#define BENCHMARK_CROWD_SPACING 2.f
+#define BENCHMARK_CROWD_SPEED 3.f
+
+/**
+ * @brief Physics objects added to the scene of the benchmark
+ */
+struct PhysicBenchmarkConfig
+{
+	#pragma region Attributes
+	// Dynamic cubes dropped on a ground, the scene is played when there are some
+	QXuint		bodies { 0 };
+	// The last physics step of a frame runs while the behaviours update and the frame is drawn
+	QXbool		asyncPhysics { true };
+	// Raycasts added to the query batch of each frame
+	QXuint		rays { 0 };
+	// Cubes on each edge of a block dropped on the ground, broken by the fall
+	QXuint		block { 0 };
+	// The block is a DeformableMesh, an object and joints per cube, instead of a FractureMesh
+	QXbool		deformableBlock { false };
+	// Character controllers walking on the ground
+	QXuint		crowd { 0 };
+	// The cells of the crowd are moved one after the other instead of on the workers
+	QXbool		serialCrowd { false };
+	// Capture of the physics steps of the measured frames, nothing is recorded when empty
+	QXstring	record;
+	#pragma endregion Attributes
+};
+
+/**
+ * @brief Benchmark measuring the cost of the physics on the frame: dynamic bodies, a fractured block, a crowd of
+ * character controllers and a batch of raycasts
+ */
+class PhysicBenchmark : public Quantix::Core::Platform::RenderBenchmark
+{
+public:
+	#pragma region Constructors&Destructor
+	/**
+	 * @brief Construct a new Physic Benchmark object
+	 *
+	 * @param app application to draw, its GL context must be current
+	 * @param config settings of the run
+	 * @param physic physics objects of the run
+	 */
+	PhysicBenchmark(Quantix::Core::Platform::Application& app, const Quantix::Core::Platform::BenchmarkConfig& config, const PhysicBenchmarkConfig& physic) noexcept;
+
+	/**
+	 * @brief Destroy the Physic Benchmark object
+	 *
+	 */
+	~PhysicBenchmark() = default;
+	#pragma endregion Constructors&Destructor
+
+protected:
+	#pragma region Methods
+	/**
+	 * @brief Add the ground, the bodies, the block and the crowd to the scene
+	 *
+	 */
+	void	Populate() noexcept override;
+
+	/**
+	 * @brief Set the simulation and the crowd up as the config asks
+	 *
+	 */
+	void	Start() noexcept override;
+
+	/**
+	 * @brief Start the recording on the first measured frame, cast the rays and move the crowd
+	 *
+	 * @param frame frame of the run, warmup included
+	 * @param measured true if the frame is measured
+	 * @return QXbool true once there are physics objects, from the second frame
+	 */
+	QXbool	Step(QXuint frame, QXbool measured) noexcept override;
+
+	/**
+	 * @brief Add the time of the query batch and of the crowd of the frame
+	 *
+	 */
+	void	Sample() noexcept override;
+
+	/**
+	 * @brief Wait for the step left running and stop the recording
+	 *
+	 */
+	void	Stop() noexcept override;
+
+	/**
+	 * @brief Write the physics, fracture, crowd and queries sections
+	 *
+	 * @param stream stream of the report
+	 */
+	void	WriteSections(std::ostream& stream) const noexcept override;
+	#pragma endregion Methods
+
+private:
+	#pragma region Attributes
+	PhysicBenchmarkConfig										_physic;
+
+	std::vector<Quantix::Core::Components::CharacterController*>	_crowd;
+
+	std::vector<QXdouble>										_queryFrames;
+	std::vector<QXdouble>										_crowdFrames;
+	#pragma endregion Attributes
+
+	#pragma region Methods
+	/**
+	 * @brief Add a static ground under the bodies, the block and the crowd
+	 *
+	 */
+	void	SpawnGround() noexcept;
+
+	/**
+	 * @brief Add the dynamic cubes of the config to the scene
+	 *
+	 */
+	void	SpawnBodies() noexcept;
+
+	/**
+	 * @brief Add the block of the config to the scene, generated by a FractureMesh or a DeformableMesh
+	 *
+	 */
+	void	SpawnBlock() noexcept;
+
+	/**
+	 * @brief Add the character controllers of the config to the scene, a grid on the ground
+	 *
+	 */
+	void	SpawnCrowd() noexcept;
+
+	/**
+	 * @brief Ask the move of the frame of every controller of the crowd, they walk around the center
+	 *
+	 */
+	void	MoveCrowd() noexcept;
+
+	/**
+	 * @brief Add the rays of the config to the query batch of the frame, a grid cast down on the scene
+	 *
+	 */
+	void	CastRays() noexcept;
+	#pragma endregion Methods
+};
+
+#endif // _PHYSICBENCHMARK_H_
@@ -351,17 +351,8 @@ void Editor::UpdateScene() noexcept
 	SaveLoadScene();
 	STOP_PROFILING("SaveLoad");
 
-	std::vector<Quantix::Core::Components::Mesh*>	meshes;
-	std::vector<Quantix::Core::Components::ICollider*>	colliders;
-	_lights.clear();
-
-	START_PROFILING("Application");
-	//Update Application
-	if (!_pause && _play)
-		_app->Update(meshes, colliders, _lights, true);
-	else
-		_app->Update(meshes, colliders, _lights);
-	STOP_PROFILING("Application");
+	//Init loaded resources, needs the GL context
+	_app->UpdateResources();
 
 	START_PROFILING("Camera");
 	//Update Camera
@@ -369,17 +360,51 @@ void Editor::UpdateScene() noexcept
 	CameraUpdateEditor();
 	STOP_PROFILING("Camera");
 
+	std::vector<Quantix::Core::Components::Mesh*>	meshes;
+	std::vector<Quantix::Core::Components::ICollider*>	colliders;
+	QXbool is_playing = !_pause && _play;
+	QXbool show_colliders = _showCollider;
+
+	//Update Application on the game thread, while the previous frame is drawn
+	_app->pipeline.Simulate([this, &meshes, &colliders, is_playing, show_colliders](Quantix::Core::Render::RenderSnapshot& snapshot)
+		{
+			START_PROFILING("Application");
+			_lights.clear();
+			_app->Update(meshes, colliders, _lights, is_playing);
+			STOP_PROFILING("Application");
+
+			snapshot.Build(meshes, colliders, _lights, _app->info, show_colliders);
+			snapshot.BuildSprites(_app->scene->GetSprites());
+			snapshot.depthPrepass = _app->scene->GetDepthPrepass();
+			snapshot.AddView(_mainCamera);
+
+			// Sprites are drawn over the game only
+			QXuint editor_view = snapshot.AddView(_cameraEditor);
+			snapshot.views[editor_view].drawSprites = false;
+		});
+
 	START_PROFILING("Draw");
-	_app->renderer.Draw(meshes, colliders, _lights, _app->info, _mainCamera, _gameBuffer, false);
-	_app->renderer.Draw(meshes, colliders, _lights, _app->info, _cameraEditor, _sceneBuffer, _showCollider);
-	//Update Editor + Draw Scene
-	UpdateEditor();
+	const Quantix::Core::Render::RenderSnapshot& snapshot = _app->pipeline.GetRenderSnapshot();
+	_app->renderer.BeginFrame();
+	_app->renderer.Draw(snapshot, 0, _gameBuffer, false);
+	_app->renderer.Draw(snapshot, 1, _sceneBuffer, _showCollider);
+	_app->renderer.EndFrame();
 	STOP_PROFILING("Draw");
 
+	//The scene is only edited once the game thread is done
+	_app->pipeline.Sync();
+
+	START_PROFILING("UpdateEditor");
+	//Update Editor
+	UpdateEditor();
+	STOP_PROFILING("UpdateEditor");
+
 	START_PROFILING("Refresh");
 	//Refresh Window
 	_win.Refresh(_app->info);
 	STOP_PROFILING("Refresh");
+
+	_app->pipeline.Present();
 }
 
 void Editor::UpdateEditor() noexcept
@@ -468,8 +493,10 @@ void Editor::DrawShader(const QXstring& name, ImGuiWindowFlags flags) noexcept
 			std::list<QXstring>						ShaderName;
 			for (auto it = _app->manager.GetShaders().begin(); it != _app->manager.GetShaders().end(); ++it)
 			{
-				ShaderID.insert(std::make_pair(GetNameOfShader(it->first), it->second->GetID()));
-				ShaderName.push_back(GetNameOfShader(it->first));
+				// Named after the fragment shader, specialized programs are listed once
+				QXstring shader_name = GetNameOfShader(it->second->GetPath()[1]);
+				if (ShaderID.insert(std::make_pair(shader_name, it->second->GetID())).second)
+					ShaderName.push_back(shader_name);
 			}
 			ShaderName.sort();
 			for (auto it = ShaderName.begin(); it != ShaderName.end(); ++it)
@@ -570,6 +597,47 @@ void Editor::ShowCollider() noexcept
 	ImGui::PopStyleColor();
 }
 
+void Editor::ShowPipeline() noexcept
+{
+	QXfloat posX = ImGui::GetWindowSize().x / 2 + 250;
+	Quantix::Core::Render::FramePipeline& pipeline = _app->pipeline;
+	ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0, 0, 0, 1));
+	if (pipeline.GetDepth() > 1)
+		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(44 / 255, 62 / 255, 80 / 255, 1));
+	else
+		ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(128 / 255.f, 128 / 255.f, 128 / 255.f, 1));
+	ImGui::SetCursorPos(ImVec2(posX, 0));
+	QXstring label = "Pipeline " + std::to_string(pipeline.GetDepth());
+	if (ImGui::Button(label.c_str(), ImVec2(90, 30)))
+		pipeline.SetDepth(pipeline.GetDepth() > 1 ? 1 : 2);
+	ImGui::PopStyleColor();
+	ImGui::PopStyleColor();
+
+	const Quantix::Core::Render::FrameMetrics& metrics = pipeline.GetMetrics();
+	ImGui::SameLine();
+	ImGui::Text("%.2f ms | latency %.2f ms (max %.2f) | game %.2f ms | render %.2f ms", metrics.averageFrameTime * 1000.0,
+		metrics.averageLatency * 1000.0, metrics.maxLatency * 1000.0, metrics.gameTime * 1000.0, metrics.renderTime * 1000.0);
+
+	Quantix::Core::Render::DynamicResolution& resolution = _app->renderer.GetDynamicResolution();
+	ImGui::SameLine();
+	ImGui::Checkbox("Dynamic resolution", &resolution.enable);
+	ImGui::SameLine();
+	ImGui::Text("%d%% | gpu %.2f ms", (QXint)(resolution.GetScale() * 100.f + 0.5f), resolution.GetGPUTime() * 1000.0);
+
+	//Overdraw of the opaque meshes, the depth prepass writes what would be shaded without it
+	QXbool depth_prepass = _app->scene->GetDepthPrepass();
+	ImGui::SameLine();
+	if (ImGui::Checkbox("Depth prepass", &depth_prepass))
+		_app->scene->SetDepthPrepass(depth_prepass);
+	ImGui::SameLine();
+	QXfloat depth_overdraw = _app->renderer.GetDepthOverdraw();
+	QXfloat shaded_overdraw = _app->renderer.GetShadedOverdraw();
+	if (depth_prepass && depth_overdraw > 0.f)
+		ImGui::Text("overdraw %.2f -> %.2f (-%d%%)", depth_overdraw, shaded_overdraw, (QXint)((1.f - shaded_overdraw / depth_overdraw) * 100.f + 0.5f));
+	else
+		ImGui::Text("overdraw %.2f", shaded_overdraw);
+}
+
 void Editor::DrawSimulation() noexcept
 {
 	ImGuiWindowFlags flags = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoMove;
@@ -578,6 +646,7 @@ void Editor::DrawSimulation() noexcept
 	Simulation();
 	MaximizeOnPlay();
 	ShowCollider();
+	ShowPipeline();
 	ChangeStateSimulation();
 	ImGui::EndChild();
 }
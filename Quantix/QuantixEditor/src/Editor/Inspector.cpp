@@ -4,6 +4,7 @@
 #include <Core/Components/SoundEmitter.h>
 #include <Core/Components/SoundListener.h>
 #include <Core/Components/DeformableMesh.h>
+#include <Core/Components/FractureMesh.h>
 #include <Core/DataStructure/Component.h>
 #include <Core/Components/Behaviour.h>
 #include <Core/Components/Behaviours/CubeGenerator.h>
@@ -501,6 +502,8 @@ void Inspector::CheckSpecClass(rttr::type t, rttr::instance inst, Quantix::Core:
 		PlaySound(inst, t);
 	if (t == rttr::type::get<Quantix::Core::Components::DeformableMesh>())
 		GenerateDeformableMesh(t, inst, app);
+	if (t == rttr::type::get<Quantix::Core::Components::FractureMesh>())
+		GenerateDeformableMesh(t, inst, app);
 }
 
 void Inspector::ShowXYZ(QXbool& isOpen, QXstring& name) noexcept
@@ -0,0 +1,258 @@
+#include "PhysicBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <Core/Physic/PhysicHandler.h>
+#include <Core/Components/Mesh.h>
+#include <Core/Components/CubeCollider.h>
+#include <Core/Components/Rigidbody.h>
+#include <Core/Components/FractureMesh.h>
+#include <Core/Components/DeformableMesh.h>
+
+PhysicBenchmark::PhysicBenchmark(Quantix::Core::Platform::Application& app, const Quantix::Core::Platform::BenchmarkConfig& config, const PhysicBenchmarkConfig& physic) noexcept :
+	RenderBenchmark(app, config),
+	_physic{ physic }
+{
+}
+
+void PhysicBenchmark::Populate() noexcept
+{
+	SpawnGround();
+	SpawnBodies();
+	SpawnBlock();
+	SpawnCrowd();
+}
+
+void PhysicBenchmark::Start() noexcept
+{
+	Quantix::Core::Physic::PhysicHandler::GetInstance()->SetAsyncSimulation(_physic.asyncPhysics);
+	Quantix::Core::Physic::PhysicHandler::GetInstance()->GetCrowd().SetParallel(!_physic.serialCrowd);
+}
+
+QXbool PhysicBenchmark::Step(QXuint frame, QXbool measured) noexcept
+{
+	// Only the steps of the measured frames are recorded
+	if (measured && frame == _config.warmup && !_physic.record.empty())
+		Quantix::Core::Physic::PhysicHandler::GetInstance()->StartRecording(_physic.record);
+
+	CastRays();
+	MoveCrowd();
+
+	// The first frame places the actors on their objects, the bodies fall from the next one
+	return (_physic.bodies > 0 || _physic.block > 0 || _physic.crowd > 0) && frame > 0;
+}
+
+void PhysicBenchmark::Sample() noexcept
+{
+	_queryFrames.push_back(Quantix::Core::Physic::PhysicHandler::GetInstance()->GetQueryTime());
+	_crowdFrames.push_back(Quantix::Core::Physic::PhysicHandler::GetInstance()->GetCrowdTime());
+}
+
+void PhysicBenchmark::Stop() noexcept
+{
+	// The step left running is not part of the measures
+	Quantix::Core::Physic::PhysicHandler::GetInstance()->FetchSimulation();
+	Quantix::Core::Physic::PhysicHandler::GetInstance()->StopRecording();
+}
+
+void PhysicBenchmark::WriteSections(std::ostream& stream) const noexcept
+{
+	auto average = [](const std::vector<QXdouble>& values)
+	{
+		QXdouble total = 0.0;
+		for (QXsizei i = 0; i < values.size(); ++i)
+			total += values[i];
+		return values.empty() ? 0.0 : total / values.size();
+	};
+
+	auto percentile = [](std::vector<QXdouble> values, QXdouble rank)
+	{
+		if (values.empty())
+			return 0.0;
+		std::sort(values.begin(), values.end());
+		return values[std::min(values.size() - 1, (QXsizei)(rank * values.size()))];
+	};
+
+	// Times are written in milliseconds
+	const QXdouble ms = 1000.0;
+
+	stream << "\t\"physics\": {\n";
+	stream << "\t\t\"bodies\": " << _physic.bodies << ",\n";
+	stream << "\t\t\"async\": " << (_physic.asyncPhysics ? "true" : "false") << "\n";
+	stream << "\t},\n";
+
+	// Actors the fractured blocks broke into, the cubes of a DeformableMesh are objects and are not counted
+	QXsizei pieces = 0;
+	QXsizei broken_bonds = 0;
+	for (const Quantix::Core::Physic::VoxelFracture* fracture : Quantix::Core::Physic::PhysicHandler::GetInstance()->GetFractures())
+	{
+		pieces += fracture->GetPieceCount();
+		broken_bonds += fracture->GetBrokenBonds();
+	}
+
+	stream << "\t\"fracture\": {\n";
+	stream << "\t\t\"block\": " << _physic.block << ",\n";
+	stream << "\t\t\"deformable\": " << (_physic.deformableBlock ? "true" : "false") << ",\n";
+	stream << "\t\t\"pieces\": " << pieces << ",\n";
+	stream << "\t\t\"brokenBonds\": " << broken_bonds << "\n";
+	stream << "\t},\n";
+
+	// Time of the moves of the controllers of the frame
+	stream << "\t\"crowd\": {\n";
+	stream << "\t\t\"agents\": " << _physic.crowd << ",\n";
+	stream << "\t\t\"parallel\": " << (_physic.serialCrowd ? "false" : "true") << ",\n";
+	stream << "\t\t\"average\": " << average(_crowdFrames) * ms << ",\n";
+	stream << "\t\t\"p95\": " << percentile(_crowdFrames, 0.95) * ms << "\n";
+	stream << "\t},\n";
+
+	// Time of the query batch of the frame, run on the workers
+	stream << "\t\"queries\": {\n";
+	stream << "\t\t\"rays\": " << _physic.rays << ",\n";
+	stream << "\t\t\"average\": " << average(_queryFrames) * ms << ",\n";
+	stream << "\t\t\"p95\": " << percentile(_queryFrames, 0.95) * ms << "\n";
+	stream << "\t},\n";
+}
+
+void PhysicBenchmark::SpawnGround() noexcept
+{
+	if (_physic.bodies == 0 && _physic.block == 0 && _physic.crowd == 0)
+		return;
+
+	Quantix::Core::DataStructure::GameObject3D* ground = _app.scene->AddGameObject("Benchmark Ground");
+	ground->SetTransformValue(Math::QXvec3(0.f, -1.f, 0.f), Math::QXquaternion(1.f, 0.f, 0.f, 0.f), Math::QXvec3(100.f, 1.f, 100.f));
+
+	Quantix::Core::Components::Mesh* mesh = ground->AddComponent<Quantix::Core::Components::Mesh>();
+	mesh->Init(ground);
+	_app.manager.CreateMesh(mesh, "media/Mesh/cube.obj");
+
+	Quantix::Core::Components::CubeCollider* collider = ground->AddComponent<Quantix::Core::Components::CubeCollider>();
+	collider->Init(ground);
+	collider->SetHalfExtents(Math::QXvec3(50.f, 0.5f, 50.f));
+}
+
+void PhysicBenchmark::SpawnBodies() noexcept
+{
+	if (_physic.bodies == 0)
+		return;
+
+	// Layers of rows centered above the ground, every cube falls and settles on the ones below
+	const QXfloat offset = (BENCHMARK_BODY_ROW - 1) * BENCHMARK_BODY_SPACING * 0.5f;
+
+	for (QXuint i = 0; i < _physic.bodies; ++i)
+	{
+		QXuint x = i % BENCHMARK_BODY_ROW;
+		QXuint z = (i / BENCHMARK_BODY_ROW) % BENCHMARK_BODY_ROW;
+		QXuint y = i / (BENCHMARK_BODY_ROW * BENCHMARK_BODY_ROW);
+
+		Math::QXvec3 position(x * BENCHMARK_BODY_SPACING - offset, 1.f + y * BENCHMARK_BODY_SPACING, z * BENCHMARK_BODY_SPACING - offset);
+
+		Quantix::Core::DataStructure::GameObject3D* cube = _app.scene->AddGameObject("Benchmark Body " + std::to_string(i));
+		cube->SetTransformValue(position, Math::QXquaternion(1.f, 0.f, 0.f, 0.f), Math::QXvec3(1.f, 1.f, 1.f));
+
+		Quantix::Core::Components::Mesh* mesh = cube->AddComponent<Quantix::Core::Components::Mesh>();
+		mesh->Init(cube);
+		_app.manager.CreateMesh(mesh, "media/Mesh/cube.obj");
+
+		cube->AddComponent<Quantix::Core::Components::CubeCollider>()->Init(cube);
+
+		Quantix::Core::Components::Rigidbody* rigid = cube->AddComponent<Quantix::Core::Components::Rigidbody>();
+		rigid->Init(cube);
+		rigid->SetTransformPosition(position);
+	}
+}
+
+void PhysicBenchmark::SpawnBlock() noexcept
+{
+	if (_physic.block == 0)
+		return;
+
+	// Centered above the ground, the first cube is the corner of the block
+	QXfloat offset = (_physic.block - 1) * 0.5f;
+
+	Quantix::Core::DataStructure::GameObject3D* object = _app.scene->AddGameObject("Benchmark Block");
+	object->SetTransformValue(Math::QXvec3(-offset, BENCHMARK_BLOCK_HEIGHT, -offset), Math::QXquaternion(1.f, 0.f, 0.f, 0.f), Math::QXvec3(1.f, 1.f, 1.f));
+
+	if (_physic.deformableBlock)
+	{
+		Quantix::Core::Components::DeformableMesh* block = object->AddComponent<Quantix::Core::Components::DeformableMesh>();
+		block->Init(object);
+		block->numCubeInWidth = _physic.block;
+		block->numCubeInHeight = _physic.block;
+		block->numCubeInDepth = _physic.block;
+		block->SetBreakForce(BENCHMARK_BLOCK_BREAK_FORCE);
+		block->Generate(_app.scene, &_app.manager, false);
+	}
+	else
+	{
+		Quantix::Core::Components::FractureMesh* block = object->AddComponent<Quantix::Core::Components::FractureMesh>();
+		block->Init(object);
+		block->numCubeInWidth = _physic.block;
+		block->numCubeInHeight = _physic.block;
+		block->numCubeInDepth = _physic.block;
+		block->SetBreakForce(BENCHMARK_BLOCK_BREAK_FORCE);
+		block->Generate(_app.scene, &_app.manager, false);
+	}
+}
+
+void PhysicBenchmark::SpawnCrowd() noexcept
+{
+	if (_physic.crowd == 0)
+		return;
+
+	// Square grid centered on the ground, the controllers stand on it
+	QXuint side = (QXuint)ceilf(sqrtf((QXfloat)_physic.crowd));
+	QXfloat offset = (side - 1) * BENCHMARK_CROWD_SPACING * 0.5f;
+
+	for (QXuint i = 0; i < _physic.crowd; ++i)
+	{
+		Math::QXvec3 position((i % side) * BENCHMARK_CROWD_SPACING - offset, 0.f, (i / side) * BENCHMARK_CROWD_SPACING - offset);
+
+		Quantix::Core::DataStructure::GameObject3D* agent = _app.scene->AddGameObject("Benchmark Agent " + std::to_string(i));
+		agent->SetTransformValue(position, Math::QXquaternion(1.f, 0.f, 0.f, 0.f), Math::QXvec3(1.f, 2.f, 1.f));
+
+		Quantix::Core::Components::Mesh* mesh = agent->AddComponent<Quantix::Core::Components::Mesh>();
+		mesh->Init(agent);
+		_app.manager.CreateMesh(mesh, "media/Mesh/cube.obj");
+
+		Quantix::Core::Components::CharacterController* controller = agent->AddComponent<Quantix::Core::Components::CharacterController>();
+		controller->Init(agent);
+		controller->SetFootPosition(position);
+
+		_crowd.push_back(controller);
+	}
+}
+
+void PhysicBenchmark::MoveCrowd() noexcept
+{
+	QXfloat delta_time = (QXfloat)BENCHMARK_DELTA_TIME;
+
+	for (Quantix::Core::Components::CharacterController* controller : _crowd)
+	{
+		// Tangent of the circle around the center, the neighbours on other circles cross each other
+		Math::QXvec3 position = controller->GetPosition();
+		Math::QXvec3 walk(-position.z, 0.f, position.x);
+		QXfloat length = walk.Length();
+		if (length > 0.f)
+			walk = walk * (BENCHMARK_CROWD_SPEED / length);
+
+		controller->Move((GRAVITY + walk) * delta_time, 0, delta_time);
+	}
+}
+
+void PhysicBenchmark::CastRays() noexcept
+{
+	if (_physic.rays == 0)
+		return;
+
+	Quantix::Core::Physic::SceneQueryBatch& batch = Quantix::Core::Physic::PhysicHandler::GetInstance()->GetQueryBatch();
+
+	QXuint side = (QXuint)ceilf(sqrtf((QXfloat)_physic.rays));
+	QXfloat spacing = side > 1 ? 2.f * BENCHMARK_RAY_EXTENT / (side - 1) : 0.f;
+
+	for (QXuint i = 0; i < _physic.rays; ++i)
+	{
+		Math::QXvec3 origin((i % side) * spacing - BENCHMARK_RAY_EXTENT, BENCHMARK_RAY_HEIGHT, (i / side) * spacing - BENCHMARK_RAY_EXTENT);
+		batch.Raycast(origin, Math::QXvec3(0.f, -1.f, 0.f), 2.f * BENCHMARK_RAY_HEIGHT);
+	}
+}
@@ -5,6 +5,7 @@
 #include "Core/DataStructure/Component.h"
 #include "rttrEnabled.h"
 #include "Core/MathHeader.h"
+#include "Core/Physic/PhysicEvent.h"
 #include <iostream>
 
 namespace Quantix::Core::DataStructure
@@ -31,8 +32,37 @@ namespace Quantix::Core::Components
 		virtual void	Update(QXdouble deltaTime) {}
 		virtual void    OnCollision(Core::DataStructure::GameObject3D* me, Core::DataStructure::GameObject3D* other, Math::QXvec3& position, Math::QXvec3& normal) {}
 		virtual void    OnTrigger(Core::DataStructure::GameObject3D* me, Core::DataStructure::GameObject3D* other) {}
+
+		/**
+		 * @brief Called for each physic event the behaviour subscribed to, sends it to OnCollision or OnTrigger by default
+		 *
+		 * @param event event of the last step, its receiver is the object of the behaviour
+		 */
+		virtual void	OnPhysicEvent(const Physic::PhysicEvent& event);
 		virtual void	Destroy() override {}
 
+		/**
+		 * @brief Receive the physic events of a mask, every event is received by default
+		 *
+		 * @param events mask of the events
+		 */
+		inline void		Subscribe(Physic::EPhysicEvent events) noexcept { _physicEvents |= (QXuint)events; }
+
+		/**
+		 * @brief Stop receiving the physic events of a mask
+		 *
+		 * @param events mask of the events
+		 */
+		inline void		Unsubscribe(Physic::EPhysicEvent events) noexcept { _physicEvents &= ~(QXuint)events; }
+
+		/**
+		 * @brief Check if the behaviour receives an event
+		 *
+		 * @param event event raised by the physic
+		 * @return QXbool true if the behaviour subscribed to it
+		 */
+		inline QXbool	IsSubscribed(Physic::EPhysicEvent event) const noexcept { return (_physicEvents & (QXuint)event) != 0; }
+
 		//inline virtual void	OnCollision(Physics::Collision::Collider * collider) {};
 
 		Behaviour* Copy() const;
@@ -40,6 +70,9 @@ namespace Quantix::Core::Components
 		void Init(Core::DataStructure::GameComponent* object) override;
 
 
+		// Mask of the EPhysicEvent sent to OnCollision and OnTrigger
+		QXuint			_physicEvents { (QXuint)Physic::EPhysicEvent::ALL };
+
 		CLASS_REGISTRATION(Quantix::Core::DataStructure::Component)
 	};
 
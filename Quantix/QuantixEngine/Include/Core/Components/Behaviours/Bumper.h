@@ -66,6 +66,12 @@ namespace Quantix::Core::Components::Behaviours
 
 			#pragma region Methods
 
+			/**
+			 * @brief Subscribe to the objects entering the bumper
+			 *
+			 */
+			void						Awake() override;
+
 			/**
 			 * @brief Called when Physic raise an OnTriggerEvent for this behaviour
 			 *
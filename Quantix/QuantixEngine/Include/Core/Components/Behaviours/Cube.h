@@ -4,6 +4,7 @@
 #include "Core\Components\Behaviour.h"
 #include "rttrEnabled.h"
 #include "Core/Components//Mesh.h"
+#include "Core/Physic/SceneQuery.h"
 
 #define ATTRACTFORCE 750.f
 #define REJECTFORCE 250.f
@@ -40,11 +41,23 @@ namespace Quantix::Core::Components::Behaviours
 			Resources::Material* saveMaterial;
 			Resources::Material* currentMaterial;
 
+			// Overlap of the magnet added to the frame batch, read on the next frame
+			QXuint		_overlapId		{ 0 };
+			QXuint		_overlapFrame	{ 0 };
+
 
 			#pragma endregion
 
 			#pragma region Methods
 
+			/**
+			 * @brief Get the objects found by the overlap of the magnet on the last frame and add the one of this frame
+			 *
+			 * @param hits objects found, nullptr if none
+			 * @return QXuint number of objects found
+			 */
+			QXuint						OverlapMagnet(const Physic::QueryHit*& hits) noexcept;
+
 			void						Attract(QXdouble deltaTime) noexcept;
 			void						Reject(QXdouble deltaTime) noexcept;
 
@@ -15,7 +15,9 @@ namespace Quantix::Core::Components::Behaviours
 
 		#pragma region Attributes
 
+		// Cubes spawned from the pool of the scene and not released yet
 		std::list<Core::DataStructure::GameObject3D*>	_cubes;
+		QXuint											_prefab				{ 0 };
 		QXfloat											_distForGeneration	{ 5.f };
 		QXuint											_nbMaxOfCubes		{ 1 };
 		Core::DataStructure::GameObject3D*				_gameobject			{ nullptr };
@@ -29,8 +31,8 @@ namespace Quantix::Core::Components::Behaviours
 
 		#pragma region Methods
 
-		void					CreateCube() noexcept;
-		void					ReUseCube(Core::DataStructure::GameObject3D* cube) noexcept;
+		void					RegisterCube() noexcept;
+		void					SpawnCube() noexcept;
 
 		#pragma endregion
 
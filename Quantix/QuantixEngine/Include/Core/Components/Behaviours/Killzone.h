@@ -52,6 +52,14 @@ namespace Quantix::Core::Components::Behaviours
 
 		void	Awake() override;
 
+		/**
+		 * @brief Release only the piece of a fractured block entering the zone, the other events are sent to OnTrigger
+		 * and OnCollision
+		 * 
+		 * @param event event of the last step
+		 */
+		void	OnPhysicEvent(const Physic::PhysicEvent& event) override;
+
 		/**
 		 * @brief Called when Physic raise an OnTriggerEvent for this behaviour
 		 * 
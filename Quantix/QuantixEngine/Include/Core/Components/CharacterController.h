@@ -14,6 +14,8 @@ namespace Quantix::Core::Components
 	struct QUANTIX_API CharacterController : public Quantix::Core::DataStructure::Component
 	{
 		physx::PxCapsuleController* controller {nullptr};
+		// Handle of the controller in the crowd of the physic handler
+		QXuint agent { CROWD_INVALID_AGENT };
 
 		Math::QXvec3 _velocity;
 
@@ -66,7 +68,8 @@ namespace Quantix::Core::Components
 		void	Destroy() noexcept override;
 
 		/**
-		 * @brief Move the character controller to the position
+		 * @brief Move the character controller to the position, the move is run with the other controllers before
+		 * the objects follow them
 		 * 
 		 * @param vec Position to travel in goal
 		 * @param minDist Minimum distance to travel
@@ -8,6 +8,7 @@
 #include "rttrEnabled.h"
 #include "Core/MathHeader.h"
 #include "Core/Physic/PhysicSetting.h"
+#include "Core/Physic/ShapeLibrary.h"
 
 namespace Quantix::Core::DataStructure
 {
@@ -30,6 +31,7 @@ namespace Quantix::Core::Components
 		SPHERE,
 		CUBE, 
 		CAPSULE,
+		MESH,
 		COUNT
 	};
 
@@ -37,6 +39,8 @@ namespace Quantix::Core::Components
 	{
 #pragma region Attributes
 		physx::PxShape* shape{ nullptr };
+		// Geometry, pose, filters and flags of the shape, the shape is shared with the colliders of the same key
+		Physic::ShapeKey key;
 		Physic::IPhysicType* actorPhysic{ nullptr };
 		
 		EPhysXType physicType { EPhysXType::DEFAULT };
@@ -133,6 +137,12 @@ namespace Quantix::Core::Components
 		 */
 		virtual void Destroy() override;
 
+		/**
+		 * @brief Take the shape of the key after it changed, a shared shape is not changed in place
+		 * 
+		 */
+		void Reshape() noexcept;
+
 #pragma region Acessors 
 
 		/**
@@ -177,6 +187,21 @@ namespace Quantix::Core::Components
 		 */
 		Physic::FilterGroup::Enum GetMyFilterGroup() noexcept;
 
+		/**
+		 * @brief Set a flag of the key and take its shape
+		 * 
+		 * @param flag flag to set
+		 * @param b value of the flag
+		 */
+		void SetKeyFlag(physx::PxShapeFlag::Enum flag, bool b) noexcept
+		{
+			if (b)
+				key.flags.raise(flag);
+			else
+				key.flags.clear(flag);
+			Reshape();
+		}
+
 		/**
  		* @brief Set the Shape Flag Scene Query object
  		*	
@@ -185,7 +210,7 @@ namespace Quantix::Core::Components
 		void SetShapeFlagSceneQuery(bool b) noexcept
 		{
 			shapeFlag.sceneQuery = b;
-			shape->setFlag(physx::PxShapeFlag::eSCENE_QUERY_SHAPE, b);
+			SetKeyFlag(physx::PxShapeFlag::eSCENE_QUERY_SHAPE, b);
 		}
 
 		/**
@@ -207,7 +232,7 @@ namespace Quantix::Core::Components
 				return;
 
 			shapeFlag.simulation = b;
-			shape->setFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, b);
+			SetKeyFlag(physx::PxShapeFlag::eSIMULATION_SHAPE, b);
 		}
 
 		/**
@@ -229,7 +254,7 @@ namespace Quantix::Core::Components
 				return;
 
 			shapeFlag.trigger = b;
-			shape->setFlag(physx::PxShapeFlag::eTRIGGER_SHAPE, b);
+			SetKeyFlag(physx::PxShapeFlag::eTRIGGER_SHAPE, b);
 		}
 
 		/**
@@ -248,7 +273,7 @@ namespace Quantix::Core::Components
 		void SetShapeFlagVisualization(bool b) noexcept
 		{
 			shapeFlag.visualization = b;
-			shape->setFlag(physx::PxShapeFlag::eVISUALIZATION, b);
+			SetKeyFlag(physx::PxShapeFlag::eVISUALIZATION, b);
 		}
 
 		/**
@@ -289,7 +314,7 @@ namespace Quantix::Core::Components
 			collideFilter.pawn = b;
 
 			physx::PxFilterData filterData;
-			filterData.word0 = shape->getSimulationFilterData().word0; // word0 = own ID
+			filterData.word0 = key.filterData.word0; // word0 = own ID
 
 			physx::PxU32 mask = 0;
 			if (GetCollideFilterCrab())
@@ -300,7 +325,8 @@ namespace Quantix::Core::Components
 				mask |= Physic::FilterGroup::Enum::eMINE_HEAD;
 			filterData.word1 = mask;  // word1 = ID mask to filter pairs that trigger a
 									  // contact callback;
-			shape->setSimulationFilterData(filterData);
+			key.filterData = filterData;
+			Reshape();
 		}
 
 		/**
@@ -313,7 +339,7 @@ namespace Quantix::Core::Components
 			collideFilter.mine = b;
 
 			physx::PxFilterData filterData;
-			filterData.word0 = shape->getSimulationFilterData().word0; // word0 = own ID
+			filterData.word0 = key.filterData.word0; // word0 = own ID
 
 			physx::PxU32 mask = 0;
 			if (GetCollideFilterCrab())
@@ -324,7 +350,8 @@ namespace Quantix::Core::Components
 				mask |= Physic::FilterGroup::Enum::eMINE_HEAD;
 			filterData.word1 = mask;  // word1 = ID mask to filter pairs that trigger a
 									  // contact callback;
-			shape->setSimulationFilterData(filterData);
+			key.filterData = filterData;
+			Reshape();
 		}
 		
 		/**
@@ -337,7 +364,7 @@ namespace Quantix::Core::Components
 			collideFilter.crab = b;
 
 			physx::PxFilterData filterData;
-			filterData.word0 = shape->getSimulationFilterData().word0; // word0 = own ID
+			filterData.word0 = key.filterData.word0; // word0 = own ID
 
 			physx::PxU32 mask = 0;
 			if (GetCollideFilterCrab())
@@ -348,7 +375,8 @@ namespace Quantix::Core::Components
 				mask |= Physic::FilterGroup::Enum::eMINE_HEAD;
 			filterData.word1 = mask;  // word1 = ID mask to filter pairs that trigger a
 									  // contact callback;
-			shape->setSimulationFilterData(filterData);
+			key.filterData = filterData;
+			Reshape();
 		}
 
 
@@ -0,0 +1,120 @@
+#ifndef __FRACTUREMESH_H__
+#define __FRACTUREMESH_H__
+
+#include "rttrEnabled.h"
+#include "Core/MathHeader.h"
+#include "Core/Components/Behaviour.h"
+#include "Core/Physic/VoxelFracture.h"
+#include "Resources/Scene.h"
+
+#define FRACTURE_MATERIAL "media/Material/Deformable.mat"
+
+namespace Quantix::Core::DataStructure
+{
+	class ResourcesManager;
+}
+
+namespace Quantix::Core::Components
+{
+	/**
+	 * @brief Block of cubes broken by the impacts, replaces the object per cube of the DeformableMesh. The block is
+	 * simulated by a VoxelFracture and its cubes are drawn in one instanced batch with the mesh of the object
+	 */
+	struct QUANTIX_API FractureMesh : public Behaviour
+	{
+		Math::QXvec3 cubeSize {Math::QXvec3(1,1,1)};
+
+		QXuint numCubeInWidth {1};
+		QXuint numCubeInHeight {1};
+		QXuint numCubeInDepth {1};
+
+		QXfloat breakForce {1000.f};
+		QXfloat density {1.f};
+
+		Physic::VoxelFracture* fracture {nullptr};
+
+		/**
+		 * @brief Construct a new Fracture Mesh object
+		 *
+		 */
+		FractureMesh() = default;
+
+		/**
+		 * @brief Construct a new Fracture Mesh object
+		 *
+		 * @param src FractureMesh to copy
+		 */
+		FractureMesh(const FractureMesh& src) = default;
+
+		/**
+		 * @brief Construct a new Fracture Mesh object
+		 *
+		 * @param src FractureMesh to move
+		 */
+		FractureMesh(FractureMesh&& src) = default;
+
+		/**
+		 * @brief Destroy the Fracture Mesh object
+		 *
+		 */
+		~FractureMesh() = default;
+
+		/**
+		 * @brief Create a New FractureMesh, the copy generates its own block
+		 *
+		 * @return FractureMesh*
+		 */
+		FractureMesh* Copy() const override;
+
+		/**
+		 * @brief Release the block of the component
+		 *
+		 */
+		void Destroy() override;
+
+		/**
+		 * @brief Subscribe to the contacts of the block
+		 *
+		 */
+		void Awake() override;
+
+		/**
+		 * @brief Keep the impacts on the cubes, the block breaks once the step is fetched
+		 *
+		 * @param event event of the last step
+		 */
+		void OnPhysicEvent(const Physic::PhysicEvent& event) override;
+
+		/**
+		 * @brief fully Generate the block at the position of the object
+		 *
+		 * @param scene Current scene
+		 * @param manager manager of the mesh and material
+		 * @param fromLoad true when the mesh was loaded with the object
+		 */
+		void Generate(Resources::Scene* scene, Core::DataStructure::ResourcesManager* manager, QXbool fromLoad = false);
+
+		/**
+		 * @brief Get the Break Force object
+		 *
+		 * @return QXfloat
+		 */
+		QXfloat GetBreakForce() noexcept { return breakForce; }
+
+		/**
+		 * @brief Set the Break Force object, applied to the block already generated
+		 *
+		 * @param force
+		 */
+		void SetBreakForce(QXfloat force) noexcept
+		{
+			breakForce = force;
+			if (fracture)
+				fracture->SetBreakForce(force);
+		}
+
+		CLASS_REGISTRATION(Quantix::Core::DataStructure::Component, Quantix::Core::Components::Behaviour);
+	};
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef __MESHCOLLIDER_H__
+#define __MESHCOLLIDER_H__
+
+#include "Core/Components/Collider.h"
+#include "Core/Physic/CollisionMeshCache.h"
+#include "Core/DLLHeader.h"
+#include "rttrEnabled.h"
+
+namespace Quantix::Core::DataStructure
+{
+	class GameComponent;
+}
+
+namespace Quantix::Core::Components
+{
+	/**
+	 * @brief Collider following the model of the Mesh of its object, cooked off the main thread. The collider has no
+	 * shape until its mesh is cooked, a triangle mesh is only used without Rigidbody as PhysX does not simulate it on
+	 * dynamic actors
+	 */
+	struct QUANTIX_API MeshCollider : public virtual ICollider
+	{
+#pragma region Attributes
+
+		Physic::CollisionMesh* mesh { nullptr };
+
+		// Convex hull of the model or its triangles
+		QXbool convex { true };
+
+#pragma endregion
+
+#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Mesh Collider object
+		 *
+		 */
+		MeshCollider() = default;
+
+		/**
+		 * @brief Construct a new Mesh Collider object
+		 *
+		 * @param par Parent of the MeshCollider
+		 */
+		MeshCollider(DataStructure::GameComponent* par);
+
+		/**
+		 * @brief Construct a new Mesh Collider object
+		 *
+		 * @param other MeshCollider to copy
+		 */
+		MeshCollider(const MeshCollider& other) noexcept;
+
+		/**
+		 * @brief Construct a new Mesh Collider object
+		 *
+		 * @param other MeshCollider to move
+		 */
+		MeshCollider(MeshCollider&& other) noexcept;
+
+		/**
+		 * @brief Destroy the Mesh Collider object
+		 *
+		 */
+		~MeshCollider() noexcept = default;
+#pragma endregion
+
+#pragma region Accessors
+
+		/**
+		 * @brief Is the mesh a convex hull
+		 *
+		 * @return QXbool true for a convex hull, false for the triangles of the model
+		 */
+		QXbool GetConvex() noexcept { return convex; }
+
+		/**
+		 * @brief Set the type of the mesh, the collider waits for the new mesh
+		 *
+		 * @param b true for a convex hull, false for the triangles of the model
+		 */
+		void SetConvex(QXbool b) noexcept;
+
+#pragma endregion
+
+		/**
+		 * @brief Copy a MeshCollider
+		 *
+		 * @return MeshCollider* New Collider
+		 */
+		MeshCollider* Copy() const override;
+
+		/**
+		 * @brief Init a Collider, its shape is attached once its mesh is cooked
+		 *
+		 * @param par Parent of the MeshCollider
+		 */
+		void Init(DataStructure::GameComponent* par) override;
+
+		/**
+		 * @brief Destroy the collider or stop waiting for its mesh
+		 *
+		 */
+		void Destroy() override;
+
+		/**
+		 * @brief Request the mesh of the model once it is loaded, then attach the shape once the mesh is cooked
+		 *
+		 * @return QXbool true when the collider does not wait anymore
+		 */
+		QXbool Attach() noexcept;
+
+		/**
+		 * @brief Follow the object once the shape is attached, the shape is keyed again when the scale of the object
+		 * changes, and the collider gives up its mesh when the object gets or loses a Rigidbody
+		 *
+		 * @return QXbool false when the collider has to wait for another mesh
+		 */
+		QXbool Refresh() noexcept;
+
+		CLASS_REGISTRATION(Quantix::Core::DataStructure::Component, Quantix::Core::Components::ICollider);
+	};
+}
+#endif
@@ -0,0 +1,151 @@
+#ifndef __SPRITE_H__
+#define __SPRITE_H__
+
+#include <Type.h>
+#include <Vec2.h>
+#include <Vec4.h>
+#include "Resources/Texture.h"
+#include "Core/DataStructure/Component.h"
+
+namespace Quantix::Core::Components
+{
+	/**
+	 * @brief Textured quad of a 2D object, drawn over the scene in pixels. Sprites are drawn by layer, the lower
+	 * layers first
+	 */
+	class QUANTIX_API Sprite : public virtual Core::DataStructure::Component
+	{
+	private:
+		#pragma region Attributes
+
+		Resources::Texture*		_texture { nullptr };
+		Math::QXvec4			_color { 1.f, 1.f, 1.f, 1.f };
+		Math::QXvec2			_size { 100.f, 100.f };
+		QXint					_layer { 0 };
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Sprite object
+		 */
+		Sprite() = default;
+
+		/**
+		 * @brief Construct a new Sprite object
+		 *
+		 * @param sprite Sprite to copy
+		 */
+		Sprite(const Sprite& sprite) = default;
+
+		/**
+		 * @brief Construct a new Sprite object
+		 *
+		 * @param sprite Sprite to move
+		 */
+		Sprite(Sprite&& sprite) = default;
+
+		/**
+		 * @brief Destroy the Sprite object
+		 */
+		~Sprite() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Copy sprite
+		 *
+		 * @return Sprite* new sprite
+		 */
+		Sprite*	Copy() const noexcept override;
+
+		/**
+		 * @brief Init sprite
+		 *
+		 * @param object Game component attached
+		 */
+		void	Init(Core::DataStructure::GameComponent* object) noexcept override;
+
+		/**
+		 * @brief Destroy Sprite
+		 */
+		void	Destroy() noexcept override {};
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the Texture
+		 *
+		 * @return Resources::Texture* texture drawn, nullptr draws the color only
+		 */
+		inline Resources::Texture*		GetTexture() const noexcept { return _texture; }
+
+		/**
+		 * @brief Set the Texture
+		 *
+		 * @param texture texture to draw
+		 */
+		inline void						SetTexture(Resources::Texture* texture) noexcept { _texture = texture; }
+
+		/**
+		 * @brief Get the Color
+		 *
+		 * @return const Math::QXvec4& color multiplied with the texture
+		 */
+		inline const Math::QXvec4&		GetColor() const noexcept { return _color; }
+
+		/**
+		 * @brief Set the Color
+		 *
+		 * @param color color multiplied with the texture
+		 */
+		inline void						SetColor(const Math::QXvec4& color) noexcept { _color = color; }
+
+		/**
+		 * @brief Get the Size
+		 *
+		 * @return const Math::QXvec2& size in pixels before the transform of the object
+		 */
+		inline const Math::QXvec2&		GetSize() const noexcept { return _size; }
+
+		/**
+		 * @brief Set the Size
+		 *
+		 * @param size size in pixels before the transform of the object
+		 */
+		inline void						SetSize(const Math::QXvec2& size) noexcept { _size = size; }
+
+		/**
+		 * @brief Get the Layer
+		 *
+		 * @return QXint layer, the sprites of a layer are drawn over the lower layers
+		 */
+		inline QXint					GetLayer() const noexcept { return _layer; }
+
+		/**
+		 * @brief Set the Layer
+		 *
+		 * @param layer layer of the sprite
+		 */
+		inline void						SetLayer(QXint layer) noexcept { _layer = layer; }
+
+		/**
+		 * @brief Check if the sprite is drawn
+		 *
+		 * @return QXbool true if enabled and its texture is ready
+		 */
+		QXbool							IsEnable() noexcept override;
+
+		#pragma endregion
+
+		#pragma endregion
+
+		CLASS_REGISTRATION(Core::DataStructure::Component)
+	};
+}
+
+#endif // __SPRITE_H__
@@ -4,8 +4,13 @@
 #include "Core/DataStructure/GameComponent.h"
 #include "Core/Physic/Transform3D.h"
 
+// Handle of an object without physic actor
+#define PHYSIC_INVALID_HANDLE 0xFFFFFFFF
+
 namespace Quantix::Core::DataStructure
 {
+	class ObjectPool;
+
 	/**
 	 * @brief class GameObject3D
 	 * 
@@ -15,6 +20,12 @@ namespace Quantix::Core::DataStructure
 	protected:
 		#pragma region Attributes
 		Quantix::Core::Physic::Transform3D*		_transform;
+		// Index of the physic body of the object in the physic handler
+		QXuint									_physicHandle { PHYSIC_INVALID_HANDLE };
+		// Pool the object was made by, it is parked in it instead of being destroyed
+		ObjectPool*								_pool { nullptr };
+		QXuint									_prefab { 0 };
+		QXbool									_parked { false };
 		#pragma endregion Attributes
 	public:
 		QXbool toDestroy = false;
@@ -235,6 +246,56 @@ namespace Quantix::Core::DataStructure
 		 *
 		 */
 		Quantix::Core::Physic::Transform3D*		GetTransform() const  noexcept { return _transform; };
+
+		/**
+		 * @brief Get the Physic Handle object
+		 *
+		 * @return QXuint index of the physic body, PHYSIC_INVALID_HANDLE without one
+		 */
+		inline QXuint							GetPhysicHandle() const noexcept { return _physicHandle; };
+
+		/**
+		 * @brief Set the Physic Handle object, only called by the physic handler
+		 *
+		 * @param handle index of the physic body
+		 */
+		inline void								SetPhysicHandle(QXuint handle) noexcept { _physicHandle = handle; };
+
+		/**
+		 * @brief Get the Pool object
+		 *
+		 * @return ObjectPool* pool which made the object, nullptr if it was not made by a pool
+		 */
+		inline ObjectPool*						GetPool() const noexcept { return _pool; };
+
+		/**
+		 * @brief Get the Prefab object
+		 *
+		 * @return QXuint prefab of the object in its pool
+		 */
+		inline QXuint							GetPrefab() const noexcept { return _prefab; };
+
+		/**
+		 * @brief Set the Pool object, only called by the pool
+		 *
+		 * @param pool pool which made the object
+		 * @param prefab prefab of the object in the pool
+		 */
+		inline void								SetPool(ObjectPool* pool, QXuint prefab) noexcept { _pool = pool; _prefab = prefab; };
+
+		/**
+		 * @brief Check if the object waits in its pool
+		 *
+		 * @return QXbool true while the object is neither drawn, updated nor simulated
+		 */
+		inline QXbool							IsParked() const noexcept { return _parked; };
+
+		/**
+		 * @brief Set if the object waits in its pool, only called by the pool
+		 *
+		 * @param parked true when the object is released to its pool
+		 */
+		inline void								SetParked(QXbool parked) noexcept { _parked = parked; };
 #pragma endregion Accessors
 		/**
 		 * @brief operator by copy
@@ -0,0 +1,176 @@
+#ifndef __OBJECTPOOL_H__
+#define __OBJECTPOOL_H__
+
+#include <vector>
+#include <functional>
+
+#include <Type.h>
+#include <Vec3.h>
+#include <Quaternion.h>
+#include "Core/DLLHeader.h"
+
+// Prefab returned when a name is not registered
+#define POOL_NO_PREFAB 0xFFFFFFFF
+
+namespace Quantix::Resources
+{
+	class Scene;
+}
+
+namespace Quantix::Core::DataStructure
+{
+	class GameObject3D;
+
+	/**
+	 * @brief Add the components of a prefab to a new object
+	 */
+	using PrefabBuilder = std::function<void(GameObject3D* object)>;
+
+	/**
+	 * @brief Reset the state of an object of a prefab before it is spawned again
+	 */
+	using PrefabReset = std::function<void(GameObject3D* object)>;
+
+	/**
+	 * @brief Objects of a scene made once per prefab and reused. The objects are built with their components and
+	 * physic actors when the pool is warmed, a released object is parked: it is not drawn nor updated and its actor
+	 * is left out of the simulation and the queries. Spawning and releasing an object only switch these states and
+	 * move its actor, nothing is allocated once the pool is warm
+	 */
+	class QUANTIX_API ObjectPool
+	{
+	private:
+		#pragma region Attributes
+
+		struct Prefab
+		{
+			QXstring					name;
+			PrefabBuilder				build;
+			PrefabReset					reset;
+			std::vector<GameObject3D*>	parked;
+			QXsizei						created { 0 };
+
+			// States of a spawned object, read from the first object built
+			QXbool						render { false };
+			QXbool						update { false };
+		};
+
+		Resources::Scene*		_scene;
+		std::vector<Prefab>		_prefabs;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Build a new object of a prefab, it is parked
+		 *
+		 * @param prefab prefab of the object
+		 * @return GameObject3D* new object
+		 */
+		GameObject3D*	Create(QXuint prefab) noexcept;
+
+		/**
+		 * @brief Stop drawing, updating and simulating an object
+		 *
+		 * @param object object of the pool
+		 */
+		void			Park(GameObject3D* object) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Object Pool object
+		 *
+		 * @param scene scene of the objects
+		 */
+		ObjectPool(Resources::Scene* scene) noexcept;
+
+		/**
+		 * @brief Construct a new Object Pool object (DELETED)
+		 *
+		 * @param pool pool to copy
+		 */
+		ObjectPool(const ObjectPool& pool) = delete;
+
+		/**
+		 * @brief Destroy the Object Pool object, the objects are left to the scene
+		 */
+		~ObjectPool() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Register a prefab, a name already registered keeps its builder
+		 *
+		 * @param name name of the prefab, also the name of its objects
+		 * @param build adds the components of the prefab to an object
+		 * @param reset resets an object before it is spawned again, optional
+		 * @return QXuint prefab
+		 */
+		QXuint			Register(const QXstring& name, const PrefabBuilder& build, const PrefabReset& reset = nullptr) noexcept;
+
+		/**
+		 * @brief Find a prefab by its name
+		 *
+		 * @param name name of the prefab
+		 * @return QXuint prefab, POOL_NO_PREFAB if the name is not registered
+		 */
+		QXuint			Find(const QXstring& name) const noexcept;
+
+		/**
+		 * @brief Build objects of a prefab until count of them are parked, done while loading so spawns do not build
+		 *
+		 * @param prefab prefab of the objects
+		 * @param count objects parked at least
+		 */
+		void			Warm(QXuint prefab, QXsizei count) noexcept;
+
+		/**
+		 * @brief Take a parked object of a prefab, one is built if none is left
+		 *
+		 * @param prefab prefab of the object
+		 * @param position global position of the object
+		 * @param rotation global rotation of the object
+		 * @return GameObject3D* object drawn, updated and simulated from now on
+		 */
+		GameObject3D*	Spawn(QXuint prefab, const Math::QXvec3& position, const Math::QXquaternion& rotation) noexcept;
+
+		/**
+		 * @brief Park an object in its pool, it stays in the scene until its next spawn
+		 *
+		 * @param object object made by this pool
+		 * @return QXbool false if the object is not spawned from this pool
+		 */
+		QXbool			Release(GameObject3D* object) noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of parked objects of a prefab
+		 *
+		 * @param prefab prefab of the objects
+		 * @return QXsizei objects ready to be spawned
+		 */
+		inline QXsizei	GetParkedCount(QXuint prefab) const noexcept { return prefab < _prefabs.size() ? _prefabs[prefab].parked.size() : 0; }
+
+		/**
+		 * @brief Get the number of objects built for a prefab
+		 *
+		 * @param prefab prefab of the objects
+		 * @return QXsizei objects parked or spawned
+		 */
+		inline QXsizei	GetCreatedCount(QXuint prefab) const noexcept { return prefab < _prefabs.size() ? _prefabs[prefab].created : 0; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __OBJECTPOOL_H__
@@ -2,12 +2,14 @@
 #define __RESPURCESMANAGER_H__
 
 #include <unordered_map>
+#include <mutex>
 
 #include "Type.h"
 #include "Resources/Model.h"
 #include "Resources/Shader.h"
 #include "Resources/ShaderProgram.h"
 #include "Resources/Texture.h"
+#include "Resources/Environment.h"
 #include "Resources/Material.h"
 #include "Resources/Sound.h"
 #include "Resources/Scene.h"
@@ -29,11 +31,15 @@ namespace Quantix::Core::DataStructure
 		std::unordered_map<QXstring, Shader*>			_shaders;
 		std::unordered_map<QXstring, ShaderProgram*>	_programs;
 		std::unordered_map<QXstring, Texture*>			_textures;
+		std::unordered_map<QXstring, Environment*>		_environments;
 		std::unordered_map<QXstring, Components::Mesh*>	_meshes;
 		std::unordered_map<QXstring, Sound*>			_sounds;
 		std::unordered_map<QXstring, Scene*>			_scenes;
 
 		std::list<Resource*>							_resourcesToBind;
+
+		// Programs are created by the game thread for new materials and by the render thread for post process
+		std::recursive_mutex							_programMutex;
 			
 		#pragma endregion
 
@@ -193,18 +199,22 @@ namespace Quantix::Core::DataStructure
 		 * 
 		 * @param filePath Path to the shader to load
 		 * @param type Type of the shader, can be VERTEX or FRAGMENT
+		 * @param defines Preprocessor defines used to specialize the shader
 		 * @return Shader* If the shader already exist return it or return a new one
 		 */
-		Shader*				CreateShader(const QXstring& filePath, EShaderType type) noexcept;
+		Shader*				CreateShader(const QXstring& filePath, EShaderType type, const QXstring& defines = "") noexcept;
 
 		/**
 		 * @brief Create a Shader Program object
 		 * 
 		 * @param vertexPath Path to the vertex shader to load
 		 * @param fragmentPath Path to the fragment shader to load
+		 * @param geometryPath Path to the geometry shader to load
+		 * @param defines Preprocessor defines used to specialize the shaders, each permutation is cached
 		 * @return ShaderProgram* If the shader program already exist return it or return a new one
 		 */
-		ShaderProgram*		CreateShaderProgram(const QXstring& vertexPath, const QXstring& fragmentPath, const QXstring& geometryPath = "") noexcept;
+		ShaderProgram*		CreateShaderProgram(const QXstring& vertexPath, const QXstring& fragmentPath, const QXstring& geometryPath = "",
+								const QXstring& defines = "") noexcept;
 
 		/**
 		 * @brief Create a Texture object
@@ -222,6 +232,14 @@ namespace Quantix::Core::DataStructure
 		 */
 		Texture*			CreateHDRTexture(const QXstring& filePath) noexcept;
 
+		/**
+		 * @brief Create an Environment object from HDR file, baked on the first load
+		 * 
+		 * @param filePath Path to the HDR file to load
+		 * @return Environment* If the environment already exist return it or return a new one
+		 */
+		Environment*		CreateEnvironment(const QXstring& filePath) noexcept;
+
 		/**
 		 * @brief Delete a material
 		 * 
@@ -294,6 +312,13 @@ namespace Quantix::Core::DataStructure
 		 */
 		inline std::unordered_map<QXstring, Sound*>&					GetSounds() noexcept { return _sounds; }
 
+		/**
+		 * @brief Check if resources are still loading
+		 * 
+		 * @return QXbool true while a loaded resource waits to be initialized
+		 */
+		inline QXbool													IsLoading() const noexcept { return !_resourcesToBind.empty(); }
+
 		#pragma endregion
 
 		#pragma endregion
@@ -0,0 +1,123 @@
+#ifndef __COLLISIONMESHCACHE_H__
+#define __COLLISIONMESHCACHE_H__
+
+#include <map>
+#include <atomic>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Resources/Resource.h"
+
+// Folder of the cooked meshes, a file is named after the hash of the vertices and indices it was cooked from
+#define COLLISION_MESH_FOLDER "media/Cooked/"
+// Incremented when the cooking parameters change, the files of an older version are cooked again
+#define COLLISION_MESH_VERSION 1
+
+namespace Quantix::Resources
+{
+	class Model;
+}
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Convex or triangle mesh cooked from a model, shared by the mesh colliders of the model
+	 */
+	struct QUANTIX_API CollisionMesh
+	{
+		#pragma region Attributes
+
+		QXbool									convex { true };
+		physx::PxU64							hash { 0 };
+
+		// Cooked data, written by the cooking task and read once by the main thread
+		std::vector<physx::PxU8>				stream;
+		std::atomic<Resources::EResourceStatus>	status { Resources::EResourceStatus::DEFAULT };
+
+		// PxConvexMesh or PxTriangleMesh, made from the stream
+		physx::PxBase*							mesh { nullptr };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Collision meshes of the models. A mesh is cooked once per model and type on a loading task, then kept on
+	 * disk under the hash of its content, so the next loads only read the cooked stream. The meshes are made from
+	 * the streams on the main thread
+	 */
+	class QUANTIX_API CollisionMeshCache
+	{
+	private:
+		#pragma region Attributes
+
+		physx::PxPhysics*												_sdk;
+		physx::PxCooking*												_cooking;
+
+		// Keyed by the model and the type of the mesh
+		std::map<std::pair<Resources::Model*, QXbool>, CollisionMesh*>	_meshes;
+		// Meshes whose cooking task is not done yet
+		std::vector<CollisionMesh*>										_pending;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Read the cooked stream of a model from the disk or cook it, run on a loading task
+		 *
+		 * @param mesh mesh to fill
+		 * @param model loaded model
+		 */
+		void	Cook(CollisionMesh* mesh, Resources::Model* model) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Collision Mesh Cache object
+		 *
+		 * @param sdk physics creating the meshes
+		 * @param cooking cooking of the meshes
+		 */
+		CollisionMeshCache(physx::PxPhysics* sdk, physx::PxCooking* cooking) noexcept;
+
+		/**
+		 * @brief Construct a new Collision Mesh Cache object (DELETED)
+		 *
+		 * @param cache cache to copy
+		 */
+		CollisionMeshCache(const CollisionMeshCache& cache) = delete;
+
+		/**
+		 * @brief Destroy the Collision Mesh Cache object once the meshes being cooked are done, release the meshes
+		 */
+		~CollisionMeshCache() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Get the collision mesh of a model, its cooking starts on the first request
+		 *
+		 * @param model model whose vertices are loaded
+		 * @param convex true for a convex hull, false for the triangles of the model
+		 * @return CollisionMesh* mesh, usable once its status is READY
+		 */
+		CollisionMesh*	Request(Resources::Model* model, QXbool convex) noexcept;
+
+		/**
+		 * @brief Make the meshes whose stream was cooked since the last call
+		 */
+		void			Update() noexcept;
+
+		#pragma endregion
+	};
+}
+
+#endif // __COLLISIONMESHCACHE_H__
@@ -0,0 +1,188 @@
+#ifndef __CONTROLLERCROWD_H__
+#define __CONTROLLERCROWD_H__
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// Side of the square cells the moving controllers are sorted in, on the x and z axes
+#define CROWD_CELL_SIZE 8.f
+// Cells moved per job
+#define CROWD_CELL_GRAIN 4
+// Objects written back per job
+#define CROWD_WRITE_GRAIN 256
+// Growth of the volume a controller reads around its move, the default volumeGrowth of PxControllerDesc
+#define CROWD_VOLUME_GROWTH 1.5f
+// Handle of a controller out of the crowd
+#define CROWD_INVALID_AGENT 0xFFFFFFFF
+
+namespace Quantix::Core::DataStructure
+{
+	class GameObject3D;
+}
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Character controllers of the scene, their moves are gathered during the frame and run together. The
+	 * moving controllers are sorted in cells and the cells are moved in four passes, two cells of a pass are one
+	 * cell apart so their controllers never read each other: each cell is moved on one worker. A controller reaching
+	 * further than half a cell is moved alone before the passes
+	 */
+	class QUANTIX_API ControllerCrowd
+	{
+	private:
+		#pragma region Attributes
+
+		struct Agent
+		{
+			physx::PxCapsuleController*			controller;
+			Core::DataStructure::GameObject3D*	object;
+			physx::PxVec3						displacement;
+			physx::PxF32						minDist;
+			physx::PxF32						elapsedTime;
+			physx::PxControllerCollisionFlags	collision;
+			QXbool								pending;
+		};
+
+		// Moving agent and its cell, the two upper bits of the cell are its pass
+		struct Order
+		{
+			physx::PxU64	cell;
+			QXuint			agent;
+		};
+
+		// Indexed by the handles kept on the controllers, the free slots are reused
+		std::vector<Agent>		_agents;
+		std::vector<QXuint>		_free;
+
+		// Agents moved during the frame, and the ones sorted in cells
+		std::vector<QXuint>		_pending;
+		std::vector<Order>		_orders;
+		// First order of each cell, closed by the size of the orders
+		std::vector<QXuint>		_cells;
+
+		QXbool					_parallel { true };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Run the move of an agent and clear it
+		 *
+		 * @param agent agent moved
+		 */
+		void	MoveAgent(Agent& agent) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Controller Crowd object
+		 */
+		ControllerCrowd() = default;
+
+		/**
+		 * @brief Construct a new Controller Crowd object (DELETED)
+		 *
+		 * @param crowd crowd to copy
+		 */
+		ControllerCrowd(const ControllerCrowd& crowd) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Add a controller to the crowd
+		 *
+		 * @param controller controller created by the physic handler
+		 * @param object object following the controller
+		 * @return QXuint handle of the agent
+		 */
+		QXuint	Add(physx::PxCapsuleController* controller, Core::DataStructure::GameObject3D* object) noexcept;
+
+		/**
+		 * @brief Remove a controller from the crowd
+		 *
+		 * @param agent handle of the agent
+		 * @param controller controller of the agent
+		 * @return QXbool false if the controller was not in the crowd anymore
+		 */
+		QXbool	Remove(QXuint agent, physx::PxCapsuleController* controller) noexcept;
+
+		/**
+		 * @brief Ask a move of a controller, run with the moves of the other controllers. The moves asked twice in a
+		 * frame are added up
+		 *
+		 * @param agent handle of the agent
+		 * @param displacement displacement of the controller
+		 * @param minDist minimum distance moved
+		 * @param elapsedTime time of the move
+		 */
+		void	Move(QXuint agent, const physx::PxVec3& displacement, physx::PxF32 minDist, physx::PxF32 elapsedTime) noexcept;
+
+		/**
+		 * @brief Run the moves asked since the last call, the scene must not be simulated meanwhile
+		 */
+		void	Execute() noexcept;
+
+		/**
+		 * @brief Set the position of the controllers on their objects, the objects are written in parallel
+		 */
+		void	WriteTransforms() noexcept;
+
+		/**
+		 * @brief Place the controllers on their objects, moved in the editor
+		 */
+		void	ReadTransforms() noexcept;
+
+		/**
+		 * @brief Remove every agent, their controllers were purged
+		 */
+		void	Clear() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the collisions of the last move of an agent
+		 *
+		 * @param agent handle of the agent
+		 * @return physx::PxControllerCollisionFlags sides of the controller touched
+		 */
+		physx::PxControllerCollisionFlags	GetCollision(QXuint agent) const noexcept;
+
+		/**
+		 * @brief Set if the cells are moved on the workers, or one after the other to compare
+		 *
+		 * @param parallel true to move the cells in parallel
+		 */
+		inline void							SetParallel(QXbool parallel) noexcept { _parallel = parallel; }
+
+		/**
+		 * @brief Are the cells moved on the workers
+		 *
+		 * @return QXbool true if the cells are moved in parallel
+		 */
+		inline QXbool						GetParallel() const noexcept { return _parallel; }
+
+		/**
+		 * @brief Get the number of agents
+		 *
+		 * @return QXsizei controllers in the crowd
+		 */
+		inline QXsizei						GetAgentCount() const noexcept { return _agents.size() - _free.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __CONTROLLERCROWD_H__
@@ -0,0 +1,107 @@
+#ifndef __PHYSICDISPATCHER_H__
+#define __PHYSICDISPATCHER_H__
+
+#include <vector>
+#include <atomic>
+
+#include <PxPhysicsAPI.h>
+#include <task/PxCpuDispatcher.h>
+
+#include <Type.h>
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Dispatcher running the tasks of the PhysX solver on the workers of the job system, the physics shares
+	 * the threads of the engine instead of starting its own. The time spent in the tasks is kept per worker
+	 */
+	class PhysicDispatcher : public physx::PxCpuDispatcher
+	{
+	private:
+		#pragma region Attributes
+
+		// Nanoseconds spent in tasks since the last report, the last slot counts the threads outside the workers
+		std::vector<std::atomic<QXsizei>>	_busy;
+		std::vector<std::atomic<QXsizei>>	_tasks;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Run a task and add its time to the slot of the calling thread
+		 *
+		 * @param task task to run, released once done
+		 */
+		void	Run(physx::PxBaseTask& task) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Physic Dispatcher object, the job system must be started
+		 */
+		PhysicDispatcher() noexcept;
+
+		/**
+		 * @brief Construct a new Physic Dispatcher object (DELETED)
+		 *
+		 * @param dispatcher dispatcher to copy
+		 */
+		PhysicDispatcher(const PhysicDispatcher& dispatcher) = delete;
+
+		/**
+		 * @brief Destroy the Physic Dispatcher object
+		 */
+		~PhysicDispatcher() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Called by PhysX to run a task on a worker
+		 *
+		 * @param task task ready to run
+		 */
+		void			submitTask(physx::PxBaseTask& task) override;
+
+		/**
+		 * @brief Called by PhysX to split its work
+		 *
+		 * @return physx::PxU32 number of workers of the job system
+		 */
+		physx::PxU32	getWorkerCount() const override;
+
+		/**
+		 * @brief Send the time spent by each worker in the tasks to the profiler and restart the count, called once
+		 * the results of a step are fetched
+		 */
+		void			Report() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the time spent in the tasks since the last report
+		 *
+		 * @param worker index of the worker, the worker count for the other threads
+		 * @return QXdouble time in seconds
+		 */
+		inline QXdouble	GetBusyTime(QXsizei worker) const noexcept { return _busy[worker].load(std::memory_order_relaxed) * 1e-9; }
+
+		/**
+		 * @brief Get the number of slots of the busy times
+		 *
+		 * @return QXsizei workers of the job system and the slot of the other threads
+		 */
+		inline QXsizei	GetSlotCount() const noexcept { return _busy.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __PHYSICDISPATCHER_H__
@@ -0,0 +1,207 @@
+#ifndef __PHYSICEVENT_H__
+#define __PHYSICEVENT_H__
+
+#include <vector>
+
+#include <Type.h>
+#include <Vec3.h>
+#include "Core/DLLHeader.h"
+
+// Contact points read per pair to measure its impulse
+#define PHYSIC_EVENT_MAX_POINTS 4
+
+namespace physx
+{
+	class PxShape;
+}
+
+namespace Quantix::Core::DataStructure
+{
+	class GameObject3D;
+}
+
+namespace Quantix::Core::Components
+{
+	struct Behaviour;
+}
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Events raised by the physic, a behaviour subscribes to a mask of them
+	 */
+	enum class QUANTIX_API EPhysicEvent : QXuint
+	{
+		NONE			= 0,
+		CONTACT			= 1 << 0,
+		TRIGGER_ENTER	= 1 << 1,
+		TRIGGER_EXIT	= 1 << 2,
+		ALL				= CONTACT | TRIGGER_ENTER | TRIGGER_EXIT
+	};
+
+	/**
+	 * @brief Event copied out of a step, the shape of the receiver, position, normal and impulse are only set by contacts
+	 */
+	struct QUANTIX_API PhysicEvent
+	{
+		#pragma region Attributes
+
+		Core::DataStructure::GameObject3D*	receiver { nullptr };
+		Core::DataStructure::GameObject3D*	other { nullptr };
+		// Shape of the receiver touched, tells which part of a compound actor was hit
+		physx::PxShape*						shape { nullptr };
+		// Shape of the other object, tells which piece of a compound touched or entered the receiver
+		physx::PxShape*						otherShape { nullptr };
+		Math::QXvec3						position { 0.f, 0.f, 0.f };
+		Math::QXvec3						normal { 0.f, 0.f, 0.f };
+		QXfloat								impulse { 0.f };
+		EPhysicEvent						type { EPhysicEvent::NONE };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Events raised during a step, filled by the simulation callback while PhysX holds the scene and sent to the
+	 * behaviours once the results are fetched. The events are grouped by receiver so the behaviours of an object are
+	 * gathered once per step, the memory is kept from a step to the next
+	 */
+	class QUANTIX_API PhysicEventQueue
+	{
+	private:
+		#pragma region Attributes
+
+		std::vector<PhysicEvent>					_events;
+		std::vector<Core::Components::Behaviour*>	_behaviours;
+
+		QXfloat										_threshold { 0.f };
+		QXbool										_deduplicate { true };
+
+		QXsizei										_dispatched { 0 };
+		QXsizei										_dropped { 0 };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Send the events of one receiver to its behaviours
+		 *
+		 * @param first first event of the receiver
+		 * @param last end of the events of the receiver
+		 */
+		void	DispatchReceiver(QXsizei first, QXsizei last) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Physic Event Queue object
+		 */
+		PhysicEventQueue() = default;
+
+		/**
+		 * @brief Construct a new Physic Event Queue object (DELETED)
+		 *
+		 * @param queue queue to copy
+		 */
+		PhysicEventQueue(const PhysicEventQueue& queue) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Add a contact for both objects of a pair, skipped under the threshold
+		 *
+		 * @param object0 first object of the pair
+		 * @param object1 second object of the pair
+		 * @param shape0 shape of the first object touched
+		 * @param shape1 shape of the second object touched
+		 * @param position position of the first contact point
+		 * @param normal normal of the first contact point
+		 * @param impulse sum of the impulses of the contact points
+		 */
+		void	AddContact(Core::DataStructure::GameObject3D* object0, Core::DataStructure::GameObject3D* object1,
+							physx::PxShape* shape0, physx::PxShape* shape1, const Math::QXvec3& position, const Math::QXvec3& normal, QXfloat impulse) noexcept;
+
+		/**
+		 * @brief Add an event for the object owning a trigger
+		 *
+		 * @param trigger object owning the trigger
+		 * @param other object entering or leaving the trigger
+		 * @param otherShape shape of the object entering or leaving
+		 * @param enter true when the object enters, false when it leaves
+		 */
+		void	AddTrigger(Core::DataStructure::GameObject3D* trigger, Core::DataStructure::GameObject3D* other, physx::PxShape* otherShape, QXbool enter) noexcept;
+
+		/**
+		 * @brief Send every event to the subscribed behaviours then empty the queue, called once the results of a
+		 * step are fetched
+		 */
+		void	Dispatch() noexcept;
+
+		/**
+		 * @brief Remove the events without sending them
+		 */
+		void	Clear() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the impulse under which contacts are skipped
+		 *
+		 * @return QXfloat threshold, 0 keeps every contact
+		 */
+		inline QXfloat	GetThreshold() const noexcept { return _threshold; }
+
+		/**
+		 * @brief Set the impulse under which contacts are skipped
+		 *
+		 * @param threshold threshold, 0 keeps every contact
+		 */
+		inline void		SetThreshold(QXfloat threshold) noexcept { _threshold = threshold; }
+
+		/**
+		 * @brief Get if the events of the same pair and shape in a step are merged
+		 *
+		 * @return QXbool true when only the strongest event of a pair is sent
+		 */
+		inline QXbool	GetDeduplicate() const noexcept { return _deduplicate; }
+
+		/**
+		 * @brief Set if the events of the same pair and shape in a step are merged
+		 *
+		 * @param deduplicate true to only send the strongest event of a pair
+		 */
+		inline void		SetDeduplicate(QXbool deduplicate) noexcept { _deduplicate = deduplicate; }
+
+		/**
+		 * @brief Get the number of events waiting
+		 *
+		 * @return QXsizei events added since the last dispatch
+		 */
+		inline QXsizei	GetEventCount() const noexcept { return _events.size(); }
+
+		/**
+		 * @brief Get the number of events sent by the last dispatch
+		 *
+		 * @return QXsizei events sent, merged events are counted once
+		 */
+		inline QXsizei	GetDispatchedCount() const noexcept { return _dispatched; }
+
+		/**
+		 * @brief Get the number of contacts skipped under the threshold
+		 *
+		 * @return QXsizei contacts skipped since the queue was created
+		 */
+		inline QXsizei	GetDroppedCount() const noexcept { return _dropped; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __PHYSICEVENT_H__
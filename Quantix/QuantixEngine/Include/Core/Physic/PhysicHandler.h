@@ -2,6 +2,8 @@
 #define __PHYSICHANDLER_H__
 
 #include <map>
+#include <vector>
+#include <chrono>
 
 #include <PxPhysicsAPI.h>
 #include <PxActor.h>
@@ -11,9 +13,32 @@
 #include "Core/Physic/PhysicSetting.h"
 #include "Core/Physic/Raycast.h"
 #include "Core/Physic/Joint.h"
+#include "Core/Physic/PhysicDispatcher.h"
+#include "Core/Physic/SceneQuery.h"
+#include "Core/Physic/PhysicEvent.h"
+#include "Core/Physic/VoxelFracture.h"
+#include "Core/Physic/ShapeLibrary.h"
+#include "Core/Physic/CollisionMeshCache.h"
+#include "Core/Physic/ControllerCrowd.h"
+#include "Core/Physic/PhysicRecorder.h"
 
 #include "Core/DataStructure/GameComponent.h"
 
+// Fixed time step of the simulation in seconds
+#define PHYSIC_STEP_SIZE (1.f / 60.f)
+// Steps simulated in one frame at most, the time left after them is dropped so a slow frame does not slow the next ones
+#define PHYSIC_MAX_SUBSTEPS 4
+// Moving bodies written back to their transforms per job
+#define PHYSIC_WRITE_GRAIN 256
+// Port of the PhysX Visual Debugger and the time waited for its connection in milliseconds
+#define PVD_PORT 5425
+#define PVD_TIMEOUT 10
+
+namespace Quantix::Core::Components
+{
+	struct MeshCollider;
+}
+
 namespace Quantix::Core::Physic
 {
 	using namespace physx;
@@ -43,16 +68,94 @@ namespace Quantix::Core::Physic
 		PxDefaultAllocator pDefaultAllocatorCallback;
 		PxFoundation* pDefaultFundation = nullptr;
 		PxPvd* pPvd = nullptr;
-		PxDefaultCpuDispatcher* mCpuDispatcher = nullptr;
+		// Address of the PhysX Visual Debugger, nothing is connected when empty
+		QXstring mPvdHost;
+		PhysicDispatcher* mCpuDispatcher = nullptr;
 		PxScene* mScene = nullptr;
 		PxMaterial* mMaterial = nullptr;
 		PxControllerManager* manager = nullptr;
 		
 		PxReal mAccumulator = 0.0f;
-		PxReal mStepSize = 1/240.f;
+		PxReal mStepSize = PHYSIC_STEP_SIZE;
+		PxU32 mMaxSubsteps = PHYSIC_MAX_SUBSTEPS;
+		PxU32 mStepCount = 0;
+
+		// The last step of a frame runs while the game and the renderer work, it is fetched on the next frame. It starts
+		// before the behaviours, what they change is simulated by the step of the next frame and drawn a frame later
+		// than with a synchronous step
+		QXbool mAsyncSimulation = true;
+		QXbool mSimulating = false;
+		// A step was fetched and its events were not sent yet
+		QXbool mFetched = false;
+		QXbool mInterpolate = true;
+
+		// Queries added during the frame and the ones run at the end of the last frame
+		SceneQueryBatch mQueries[2];
+		QXuint mQueryIndex = 0;
+		QXuint mQueryFrame = 1;
+		QXdouble mQueryTime = 0.0;
+
+		// Contacts and triggers of the step, sent to the behaviours once it is fetched
+		PhysicEventQueue mEvents;
+		QXdouble mEventTime = 0.0;
+
+		// Blocks broken by the impacts of the steps, after the events are sent
+		std::vector<VoxelFracture*> mFractures;
+
+		// Shapes shared by the identical colliders, and the meshes cooked for the mesh colliders
+		ShapeLibrary* mShapes = nullptr;
+		CollisionMeshCache* mCollisionMeshes = nullptr;
+		// Mesh colliders waiting for their mesh before their shape is attached, and the ones attached
+		std::vector<Components::MeshCollider*> mPendingMeshColliders;
+		std::vector<Components::MeshCollider*> mMeshColliders;
+
+		// Character controllers, moved together once per frame
+		ControllerCrowd mCrowd;
+		QXdouble mCrowdTime = 0.0;
+
+		// Capture of the steps, and the start of the step being simulated
+		PhysicRecorder* mRecorder = nullptr;
+		std::chrono::steady_clock::time_point mStepBegin;
 #pragma endregion
 
-		std::map<Core::DataStructure::GameComponent*, IPhysicType*>		_physObject;
+		// Actor of an object and its poses after its last two steps, the object is drawn between them
+		struct PhysicBody
+		{
+			Core::DataStructure::GameObject3D*	object;
+			IPhysicType*						type;
+			PxRigidActor*						actor;
+			PxTransform							previous;
+			PxTransform							current;
+			PxU32								step;
+		};
+
+		// Indexed by the handle kept on the objects
+		std::vector<PhysicBody>		_bodies;
+		// Handles of the bodies moved by the last step, and of the ones which stopped since the last frame
+		std::vector<QXuint>			_moving;
+		std::vector<QXuint>			_settled;
+
+		enum class EBodyChange
+		{
+			ENABLE,
+			DISABLE,
+			TELEPORT,
+			ATTACH,
+			DETACH
+		};
+
+		// Change of a body asked by the game, the shape of a detach is given back to the library once detached
+		struct BodyChange
+		{
+			EBodyChange		type;
+			QXuint			handle;
+			PxRigidActor*	actor;
+			PxShape*		shape;
+			PxTransform		pose;
+		};
+
+		// Changes asked while a step runs, applied once it is fetched
+		std::vector<BodyChange>		_changes;
 
 #pragma region Flag
 		SceneFlag sceneFlag;
@@ -115,6 +218,56 @@ namespace Quantix::Core::Physic
 		 */
 		IPhysicType* GetObject(Core::DataStructure::GameComponent* object, QXbool hasRigidbody = false) noexcept;
 
+		/**
+		 * @brief Find the body of an object from its handle
+		 * 
+		 * @param object GameComponent linked to the body
+		 * @return PhysicBody* body of the object, nullptr without one
+		 */
+		PhysicBody* FindBody(Core::DataStructure::GameComponent* object) noexcept;
+
+		/**
+		 * @brief Link an actor to an object, its body is added or replaced and keeps its handle
+		 * 
+		 * @param object GameComponent linked to the actor
+		 * @param type ActorPhysic created
+		 * @param actor rigid actor of the ActorPhysic
+		 */
+		void LinkBody(Core::DataStructure::GameComponent* object, IPhysicType* type, PxRigidActor* actor) noexcept;
+
+		/**
+		 * @brief Apply a change of a body now, or once the step is fetched if one runs, so the game never waits for it
+		 * 
+		 * @param change change to apply
+		 */
+		void QueueChange(const BodyChange& change) noexcept;
+
+		/**
+		 * @brief Apply a change of a body, skipped when its actor was replaced since it was asked
+		 * 
+		 * @param change change to apply
+		 */
+		void ApplyChange(const BodyChange& change) noexcept;
+
+		/**
+		 * @brief Put the actor of an object in or out of the simulation, a disabled actor stays in the scene and is
+		 * skipped by the query batches. Applied after the step running
+		 * 
+		 * @param object GameComponent linked to the body
+		 * @param enabled true to simulate the actor
+		 */
+		void SetBodyEnabled(Core::DataStructure::GameComponent* object, QXbool enabled) noexcept;
+
+		/**
+		 * @brief Move the actor of an object and its transform, the object is not interpolated from its last pose
+		 * and its velocities are cleared. The transform is moved at once, the actor after the step running
+		 * 
+		 * @param object GameComponent linked to the body
+		 * @param position global position of the object
+		 * @param rotation global rotation of the object
+		 */
+		void TeleportBody(Core::DataStructure::GameComponent* object, const Math::QXvec3& position, const Math::QXquaternion& rotation) noexcept;
+
 		/**
 		 * @brief Create a And Link Actor Physic object
 		 * 
@@ -148,27 +301,79 @@ namespace Quantix::Core::Physic
 		 * 
 		 * @param object GameComponent linked in map
 		 * @param hasRigidbody 
-		 * @return PxShape* New Shape
+		 * @param key key of the collider, its geometry is set to a unit box
+		 * @return PxShape* Shape shared with the identical colliders
 		 */
-		PxShape* CreateCubeCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept;
+		PxShape* CreateCubeCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept;
 
 		/**
 		 * @brief Create a Sphere Collider object
 		 * 
 		 * @param object GameComponent linked in map
 		 * @param hasRigidbody 
-		 * @return PxShape* New Shape
+		 * @param key key of the collider, its geometry is set to a sphere of radius 1
+		 * @return PxShape* Shape shared with the identical colliders
 		 */
-		PxShape* CreateSphereCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept;
+		PxShape* CreateSphereCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept;
 
 		/**
 		 * @brief Create a Capsule Collider object
 		 * 
 		 * @param object GameComponent linked in map
 		 * @param hasRigidbody 
-		 * @return PxShape* New Shape
+		 * @param key key of the collider, its geometry is set to a capsule of radius and half height 1
+		 * @return PxShape* Shape shared with the identical colliders
+		 */
+		PxShape* CreateCapsuleCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept;
+
+		/**
+		 * @brief Attach the shape of a key to the actor of an object
+		 * 
+		 * @param object GameComponent linked in map
+		 * @param hasRigidbody 
+		 * @param key key of the collider, the default material is set when it has none
+		 * @return PxShape* Shape shared with the identical colliders
+		 */
+		PxShape* CreateCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept;
+
+		/**
+		 * @brief Replace the shape of a collider by the shape of its new key, a shared shape can not be changed
+		 * 
+		 * @param object GameComponent linked to the body
+		 * @param shape current shape of the collider
+		 * @param key new key of the collider
+		 * @return PxShape* shape of the key
 		 */
-		PxShape* CreateCapsuleCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept;
+		PxShape* EditCollider(Core::DataStructure::GameComponent* object, PxShape* shape, const ShapeKey& key) noexcept;
+
+		/**
+		 * @brief Detach the shape of a collider from its actor and give it back to the library
+		 * 
+		 * @param object GameComponent linked to the body
+		 * @param shape shape of the collider
+		 */
+		void ReleaseCollider(Core::DataStructure::GameComponent* object, PxShape* shape) noexcept;
+
+		/**
+		 * @brief Attach the shape of a mesh collider once its mesh is cooked, checked each frame
+		 * 
+		 * @param collider collider without shape
+		 */
+		void AddMeshCollider(Components::MeshCollider* collider) noexcept;
+
+		/**
+		 * @brief Stop waiting for the mesh of a collider or following its object
+		 * 
+		 * @param collider collider destroyed
+		 */
+		void RemoveMeshCollider(Components::MeshCollider* collider) noexcept;
+
+		/**
+		 * @brief Make the meshes cooked since the last frame and attach the colliders waiting for them, the attached
+		 * colliders follow the scale and the Rigidbody of their object
+		 * 
+		 */
+		void UpdateMeshColliders() noexcept;
 
 		/**
 		 * @brief Create a CharacterController object
@@ -191,12 +396,33 @@ namespace Quantix::Core::Physic
 
 		// Update
 		/**
-		 * @brief Update and simulate System Physic
+		 * @brief Simulate the fixed steps fitting in the accumulated time, mMaxSubsteps at most. The last step is
+		 * left running when the simulation is asynchronous
 		 * 
-		 * @param deltaTime 
+		 * @param deltaTime time of the frame in seconds
 		 */
 		void		UpdateSystem(double deltaTime) noexcept;
 
+		/**
+		 * @brief Wait for the step left running, keep the poses of the actors it moved and apply the changes of the
+		 * bodies asked while it ran. Its events wait for DispatchEvents
+		 * 
+		 */
+		void		FetchSimulation() noexcept;
+
+		/**
+		 * @brief Send the events of the step fetched last to the behaviours and break the blocks it hit, only called
+		 * where no behaviour runs, at the start of the frame and between the steps
+		 * 
+		 */
+		void		DispatchEvents() noexcept;
+
+		/**
+		 * @brief Keep the poses of the actors moved by the step just fetched
+		 * 
+		 */
+		void		RecordPoses() noexcept;
+
 		/**
 		 * @brief Synchronize Physic Actor with GameObject
 		 * 
@@ -204,6 +430,12 @@ namespace Quantix::Core::Physic
 		 */
 		void		UpdatePhysicActor(QXbool isPlaying = false) noexcept;
 
+		/**
+		 * @brief Run the moves of the controllers asked since the last frame
+		 * 
+		 */
+		void MoveControllers() noexcept;
+
 		/**
 		 * @brief Update Actor in playing
 		 * 
@@ -217,7 +449,15 @@ namespace Quantix::Core::Physic
 		void UpdateEditorActor() noexcept;
 
 		/**
-		 * @brief generate a raycast and return the information
+		 * @brief Place the object of a body on a pose of its actor
+		 * 
+		 * @param body body to write back
+		 * @param pose pose of the actor
+		 */
+		void WriteTransform(PhysicBody& body, const PxTransform& pose) noexcept;
+
+		/**
+		 * @brief generate a raycast and return the information, the actors parked out of the simulation are skipped
 		 * 
 		 * @param origin Origin of the raycast
 		 * @param unitDir Direction of the raycast
@@ -227,7 +467,8 @@ namespace Quantix::Core::Physic
 		void Raycast(const Math::QXvec3& origin, const Math::QXvec3& unitDir, QXfloat distMax, Raycast& ownRaycast) noexcept;
 
 		/**
-		 * @brief Generate an overlap of a sphere and return a list of the GameObject who intersect with it
+		 * @brief Generate an overlap of a sphere and return a list of the GameObject who intersect with it, the actors
+		 * parked out of the simulation are skipped
 		 * 
 		 * @param radius Radius of the Overlap Sphere
 		 * @param transform Transform of the Sphere (Position and rotation)
@@ -235,6 +476,134 @@ namespace Quantix::Core::Physic
 		 */
 		std::vector<Core::DataStructure::GameObject3D*> OverlapSphere(QXfloat radius, Physic::Transform3D* transform) noexcept;
 
+		/**
+		 * @brief Run the queries added during the last frame, before the step starts, they become the results read
+		 * during the frame
+		 * 
+		 */
+		void ExecuteQueries() noexcept;
+
+		/**
+		 * @brief Get the batch of the frame, its queries are run at the end of the game update
+		 * 
+		 * @return SceneQueryBatch& queries of the frame
+		 */
+		SceneQueryBatch& GetQueryBatch() noexcept { return mQueries[mQueryIndex]; }
+
+		/**
+		 * @brief Get the batch run at the end of the last frame
+		 * 
+		 * @return const SceneQueryBatch& results read with the ids returned during the last frame
+		 */
+		const SceneQueryBatch& GetQueryResults() const noexcept { return mQueries[1 - mQueryIndex]; }
+
+		/**
+		 * @brief Get the frame of the batch, the results of a query added on frame N are read on frame N + 1
+		 * 
+		 * @return QXuint frame of GetQueryBatch
+		 */
+		QXuint GetQueryFrame() const noexcept { return mQueryFrame; }
+
+		/**
+		 * @brief Get the time spent in the last batch
+		 * 
+		 * @return QXdouble time in seconds
+		 */
+		QXdouble GetQueryTime() const noexcept { return mQueryTime; }
+
+		/**
+		 * @brief Create a block of voxels fractured by the impacts, it is added to the scene as one actor
+		 * 
+		 * @param desc settings of the block, the filter data is set when empty
+		 * @return VoxelFracture* new block, owned by the handler until it is released
+		 */
+		VoxelFracture* CreateFracture(FractureDesc desc) noexcept;
+
+		/**
+		 * @brief Remove a block and its actors
+		 * 
+		 * @param fracture block to release, ignored if the scene was cleaned since its creation
+		 */
+		void ReleaseFracture(VoxelFracture* fracture) noexcept;
+
+		/**
+		 * @brief Get the fractured blocks of the scene
+		 * 
+		 * @return const std::vector<VoxelFracture*>& blocks
+		 */
+		const std::vector<VoxelFracture*>& GetFractures() const noexcept { return mFractures; }
+
+		/**
+		 * @brief Get the queue of the physic events, its threshold and deduplication are set by the game
+		 * 
+		 * @return PhysicEventQueue& events of the step
+		 */
+		PhysicEventQueue& GetEventQueue() noexcept { return mEvents; }
+
+		/**
+		 * @brief Get the time spent sending the events of the last step
+		 * 
+		 * @return QXdouble time in seconds
+		 */
+		QXdouble GetEventTime() const noexcept { return mEventTime; }
+
+		/**
+		 * @brief Get the shapes shared by the colliders
+		 * 
+		 * @return ShapeLibrary& library of the shapes
+		 */
+		ShapeLibrary& GetShapeLibrary() noexcept { return *mShapes; }
+
+		/**
+		 * @brief Get the meshes cooked for the mesh colliders
+		 * 
+		 * @return CollisionMeshCache& cache of the meshes
+		 */
+		CollisionMeshCache& GetCollisionMeshes() noexcept { return *mCollisionMeshes; }
+
+		/**
+		 * @brief Get the character controllers, their moves are run together before the objects follow them
+		 * 
+		 * @return ControllerCrowd& crowd of the controllers
+		 */
+		ControllerCrowd& GetCrowd() noexcept { return mCrowd; }
+
+		/**
+		 * @brief Get the time spent moving the controllers on the last frame
+		 * 
+		 * @return QXdouble time in seconds
+		 */
+		QXdouble GetCrowdTime() const noexcept { return mCrowdTime; }
+
+		/**
+		 * @brief Set the address of the PhysX Visual Debugger connected by InitSystem, nothing is connected by default
+		 * 
+		 * @param host address of the debugger, empty to not connect it
+		 */
+		void SetPvdHost(const QXstring& host) noexcept { mPvdHost = host; }
+
+		/**
+		 * @brief Start writing the steps in a capture, read by a PhysicReplay
+		 * 
+		 * @param filePath path of the capture, replaced if it exists
+		 * @param poses true to keep the poses of the bodies moved by each step
+		 * @return QXbool false if the file could not be created
+		 */
+		QXbool StartRecording(const QXstring& filePath, QXbool poses = QX_TRUE) noexcept;
+
+		/**
+		 * @brief Stop writing the steps and close the capture
+		 * 
+		 */
+		void StopRecording() noexcept;
+
+		/**
+		 * @brief Are the steps written in a capture
+		 * 
+		 * @return QXbool true while recording
+		 */
+		QXbool IsRecording() const noexcept { return mRecorder != nullptr; }
+
 		/**
 		 * @brief Reboot the PxScene
 		 * 
@@ -245,9 +614,10 @@ namespace Quantix::Core::Physic
 		* @brief Remove a controller of the PxScene
 		*
 		* @param controller Controller to remove
+		* @param agent Handle of the controller in the crowd
 		*
 		*/
-		void CleanController(PxCapsuleController* controller) noexcept;
+		void CleanController(PxCapsuleController* controller, QXuint agent) noexcept;
 
 #pragma region Operators
 
@@ -286,6 +656,16 @@ namespace Quantix::Core::Physic
 		QXbool GetFlagMutable()						noexcept	{ return sceneFlag.mutableFlags; }
 		QXbool GetFlagRequireRWLock()				noexcept	{ return sceneFlag.requireRWLock; }
 
+		QXbool GetAsyncSimulation()					noexcept	{ return mAsyncSimulation; }
+		QXbool GetInterpolate()						noexcept	{ return mInterpolate; }
+		PxU32 GetMaxSubsteps()						noexcept	{ return mMaxSubsteps; }
+		PxReal GetStepSize()						noexcept	{ return mStepSize; }
+
+		void SetAsyncSimulation(QXbool b)				noexcept	{ FetchSimulation(); mAsyncSimulation = b; }
+		void SetInterpolate(QXbool b)					noexcept	{ mInterpolate = b; }
+		void SetMaxSubsteps(PxU32 count)				noexcept	{ mMaxSubsteps = count > 0 ? count : 1; }
+		void SetStepSize(PxReal step)					noexcept	{ mStepSize = step; }
+
 		void SetFlagAdaptiveForce(QXbool b)				noexcept;
 		void SetFlagDisableCCDResweep(QXbool b)			noexcept;
 		void SetFlagDisableContactCache(QXbool b)		noexcept;
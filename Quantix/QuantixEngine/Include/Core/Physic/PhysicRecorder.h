@@ -0,0 +1,212 @@
+#ifndef __PHYSICRECORDER_H__
+#define __PHYSICRECORDER_H__
+
+#include <fstream>
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// First bytes of a capture, "QXPR"
+#define PHYSIC_CAPTURE_MAGIC 0x52505851
+// Incremented when the records change, the captures of another version are not read
+#define PHYSIC_CAPTURE_VERSION 1
+
+namespace Quantix::Core::DataStructure
+{
+	class GameObject3D;
+}
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Tag written before each record of a capture
+	 */
+	enum class QUANTIX_API ECaptureRecord : QXuint
+	{
+		STEP = 1,
+		BODY = 2
+	};
+
+	/**
+	 * @brief Start of a capture file
+	 */
+	struct QUANTIX_API PhysicCaptureHeader
+	{
+		#pragma region Attributes
+
+		QXuint	magic { PHYSIC_CAPTURE_MAGIC };
+		QXuint	version { PHYSIC_CAPTURE_VERSION };
+		QXfloat	stepSize { 0.f };
+		// Steps keep the poses of their active bodies
+		QXuint	poses { 0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Timings and statistics of one step, followed in the file by the poses of the bodies it moved. Only 32 bit
+	 * fields so the record is written as it is
+	 */
+	struct QUANTIX_API PhysicStepRecord
+	{
+		#pragma region Attributes
+
+		QXuint	step { 0 };
+
+		// From the simulate call to the fetched results, the part blocked in the fetch, and the time of the solver tasks
+		// summed over the workers, in seconds. The step time of an asynchronous step includes the frame it ran behind,
+		// the spikes are found on the solver time
+		QXfloat	stepTime { 0.f };
+		QXfloat	waitTime { 0.f };
+		QXfloat	solverTime { 0.f };
+
+		// Bodies, and the islands through the awake bodies, their constraints and the partitions of the solver
+		QXuint	dynamicBodies { 0 };
+		QXuint	staticBodies { 0 };
+		QXuint	activeDynamicBodies { 0 };
+		QXuint	activeKinematicBodies { 0 };
+		QXuint	activeConstraints { 0 };
+		QXuint	axisConstraints { 0 };
+		QXuint	partitions { 0 };
+
+		// Broadphase
+		QXuint	broadPhaseAdds { 0 };
+		QXuint	broadPhaseRemoves { 0 };
+		QXuint	newPairs { 0 };
+		QXuint	lostPairs { 0 };
+
+		// Narrowphase, the pairs tested and the ones touching
+		QXuint	contactPairs { 0 };
+		QXuint	cacheHits { 0 };
+		QXuint	touchingPairs { 0 };
+		QXuint	newTouches { 0 };
+		QXuint	lostTouches { 0 };
+
+		// Contacts and triggers reported to the behaviours
+		QXuint	events { 0 };
+
+		QXuint	poseCount { 0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Pose of a body after a step, the body is the physic handle of its object
+	 */
+	struct QUANTIX_API PhysicPoseRecord
+	{
+		#pragma region Attributes
+
+		QXuint	body { 0 };
+		QXfloat	position[3] { 0.f, 0.f, 0.f };
+		QXfloat	rotation[4] { 0.f, 0.f, 0.f, 1.f };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Write the steps of the simulation in a binary capture, read offline by the PhysicReplay. A step is kept in
+	 * memory until it ends then written at once, the name of a body is written the first time it moves
+	 */
+	class QUANTIX_API PhysicRecorder
+	{
+	private:
+		#pragma region Attributes
+
+		std::ofstream									_stream;
+		QXbool											_poses;
+
+		PhysicStepRecord								_step;
+		std::vector<PhysicPoseRecord>					_stepPoses;
+		std::vector<QXbyte>								_buffer;
+
+		// Object last named for each handle, the handles are reused
+		std::vector<Core::DataStructure::GameObject3D*>	_named;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Add bytes to the step being written
+		 *
+		 * @param data bytes to add
+		 * @param size number of bytes
+		 */
+		void	Append(const void* data, QXsizei size) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Physic Recorder object and write the header of the capture
+		 *
+		 * @param filePath path of the capture, replaced if it exists
+		 * @param stepSize fixed step of the simulation
+		 * @param poses true to keep the poses of the bodies moved by each step
+		 */
+		PhysicRecorder(const QXstring& filePath, QXfloat stepSize, QXbool poses) noexcept;
+
+		/**
+		 * @brief Construct a new Physic Recorder object (DELETED)
+		 *
+		 * @param recorder recorder to copy
+		 */
+		PhysicRecorder(const PhysicRecorder& recorder) = delete;
+
+		/**
+		 * @brief Destroy the Physic Recorder object, the capture is closed
+		 */
+		~PhysicRecorder() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Start the record of a step once its results are fetched
+		 *
+		 * @param scene scene simulated, its statistics are the ones of the step
+		 * @param step index of the step
+		 * @param stepTime time from the simulate call to the fetched results
+		 * @param waitTime time blocked in the fetch
+		 * @param solverTime time of the solver tasks summed over the workers
+		 * @param events contacts and triggers reported by the step
+		 */
+		void	BeginStep(physx::PxScene* scene, QXuint step, QXfloat stepTime, QXfloat waitTime, QXfloat solverTime, QXuint events) noexcept;
+
+		/**
+		 * @brief Add the pose of a body moved by the step
+		 *
+		 * @param body physic handle of the object
+		 * @param object object of the body, named in the capture the first time it moves
+		 * @param pose pose of the actor
+		 */
+		void	AddPose(QXuint body, Core::DataStructure::GameObject3D* object, const physx::PxTransform& pose) noexcept;
+
+		/**
+		 * @brief Write the step and its poses in the capture
+		 */
+		void	EndStep() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Is the capture open
+		 *
+		 * @return QXbool false if the file could not be created
+		 */
+		inline QXbool	IsOpen() const noexcept { return _stream.is_open(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __PHYSICRECORDER_H__
@@ -0,0 +1,121 @@
+#ifndef __PHYSICREPLAY_H__
+#define __PHYSICREPLAY_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Core/Physic/PhysicRecorder.h"
+
+// A step whose solver is slower than this factor of the median one is a spike
+#define PHYSIC_REPLAY_SPIKE_FACTOR 2.f
+// Steps, bodies and cells listed in the summary
+#define PHYSIC_REPLAY_HOT_COUNT 10
+// Side of the cells the poses of the spikes are counted in, on the x and z axes
+#define PHYSIC_REPLAY_CELL_SIZE 4.f
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Capture written by a PhysicRecorder, read without the engine running. The summary lists the steps with the
+	 * longest solver and their statistics, and the bodies and places moving during the spikes; the heat map draws where
+	 * the bodies moved seen from above, weighted by the solver time of their steps. The step time is only reported, an
+	 * asynchronous step also covers the frame rendered while it ran
+	 */
+	class QUANTIX_API PhysicReplay
+	{
+	private:
+		#pragma region Attributes
+
+		QXstring						_filePath;
+		PhysicCaptureHeader				_header;
+
+		std::vector<PhysicStepRecord>	_steps;
+		// First pose of each step, closed by the size of the poses
+		std::vector<QXuint>				_firstPoses;
+		std::vector<PhysicPoseRecord>	_poses;
+
+		// Last name of each body
+		std::vector<QXstring>			_names;
+
+		// Solver time above which a step is a spike
+		QXfloat							_spikeTime { 0.f };
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Physic Replay object
+		 */
+		PhysicReplay() = default;
+
+		/**
+		 * @brief Construct a new Physic Replay object (DELETED)
+		 *
+		 * @param replay replay to copy
+		 */
+		PhysicReplay(const PhysicReplay& replay) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Read a capture, a capture cut during a step keeps the steps before it
+		 *
+		 * @param filePath path of the capture
+		 * @return QXbool false if the file could not be read or is not a capture of this version
+		 */
+		QXbool	Load(const QXstring& filePath) noexcept;
+
+		/**
+		 * @brief Write the summary of the capture in a JSON file
+		 *
+		 * @param filePath path of the summary
+		 * @return QXbool false if the file could not be written
+		 */
+		QXbool	WriteSummary(const QXstring& filePath) const noexcept;
+
+		/**
+		 * @brief Draw the poses of the capture seen from above in a binary PPM image
+		 *
+		 * @param filePath path of the image
+		 * @param size width and height of the image
+		 * @return QXbool false if the capture has no pose or the file could not be written
+		 */
+		QXbool	WriteHeatMap(const QXstring& filePath, QXuint size) const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the steps of the capture
+		 *
+		 * @return const std::vector<PhysicStepRecord>& steps in their order
+		 */
+		inline const std::vector<PhysicStepRecord>&	GetSteps() const noexcept { return _steps; }
+
+		/**
+		 * @brief Get the poses of a step
+		 *
+		 * @param step index of the step in the capture
+		 * @return const PhysicPoseRecord* first pose of the step, its count is the poseCount of the step
+		 */
+		inline const PhysicPoseRecord*				GetPoses(QXsizei step) const noexcept { return _poses.data() + _firstPoses[step]; }
+
+		/**
+		 * @brief Is a step a spike
+		 *
+		 * @param step step of the capture
+		 * @return QXbool true if its solver is slower than PHYSIC_REPLAY_SPIKE_FACTOR times the median solver time
+		 */
+		inline QXbool								IsSpike(const PhysicStepRecord& step) const noexcept { return step.solverTime > _spikeTime; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __PHYSICREPLAY_H__
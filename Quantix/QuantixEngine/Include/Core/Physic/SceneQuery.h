@@ -0,0 +1,250 @@
+#ifndef __SCENEQUERY_H__
+#define __SCENEQUERY_H__
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include <Type.h>
+#include <Vec3.h>
+#include <Quaternion.h>
+#include "Core/DLLHeader.h"
+
+// Requests run per job
+#define SCENE_QUERY_GRAIN 64
+// Objects kept at most by an overlap
+#define SCENE_QUERY_MAX_TOUCHES 256
+// Layer mask accepting every object
+#define SCENE_QUERY_ALL_LAYERS 0xFFFFFFFF
+
+namespace Quantix::Core::DataStructure
+{
+	class GameObject3D;
+}
+
+namespace Quantix::Core::Physic
+{
+	enum class QUANTIX_API EQueryType
+	{
+		RAYCAST,
+		SWEEP,
+		OVERLAP
+	};
+
+	/**
+	 * @brief Object touched by a query, the position, normal and distance are only set by raycasts and sweeps
+	 */
+	struct QUANTIX_API QueryHit
+	{
+		#pragma region Attributes
+
+		Core::DataStructure::GameObject3D*	object { nullptr };
+		Math::QXvec3						position { 0.f, 0.f, 0.f };
+		Math::QXvec3						normal { 0.f, 0.f, 0.f };
+		QXfloat								distance { 0.f };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Hits of a request, a range of the hit buffer of the batch
+	 */
+	struct QUANTIX_API QueryResult
+	{
+		#pragma region Attributes
+
+		QXuint	first { 0 };
+		QXuint	count { 0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Raycasts, sweeps and overlaps gathered during a frame and run together on the workers of the job
+	 * system. Each request gets an id, its hits are written in a range of one buffer reserved when it is added
+	 * so the jobs never share memory
+	 */
+	class QUANTIX_API SceneQueryBatch
+	{
+	private:
+		#pragma region Attributes
+
+		struct Request
+		{
+			EQueryType				type;
+			physx::PxGeometryHolder	geometry;
+			physx::PxTransform		pose;
+			physx::PxVec3			direction;
+			physx::PxReal			distance;
+			QXuint					layers;
+			QXuint					maxHits;
+		};
+
+		std::vector<Request>		_requests;
+		std::vector<QueryResult>	_results;
+		std::vector<QueryHit>		_hits;
+		QXbool						_executed { false };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Add a request and reserve its hits
+		 *
+		 * @param request request to add
+		 * @return QXuint id of the request
+		 */
+		QXuint	Add(const Request& request) noexcept;
+
+		/**
+		 * @brief Run one request against the scene
+		 *
+		 * @param scene scene of the physic handler
+		 * @param index id of the request
+		 * @param touches memory of the overlap hits of the job
+		 */
+		void	Run(physx::PxScene* scene, QXuint index, physx::PxOverlapHit* touches) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Scene Query Batch object
+		 */
+		SceneQueryBatch() = default;
+
+		/**
+		 * @brief Construct a new Scene Query Batch object (DELETED)
+		 *
+		 * @param batch batch to copy
+		 */
+		SceneQueryBatch(const SceneQueryBatch& batch) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Cast a ray, keeps the closest object
+		 *
+		 * @param origin origin of the ray
+		 * @param unitDir direction of the ray
+		 * @param distMax length of the ray
+		 * @param layers mask of the layers of the objects hit
+		 * @return QXuint id of the request
+		 */
+		QXuint	Raycast(const Math::QXvec3& origin, const Math::QXvec3& unitDir, QXfloat distMax, QXuint layers = SCENE_QUERY_ALL_LAYERS) noexcept;
+
+		/**
+		 * @brief Sweep a sphere, keeps the closest object
+		 *
+		 * @param radius radius of the sphere
+		 * @param origin start of the center of the sphere
+		 * @param unitDir direction of the sweep
+		 * @param distMax length of the sweep
+		 * @param layers mask of the layers of the objects hit
+		 * @return QXuint id of the request
+		 */
+		QXuint	SweepSphere(QXfloat radius, const Math::QXvec3& origin, const Math::QXvec3& unitDir, QXfloat distMax,
+							QXuint layers = SCENE_QUERY_ALL_LAYERS) noexcept;
+
+		/**
+		 * @brief Sweep a box, keeps the closest object
+		 *
+		 * @param halfExtents half size of the box
+		 * @param origin start of the center of the box
+		 * @param rotation rotation of the box
+		 * @param unitDir direction of the sweep
+		 * @param distMax length of the sweep
+		 * @param layers mask of the layers of the objects hit
+		 * @return QXuint id of the request
+		 */
+		QXuint	SweepBox(const Math::QXvec3& halfExtents, const Math::QXvec3& origin, const Math::QXquaternion& rotation,
+							const Math::QXvec3& unitDir, QXfloat distMax, QXuint layers = SCENE_QUERY_ALL_LAYERS) noexcept;
+
+		/**
+		 * @brief Find the objects in a sphere
+		 *
+		 * @param radius radius of the sphere
+		 * @param center center of the sphere
+		 * @param layers mask of the layers of the objects kept
+		 * @param maxHits objects kept at most, SCENE_QUERY_MAX_TOUCHES at most
+		 * @return QXuint id of the request
+		 */
+		QXuint	OverlapSphere(QXfloat radius, const Math::QXvec3& center, QXuint layers = SCENE_QUERY_ALL_LAYERS,
+								QXuint maxHits = SCENE_QUERY_MAX_TOUCHES) noexcept;
+
+		/**
+		 * @brief Find the objects in a box
+		 *
+		 * @param halfExtents half size of the box
+		 * @param center center of the box
+		 * @param rotation rotation of the box
+		 * @param layers mask of the layers of the objects kept
+		 * @param maxHits objects kept at most, SCENE_QUERY_MAX_TOUCHES at most
+		 * @return QXuint id of the request
+		 */
+		QXuint	OverlapBox(const Math::QXvec3& halfExtents, const Math::QXvec3& center, const Math::QXquaternion& rotation,
+							QXuint layers = SCENE_QUERY_ALL_LAYERS, QXuint maxHits = SCENE_QUERY_MAX_TOUCHES) noexcept;
+
+		/**
+		 * @brief Run every request, each job holds a read lock of the scene so no write happens meanwhile
+		 *
+		 * @param scene scene queried
+		 */
+		void	Execute(physx::PxScene* scene) noexcept;
+
+		/**
+		 * @brief Remove every request, the memory is kept for the next frame
+		 */
+		void	Clear() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the hits of a request
+		 *
+		 * @param id id of the request
+		 * @return const QueryHit* first hit, nullptr if the request hit nothing or the batch did not run
+		 */
+		const QueryHit*						GetHits(QXuint id) const noexcept;
+
+		/**
+		 * @brief Get the number of hits of a request
+		 *
+		 * @param id id of the request
+		 * @return QXuint number of hits, 0 if the batch did not run
+		 */
+		QXuint								GetHitCount(QXuint id) const noexcept;
+
+		/**
+		 * @brief Get the results, indexed by the ids of the requests
+		 *
+		 * @return const std::vector<QueryResult>& ranges of the hits
+		 */
+		inline const std::vector<QueryResult>&	GetResults() const noexcept { return _results; }
+
+		/**
+		 * @brief Get the hit buffer shared by the requests
+		 *
+		 * @return const std::vector<QueryHit>& hits
+		 */
+		inline const std::vector<QueryHit>&		GetHitBuffer() const noexcept { return _hits; }
+
+		/**
+		 * @brief Get the number of requests
+		 *
+		 * @return QXsizei requests added since the last clear
+		 */
+		inline QXsizei							GetRequestCount() const noexcept { return _requests.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __SCENEQUERY_H__
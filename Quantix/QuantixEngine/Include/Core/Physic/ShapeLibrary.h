@@ -0,0 +1,140 @@
+#ifndef __SHAPELIBRARY_H__
+#define __SHAPELIBRARY_H__
+
+#include <vector>
+#include <unordered_map>
+
+#include <PxPhysicsAPI.h>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Everything a shape is made of, two colliders with the same key use the same shape
+	 */
+	struct QUANTIX_API ShapeKey
+	{
+		#pragma region Attributes
+
+		physx::PxGeometryType::Enum	type { physx::PxGeometryType::eINVALID };
+		// Half extents of a box, radius of a sphere in x, radius and half height of a capsule in x and y, scale of a mesh
+		physx::PxVec3				size { 1.f, 1.f, 1.f };
+		// Cooked convex or triangle mesh
+		physx::PxBase*				mesh { nullptr };
+		physx::PxMaterial*			material { nullptr };
+
+		physx::PxTransform			localPose { physx::PxIdentity };
+		physx::PxFilterData			filterData;
+		physx::PxShapeFlags			flags { physx::PxShapeFlag::eVISUALIZATION | physx::PxShapeFlag::eSCENE_QUERY_SHAPE | physx::PxShapeFlag::eSIMULATION_SHAPE };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Make the geometry of the key
+		 *
+		 * @return physx::PxGeometryHolder geometry of the type and size of the key
+		 */
+		physx::PxGeometryHolder	GetGeometry() const noexcept;
+
+		/**
+		 * @brief Compare every field of two keys
+		 *
+		 * @param other key to compare
+		 * @return QXbool true if the keys make the same shape
+		 */
+		QXbool					operator==(const ShapeKey& other) const noexcept;
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Hash of the fields of a key
+	 */
+	struct QUANTIX_API ShapeKeyHash
+	{
+		QXsizei operator()(const ShapeKey& key) const noexcept;
+	};
+
+	/**
+	 * @brief Shapes shared by the actors, one per key. Thousands of identical colliders use one shape, so one geometry
+	 * and one material reference, instead of an exclusive shape each. A shared shape can not be changed once attached,
+	 * a collider changing its shape takes the shape of its new key instead
+	 */
+	class QUANTIX_API ShapeLibrary
+	{
+	private:
+		#pragma region Attributes
+
+		struct Entry
+		{
+			physx::PxShape*	shape;
+			QXuint			users;
+		};
+
+		physx::PxPhysics*									_sdk;
+		std::unordered_map<ShapeKey, Entry, ShapeKeyHash>	_entries;
+		std::unordered_map<physx::PxShape*, ShapeKey>		_keys;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Shape Library object
+		 *
+		 * @param sdk physics creating the shapes
+		 */
+		ShapeLibrary(physx::PxPhysics* sdk) noexcept;
+
+		/**
+		 * @brief Construct a new Shape Library object (DELETED)
+		 *
+		 * @param library library to copy
+		 */
+		ShapeLibrary(const ShapeLibrary& library) = delete;
+
+		/**
+		 * @brief Destroy the Shape Library object, release the references of the library on its shapes
+		 */
+		~ShapeLibrary() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Get the shape of a key, it is created for the first user
+		 *
+		 * @param key key of the shape, its material must be set
+		 * @return physx::PxShape* shared shape, nullptr if the geometry is not valid
+		 */
+		physx::PxShape*	Acquire(const ShapeKey& key) noexcept;
+
+		/**
+		 * @brief Give back a shape taken with Acquire, it is released with its last user
+		 *
+		 * @param shape shape of the library
+		 */
+		void			Release(physx::PxShape* shape) noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of shapes
+		 *
+		 * @return QXsizei shapes in use
+		 */
+		inline QXsizei	GetShapeCount() const noexcept { return _entries.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __SHAPELIBRARY_H__
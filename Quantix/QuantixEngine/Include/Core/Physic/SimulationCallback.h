@@ -4,12 +4,21 @@
 #include <PxSimulationEventCallback.h>
 #include <iostream>
 
+#include "Core/Physic/PhysicEvent.h"
+
 using namespace physx;
 
 namespace Quantix::Core::Physic
 {
+	/**
+	 * @brief Copy the events of PhysX into a queue, they are sent to the behaviours once the step is fetched
+	 * 
+	 */
 	class SimulationCallback : public PxSimulationEventCallback
 	{
+	private:
+		PhysicEventQueue*	_events { nullptr };
+
 	public:
 
 #pragma region Constructors
@@ -19,6 +28,13 @@ namespace Quantix::Core::Physic
 		 */
 		SimulationCallback() = default;
 
+		/**
+		 * @brief Construct a new Simulation Callback object
+		 * 
+		 * @param events queue filled with the events of each step
+		 */
+		SimulationCallback(PhysicEventQueue* events);
+
 		/**
 		 * @brief Construct a new Simulation Callback object
 		 * 
@@ -66,7 +82,7 @@ namespace Quantix::Core::Physic
 		void onSleep(PxActor** actors, PxU32 count) override;
 
 		/**
-		 * @brief Function Call when Physic raise a collision
+		 * @brief Function Call when Physic raise a collision, the pairs under the threshold of the queue are skipped
 		 * 
 		 * @param pairHeader header of pairs
 		 * @param pairs List of pairs
@@ -75,7 +91,7 @@ namespace Quantix::Core::Physic
 		void onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs) override;
 
 		/**
-		 * @brief Function call when Physic raise a trigger enter
+		 * @brief Function call when Physic raise a trigger enter or exit
 		 * 
 		 * @param pairs List of pair
 		 * @param count Number of pair in the list
@@ -52,6 +52,8 @@ namespace Quantix::Core::Physic
 
 		Space										_space;
 		QXbool										_globalHasChanged;
+		// Set when the world matrix changes, cleared once the physic actor follows it
+		QXbool										_isDirty { QX_TRUE };
 
 #pragma endregion
 
@@ -282,6 +284,20 @@ namespace Quantix::Core::Physic
 		 */
 		inline Core::DataStructure::GameObject3D* GetObject() const  noexcept { return _gameObject; };
 
+		/**
+		 * @brief Check if the world matrix changed since the physic actor was last placed on it
+		 *
+		 * @return QXbool true if the transform moved
+		 */
+		inline QXbool IsDirty() const noexcept { return _isDirty; };
+
+		/**
+		 * @brief Set the Dirty flag
+		 *
+		 * @param dirty false once the physic actor follows the transform
+		 */
+		inline void SetDirty(QXbool dirty) noexcept { _isDirty = dirty; };
+
 		/**
 		 * @brief Get the Childs object
 		 *
@@ -0,0 +1,236 @@
+#ifndef __VOXELFRACTURE_H__
+#define __VOXELFRACTURE_H__
+
+#include <vector>
+
+#include <PxPhysicsAPI.h>
+
+#include <Type.h>
+#include <Vec3.h>
+#include <Mat4.h>
+#include "Core/DLLHeader.h"
+
+// Voxels placed in the instance transforms by a job
+#define FRACTURE_INSTANCE_GRAIN 512
+// Voxels around a hit whose bonds break at most, in voxels from the hit one
+#define FRACTURE_MAX_RADIUS 3
+// Bonds of a voxel towards its next neighbour on x, y and z
+#define FRACTURE_BOND_X 0x1
+#define FRACTURE_BOND_Y 0x2
+#define FRACTURE_BOND_Z 0x4
+#define FRACTURE_BOND_ALL 0x7
+
+namespace Quantix::Core::Physic
+{
+	class VoxelFracture;
+
+	/**
+	 * @brief Settings of a fractured block
+	 */
+	struct QUANTIX_API FractureDesc
+	{
+		#pragma region Attributes
+
+		QXuint				width { 1 };
+		QXuint				height { 1 };
+		QXuint				depth { 1 };
+
+		Math::QXvec3		voxelSize { 1.f, 1.f, 1.f };
+		// Force of an impact above which the bonds around the voxel hit break
+		QXfloat				breakForce { 1.f };
+		QXfloat				density { 1.f };
+
+		// Pose of the center of the first voxel
+		physx::PxTransform	pose { physx::PxIdentity };
+		// Set on the actors and read back by the physic events
+		void*				userData { nullptr };
+		// Pointer to the block kept by its owner, cleared when the handler releases the block with its scene
+		VoxelFracture**		owner { nullptr };
+
+		physx::PxFilterData	filterData;
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Block of voxels simulated as compound actors. The intact block is one actor with a box shape per voxel,
+	 * the voxels are bonded to their neighbours. An impact stronger than the break force breaks the bonds around the
+	 * voxel hit, the pieces left unconnected are moved to new actors, so the joints and actors of a block only cost
+	 * once it is broken. The shapes keep their pose in the frame of the block whichever actor holds them
+	 */
+	class QUANTIX_API VoxelFracture
+	{
+	private:
+		#pragma region Attributes
+
+		struct Voxel
+		{
+			physx::PxShape*	shape;
+			QXuint			piece;
+			QXuint			bonds;
+		};
+
+		struct Piece
+		{
+			// Null once the piece is released, its voxels are no longer drawn
+			physx::PxRigidDynamic*	actor;
+			physx::PxTransform		pose;
+			std::vector<QXuint>		voxels;
+		};
+
+		struct Impact
+		{
+			physx::PxShape*	shape;
+			QXfloat			impulse;
+		};
+
+		physx::PxPhysics*		_sdk;
+		physx::PxScene*			_scene;
+		FractureDesc			_desc;
+
+		// Indexed by x + y * width + z * width * height
+		std::vector<Voxel>		_voxels;
+		std::vector<Piece>		_pieces;
+		std::vector<Impact>		_impacts;
+
+		// Memory of the splits, kept from a step to the next
+		std::vector<QXuint>		_islands;
+		std::vector<QXuint>		_stack;
+		std::vector<QXuint>		_dirty;
+
+		QXsizei					_brokenBonds { 0 };
+		QXsizei					_releasedPieces { 0 };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Break the bonds of the voxels around a hit voxel
+		 *
+		 * @param voxel index of the voxel hit
+		 * @param radius distance in voxels of the voxels whose bonds break
+		 */
+		void	Break(QXuint voxel, QXuint radius) noexcept;
+
+		/**
+		 * @brief Move the voxels of a piece left unconnected to new actors, the biggest part keeps the actor
+		 *
+		 * @param piece index of the piece
+		 */
+		void	Split(QXuint piece) noexcept;
+
+		/**
+		 * @brief Get the index of the neighbours of a voxel still bonded to it
+		 *
+		 * @param voxel index of the voxel
+		 * @param neighbours written with the neighbours
+		 * @return QXuint number of neighbours, 6 at most
+		 */
+		QXuint	GetBonded(QXuint voxel, QXuint* neighbours) const noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Voxel Fracture object, the block is added to the scene as one actor
+		 *
+		 * @param sdk physics creating the actors and shapes
+		 * @param scene scene of the block
+		 * @param material material of the shapes
+		 * @param desc settings of the block
+		 */
+		VoxelFracture(physx::PxPhysics* sdk, physx::PxScene* scene, physx::PxMaterial* material, const FractureDesc& desc) noexcept;
+
+		/**
+		 * @brief Construct a new Voxel Fracture object (DELETED)
+		 *
+		 * @param fracture fracture to copy
+		 */
+		VoxelFracture(const VoxelFracture& fracture) = delete;
+
+		/**
+		 * @brief Destroy the Voxel Fracture object, its actors and shapes are released
+		 */
+		~VoxelFracture() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Keep an impact on a voxel, applied by the next update
+		 *
+		 * @param shape shape of the voxel hit
+		 * @param impulse impulse of the contact
+		 */
+		void	AddImpact(physx::PxShape* shape, QXfloat impulse) noexcept;
+
+		/**
+		 * @brief Remove the piece holding a voxel from the scene, the other pieces are left as they are
+		 *
+		 * @param shape shape of a voxel of the piece
+		 * @return QXsizei number of pieces still in the scene
+		 */
+		QXsizei	Release(physx::PxShape* shape) noexcept;
+
+		/**
+		 * @brief Apply the impacts of the step and keep the poses of the pieces, called once the step is fetched
+		 *
+		 * @param stepSize duration of the step, turns the impulses into forces
+		 */
+		void	Update(QXfloat stepSize) noexcept;
+
+		/**
+		 * @brief Write the transform of every voxel, the voxels are placed in parallel
+		 *
+		 * @param transforms written with GetVoxelCount transforms
+		 */
+		void	FillInstances(Math::QXmat4* transforms) const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of voxels
+		 *
+		 * @return QXsizei voxels of the block
+		 */
+		inline QXsizei	GetVoxelCount() const noexcept { return _voxels.size(); }
+
+		/**
+		 * @brief Get the number of actors of the block in the scene
+		 *
+		 * @return QXsizei 1 while the block is intact
+		 */
+		inline QXsizei	GetPieceCount() const noexcept { return _pieces.size() - _releasedPieces; }
+
+		/**
+		 * @brief Get the number of bonds broken since the block was created
+		 *
+		 * @return QXsizei bonds broken
+		 */
+		inline QXsizei	GetBrokenBonds() const noexcept { return _brokenBonds; }
+
+		/**
+		 * @brief Get the settings of the block
+		 *
+		 * @return const FractureDesc& settings
+		 */
+		inline const FractureDesc&	GetDesc() const noexcept { return _desc; }
+
+		/**
+		 * @brief Set the force of an impact above which the bonds break
+		 *
+		 * @param force break force
+		 */
+		inline void		SetBreakForce(QXfloat force) noexcept { _desc.breakForce = force; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __VOXELFRACTURE_H__
@@ -2,6 +2,7 @@
 #define __APPLICATION_H__
 
 #include "Core/Render/Renderer.h"
+#include "Core/Render/FramePipeline.h"
 #include "Core/Platform/AppInfo.h"
 #include "Core/DataStructure/ResourcesManager.h"
 #include "Resources/Scene.h"
@@ -23,6 +24,7 @@ namespace Quantix::Core::Platform
 		AppInfo							info;
 		DataStructure::ResourcesManager manager;
 		Render::Renderer 				renderer;
+		Render::FramePipeline			pipeline;
 		Resources::Scene*				scene;
 		Quantix::Resources::Scene*		newScene{ nullptr };
 		QXbool							sceneChange{ false };
@@ -55,7 +57,12 @@ namespace Quantix::Core::Platform
 		#pragma region Functions
 
 		/**
-		 * @brief Run Application
+		 * @brief Start the loading tasks and init the loaded resources, on the render thread
+		 */
+		void UpdateResources() noexcept;
+
+		/**
+		 * @brief Update the scene and the physic, can run on the game thread
 		 */
 		void Update(std::vector<Components::Mesh*>& meshes, std::vector<Components::ICollider*>& colliders,
 			std::vector<Components::Light>& lights, QXbool isPlaying = false) noexcept;
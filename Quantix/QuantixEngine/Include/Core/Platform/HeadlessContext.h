@@ -0,0 +1,99 @@
+#ifndef __HEADLESSCONTEXT_H__
+#define __HEADLESSCONTEXT_H__
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+struct GLFWwindow;
+
+namespace Quantix::Core::Platform
+{
+	/**
+	 * @brief GL 4.5 context without a visible window, used to run the renderer in automated benchmarks. The EGL library
+	 * is loaded at runtime when the machine has one, the context is then created on a surfaceless display (or a pbuffer
+	 * when the display can not be surfaceless) so it works without a display server. Without EGL, or when it can not
+	 * give a desktop GL 4.5 context, the context is created on a hidden GLFW window
+	 */
+	class QUANTIX_API HeadlessContext
+	{
+	private:
+		#pragma region Attributes
+
+		void*		_library { nullptr };
+		void*		_display { nullptr };
+		void*		_context { nullptr };
+		void*		_surface { nullptr };
+
+		GLFWwindow*	_window { nullptr };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Create the context with EGL, what was created is released on failure
+		 *
+		 * @param width width of the pbuffer when the display can not be surfaceless
+		 * @param height height of the pbuffer
+		 * @return QXbool false if EGL is missing or can not create the context
+		 */
+		QXbool	CreateEGL(QXuint width, QXuint height) noexcept;
+
+		/**
+		 * @brief Release the EGL context, surface, display and library
+		 */
+		void	ReleaseEGL() noexcept;
+
+		/**
+		 * @brief Create the context on a hidden GLFW window
+		 *
+		 * @param width width of the window
+		 * @param height height of the window
+		 */
+		void	CreateGLFW(QXuint width, QXuint height);
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Headless Context object, makes the context current and loads GL
+		 *
+		 * @param width width of the default surface, the renderer draws in its own framebuffers
+		 * @param height height of the default surface
+		 */
+		HeadlessContext(QXuint width = 1, QXuint height = 1);
+
+		/**
+		 * @brief Construct a new Headless Context object (DELETED)
+		 *
+		 * @param context context to copy
+		 */
+		HeadlessContext(const HeadlessContext& context) = delete;
+
+		/**
+		 * @brief Destroy the Headless Context object
+		 */
+		~HeadlessContext() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Is the context created with EGL
+		 *
+		 * @return QXbool true without a window, false on the hidden GLFW window
+		 */
+		inline QXbool	IsEGL() const noexcept { return _context != nullptr; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __HEADLESSCONTEXT_H__
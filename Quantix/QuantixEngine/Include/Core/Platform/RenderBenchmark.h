@@ -0,0 +1,239 @@
+#ifndef __RENDERBENCHMARK_H__
+#define __RENDERBENCHMARK_H__
+
+#include <vector>
+#include <ostream>
+
+#include <Type.h>
+#include <Vec3.h>
+#include "Core/DLLHeader.h"
+#include "Core/Platform/Application.h"
+#include "Core/Render/PassTimer.h"
+#include "Core/Components/Camera.h"
+
+// Measured frames by default
+#define BENCHMARK_FRAMES 300
+// Frames drawn before the measures, the caches, pools and driver are warm once they are done
+#define BENCHMARK_WARMUP 30
+// Seconds the scene and its resources have to be ready in before the run fails
+#define BENCHMARK_LOAD_TIMEOUT 60.0
+// Fixed time step of the benchmark, every run updates the scene the same way
+#define BENCHMARK_DELTA_TIME (1.0 / 60.0)
+// Orbit followed by the camera when no path is given
+#define BENCHMARK_ORBIT_RADIUS 15.f
+#define BENCHMARK_ORBIT_HEIGHT 5.f
+
+namespace Quantix::Core::Platform
+{
+	/**
+	 * @brief Key of the camera path, the keys are spread evenly over the measured frames
+	 */
+	struct QUANTIX_API BenchmarkKey
+	{
+		#pragma region Attributes
+
+		Math::QXvec3	position;
+		Math::QXvec3	target;
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Settings of a benchmark run
+	 */
+	struct QUANTIX_API BenchmarkConfig
+	{
+		#pragma region Attributes
+
+		QXstring					scene;
+		QXuint						frames { BENCHMARK_FRAMES };
+		QXuint						warmup { BENCHMARK_WARMUP };
+		QXuint						width { 1280 };
+		QXuint						height { 720 };
+
+		std::vector<BenchmarkKey>	path;
+
+		QXstring					output { "benchmark.json" };
+		// Directory of the frame captures, nothing is captured when empty
+		QXstring					captureDir;
+		// A frame is captured every captureInterval measured frames
+		QXuint						captureInterval { 1 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Draw a scene for a number of frames on a scripted camera path and write the cpu and gpu time of every
+	 * pass of the frame graph in a JSON report, frames can be captured to compare the images between runs. Tools
+	 * derive from it to add objects to the scene, update them each frame and add their measures to the report
+	 */
+	class QUANTIX_API RenderBenchmark
+	{
+	private:
+		#pragma region Attributes
+
+		struct PassStats
+		{
+			QXstring	name;
+			QXuint		count { 0 };
+			QXdouble	cpuTotal { 0.0 };
+			QXdouble	cpuMax { 0.0 };
+			QXdouble	gpuTotal { 0.0 };
+			QXdouble	gpuMax { 0.0 };
+		};
+
+		Render::PassTimer			_timer;
+		Components::Camera			_camera;
+
+		std::vector<PassStats>		_stats;
+		std::vector<QXdouble>		_cpuFrames;
+		std::vector<QXdouble>		_gpuFrames;
+		std::vector<QXdouble>		_wallFrames;
+		std::vector<QXdouble>		_occlusionFrames;
+		std::vector<QXdouble>		_depthOverdraw;
+		std::vector<QXdouble>		_shadedOverdraw;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Load the scene of the config and wait for its resources
+		 *
+		 * @return QXbool false if the scene could not be loaded or was not ready after BENCHMARK_LOAD_TIMEOUT seconds
+		 */
+		QXbool	LoadScene() noexcept;
+
+		/**
+		 * @brief Place the camera on the path
+		 *
+		 * @param frame measured frame
+		 */
+		void	PlaceCamera(QXuint frame) noexcept;
+
+		/**
+		 * @brief Add the timings of the passes of the frame to the stats
+		 *
+		 * @param cpuTime cpu time of the frame on the render thread
+		 * @param wallTime time of the whole frame, game update and physics included
+		 * @param resolved true when the timer read new pass timings this frame
+		 */
+		void	Record(QXdouble cpuTime, QXdouble wallTime, QXbool resolved) noexcept;
+
+		/**
+		 * @brief Write the color of the framebuffer in a binary PPM image
+		 *
+		 * @param buffer framebuffer drawn
+		 * @param frame measured frame
+		 */
+		void	Capture(const Render::RenderFramebuffer& buffer, QXuint frame) noexcept;
+
+		/**
+		 * @brief Write the JSON report
+		 *
+		 * @return QXbool false if the file could not be written
+		 */
+		QXbool	WriteReport() const noexcept;
+
+		#pragma endregion
+
+	protected:
+		#pragma region Attributes
+
+		Application&				_app;
+		BenchmarkConfig				_config;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Add objects to the loaded scene, their resources are loaded before the first frame
+		 */
+		virtual void	Populate() noexcept {}
+
+		/**
+		 * @brief Called once the scene is ready, before the first frame
+		 */
+		virtual void	Start() noexcept {}
+
+		/**
+		 * @brief Update the objects of the benchmark at the start of the game update of a frame
+		 *
+		 * @param frame frame of the run, warmup included
+		 * @param measured true if the frame is measured
+		 * @return QXbool true to play the scene, its behaviours and physics run
+		 */
+		virtual QXbool	Step(QXuint frame, QXbool measured) noexcept { return false; }
+
+		/**
+		 * @brief Add the measures of the benchmark of a measured frame
+		 */
+		virtual void	Sample() noexcept {}
+
+		/**
+		 * @brief Called after the last frame, before the report is written
+		 */
+		virtual void	Stop() noexcept {}
+
+		/**
+		 * @brief Write the sections of the report added by the benchmark, each one is followed by a comma
+		 *
+		 * @param stream stream of the report
+		 */
+		virtual void	WriteSections(std::ostream& stream) const noexcept {}
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Render Benchmark object
+		 *
+		 * @param app application to draw, its GL context must be current
+		 * @param config settings of the run
+		 */
+		RenderBenchmark(Application& app, const BenchmarkConfig& config) noexcept;
+
+		/**
+		 * @brief Construct a new Render Benchmark object (DELETED)
+		 *
+		 * @param benchmark benchmark to copy
+		 */
+		RenderBenchmark(const RenderBenchmark& benchmark) = delete;
+
+		/**
+		 * @brief Destroy the Render Benchmark object
+		 */
+		virtual ~RenderBenchmark() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Draw the warmup and measured frames then write the report
+		 *
+		 * @return QXbool true if the run completed and the report was written
+		 */
+		QXbool	Run() noexcept;
+
+		#pragma region Static
+
+		/**
+		 * @brief Read a camera path, one key per line written as "px py pz tx ty tz"
+		 *
+		 * @param filePath path of the file
+		 * @param path keys read
+		 * @return QXbool false if the file could not be read
+		 */
+		static QXbool	LoadPath(const QXstring& filePath, std::vector<BenchmarkKey>& path) noexcept;
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __RENDERBENCHMARK_H__
@@ -0,0 +1,203 @@
+#ifndef __GPUPROFILER_H__
+#define __GPUPROFILER_H__
+
+#include <vector>
+#include <chrono>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// Frames of queries in flight, the results of a frame are read this many frames later
+#define GPU_PROFILER_FRAMES 3
+
+namespace Quantix::Core::Profiling
+{
+	/**
+	 * @brief Times and primitives of a scope, primitives are only counted by the outermost scopes
+	 */
+	struct QUANTIX_API GPUTiming
+	{
+		#pragma region Attributes
+
+		QXstring	name;
+		QXuint		view { 0 };
+		QXdouble	cpuTime { 0.0 };
+		QXdouble	gpuTime { 0.0 };
+		QXsizei	primitives { 0 };
+		QXuint		depth { 0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Measure scopes of the render thread on the gpu with timestamp queries, the outermost scopes also count
+	 * the primitives generated. Scopes are recorded only while the profiler is active or a client reads them, and
+	 * are read a few frames later. The whole frame is always measured. Scopes are kept per view, the profiler gets
+	 * the sum of the views next to the cpu scopes of the same name
+	 */
+	class QUANTIX_API GPUProfiler
+	{
+	private:
+		#pragma region Attributes
+
+		struct Scope
+		{
+			QXstring								name;
+			QXuint									view { 0 };
+			QXuint									timestamps[2] { 0 };
+			QXuint									primitives { 0 };
+			QXuint									depth { 0 };
+			std::chrono::steady_clock::time_point	begin;
+			QXdouble								cpuTime { 0.0 };
+		};
+
+		struct Frame
+		{
+			QXuint				timestamps[2] { 0 };
+			std::vector<Scope>	scopes;
+			QXsizei				used { 0 };
+			QXbool				pending { false };
+		};
+
+		Frame					_frames[GPU_PROFILER_FRAMES];
+		QXuint					_current { 0 };
+		QXuint					_view { 0 };
+		QXuint					_clients { 0 };
+		std::vector<QXsizei>	_stack;
+
+		std::vector<GPUTiming>	_timings;
+		QXdouble				_frameTime { 0.0 };
+		QXuint					_resolved { 0 };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Read the queries of a frame and give the results to the profiler, the frame is dropped without waiting
+		 * if the gpu is not done with it
+		 *
+		 * @param frame frame to read
+		 */
+		void	Resolve(Frame& frame) noexcept;
+
+		/**
+		 * @brief Give the timings of the last read frame to the profiler, the scopes of the same name are summed
+		 * over the views
+		 */
+		void	Publish() const noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new GPU Profiler object
+		 */
+		GPUProfiler() = default;
+
+		/**
+		 * @brief Construct a new GPU Profiler object (DELETED)
+		 *
+		 * @param profiler profiler to copy
+		 */
+		GPUProfiler(const GPUProfiler& profiler) = delete;
+
+		/**
+		 * @brief Destroy the GPU Profiler object, the queries are deleted by Release while the context exists
+		 */
+		~GPUProfiler() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Move to the next frame of queries, the oldest frame is read and the frame timestamp is written
+		 */
+		void	BeginFrame() noexcept;
+
+		/**
+		 * @brief Close the frame, its queries are read once the gpu had time to finish it
+		 */
+		void	EndFrame() noexcept;
+
+		/**
+		 * @brief Delete the queries, called before the GL context is destroyed
+		 */
+		void	Release() noexcept;
+
+		/**
+		 * @brief Set the view the next scopes belong to, the views of a frame run the same passes
+		 *
+		 * @param view index of the view, reset to 0 at the start of the frame
+		 */
+		inline void	SetView(QXuint view) noexcept { _view = view; }
+
+		/**
+		 * @brief Record the scopes even while the profiler is not active, until the client is removed
+		 */
+		inline void	AddClient() noexcept { ++_clients; }
+
+		/**
+		 * @brief Remove a client added by AddClient
+		 */
+		inline void	RemoveClient() noexcept { --_clients; }
+
+		/**
+		 * @brief Start a scope, scopes can be nested
+		 *
+		 * @param name name of the scope, same as the cpu scope to show them together
+		 */
+		void	StartProfiling(const QXstring& name) noexcept;
+
+		/**
+		 * @brief Stop the scope started last
+		 */
+		void	StopProfiling() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the timings of the last read frame, in the order the scopes started
+		 *
+		 * @return const std::vector<GPUTiming>& timings of the scopes
+		 */
+		inline const std::vector<GPUTiming>&	GetTimings() const noexcept { return _timings; }
+
+		/**
+		 * @brief Get the gpu time of the whole last read frame, measured even when no scope is recorded
+		 *
+		 * @return QXdouble gpu time in seconds
+		 */
+		inline QXdouble							GetFrameTime() const noexcept { return _frameTime; }
+
+		/**
+		 * @brief Get the count of frames read so far, clients compare it to know when new timings are available
+		 *
+		 * @return QXuint frames read
+		 */
+		inline QXuint							GetResolvedFrames() const noexcept { return _resolved; }
+
+		#pragma endregion
+
+		#pragma region Static
+
+		/**
+		 * @brief Get the Instance object, only used by the render thread
+		 *
+		 * @return GPUProfiler* gpu profiler
+		 */
+		static GPUProfiler*	GetInstance() noexcept;
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#define START_GPU_PROFILING(name) Quantix::Core::Profiling::GPUProfiler::GetInstance()->StartProfiling(name)
+#define STOP_GPU_PROFILING() Quantix::Core::Profiling::GPUProfiler::GetInstance()->StopProfiling()
+
+#endif // __GPUPROFILER_H__
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <GLFW/glfw3.h>
+#include <mutex>
 
 #include "Core/Debugger/Logger.h"
 #include "Core/Platform/AppInfo.h"
@@ -27,6 +28,9 @@ namespace Quantix::Core::Profiling
 		QXdouble	timer;
 		QXint		id;
 		QXbool		activate;
+		QXdouble	gpuTimer { 0.0 };
+		QXsizei	primitives { 0 };
+		QXbool		hasGPU { false };
 		#pragma endregion Attributes
 	};
 
@@ -82,6 +86,24 @@ namespace Quantix::Core::Profiling
 		 */
 		void				StopProfiling(const QXstring& type);
 
+		/**
+		 * @brief Set the gpu results of a specific profiling, read a few frames after the cpu scope
+		 * 
+		 * @param type String name of the type of profiling
+		 * @param gpuTime gpu time in seconds
+		 * @param primitives primitives generated, 0 for nested scopes
+		 */
+		void				SetGPUProfiling(const QXstring& type, QXdouble gpuTime, QXsizei primitives);
+
+		/**
+		 * @brief Add the time of a specific profiling measured on another thread, added to the previous ones
+		 * 
+		 * @param type String name of the type of profiling
+		 * @param time time in seconds
+		 * @param msg String message shown under the name
+		 */
+		void				AddProfiling(const QXstring& type, QXdouble time, const QXstring& msg = "");
+
 		#pragma region Accessors
 		/**
 		 * @brief Set the Profiling to format the message
@@ -125,6 +147,8 @@ namespace Quantix::Core::Profiling
 		std::map<QXstring, Info>									_infoProfiling;
 		QXbool														_activateFirst;
 		QXbool														_activate;
+		// Game and render threads profile at the same time
+		std::mutex													_mutex;
 		#pragma endregion Attributes
 	};
 }
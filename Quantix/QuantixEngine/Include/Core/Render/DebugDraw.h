@@ -0,0 +1,251 @@
+#ifndef __DEBUGDRAW_H__
+#define __DEBUGDRAW_H__
+
+#include <vector>
+#include <mutex>
+#include <memory>
+
+#include <Type.h>
+#include <Vec3.h>
+#include <Mat4.h>
+#include "Core/DLLHeader.h"
+
+// Segments of the circles of spheres and capsules
+#define DEBUG_DRAW_SEGMENTS 24
+// Default color of the debug shapes, packed as RGBA bytes
+#define DEBUG_DRAW_COLOR 0xFF0000FF
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Vertex of a debug line, the color is read as normalized RGBA bytes
+	 */
+	struct QUANTIX_API DebugVertex
+	{
+		#pragma region Attributes
+
+		Math::QXvec3	position;
+		QXuint			color;
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Lines accumulated for one frame, unit shapes are placed with a world matrix
+	 */
+	class QUANTIX_API DebugDrawList
+	{
+	private:
+		#pragma region Attributes
+
+		std::vector<DebugVertex>	_vertices;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Add a circle of radius 1 centered on center
+		 *
+		 * @param trs world matrix of the shape
+		 * @param center center of the circle in the shape
+		 * @param axisA first axis of the plane of the circle
+		 * @param axisB second axis of the plane of the circle
+		 * @param color packed color
+		 * @param segments segments drawn, half of them draws an arc
+		 */
+		void	Circle(const Math::QXmat4& trs, const Math::QXvec3& center, const Math::QXvec3& axisA, const Math::QXvec3& axisB,
+						QXuint color, QXuint segments = DEBUG_DRAW_SEGMENTS) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Functions
+
+		/**
+		 * @brief Add a line
+		 *
+		 * @param from start of the line in world space
+		 * @param to end of the line in world space
+		 * @param color packed color
+		 */
+		void	Line(const Math::QXvec3& from, const Math::QXvec3& to, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Add a box of size 1 centered on the origin of the matrix
+		 *
+		 * @param trs world matrix of the box
+		 * @param color packed color
+		 */
+		void	Box(const Math::QXmat4& trs, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Add a sphere of radius 1 centered on the origin of the matrix
+		 *
+		 * @param trs world matrix of the sphere
+		 * @param color packed color
+		 */
+		void	Sphere(const Math::QXmat4& trs, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Add a capsule along the y axis of the matrix
+		 *
+		 * @param trs world matrix of the capsule
+		 * @param radius radius of the capsule
+		 * @param halfHeight half height of the cylinder between the two hemispheres
+		 * @param color packed color
+		 */
+		void	Capsule(const Math::QXmat4& trs, QXfloat radius, QXfloat halfHeight, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Add the lines of another list
+		 *
+		 * @param list list to copy
+		 */
+		void	Append(const DebugDrawList& list) noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Remove every line, the memory is kept for the next frame
+		 */
+		inline void								Clear() noexcept { _vertices.clear(); }
+
+		/**
+		 * @brief Get the vertices, two per line
+		 *
+		 * @return const std::vector<DebugVertex>& vertices
+		 */
+		inline const std::vector<DebugVertex>&	GetVertices() const noexcept { return _vertices; }
+
+		/**
+		 * @brief Check if the list has no line
+		 *
+		 * @return QXbool true if empty
+		 */
+		inline QXbool							IsEmpty() const noexcept { return _vertices.empty(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Immediate mode debug drawing usable from any thread, each thread writes in its own list and the lists
+	 * are gathered in the render snapshot at the end of the game update
+	 */
+	class QUANTIX_API DebugDraw
+	{
+	private:
+		#pragma region Attributes
+
+		struct ThreadList
+		{
+			std::mutex		mutex;
+			DebugDrawList	list;
+		};
+
+		std::mutex									_mutex;
+		std::vector<std::unique_ptr<ThreadList>>	_lists;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Get the list of the calling thread, created on its first call
+		 *
+		 * @return ThreadList& list of the thread
+		 */
+		ThreadList&	GetThreadList() noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Debug Draw object
+		 */
+		DebugDraw() = default;
+
+		/**
+		 * @brief Construct a new Debug Draw object (DELETED)
+		 *
+		 * @param debug debug draw to copy
+		 */
+		DebugDraw(const DebugDraw& debug) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Draw a line during the next frame
+		 *
+		 * @param from start of the line in world space
+		 * @param to end of the line in world space
+		 * @param color packed color
+		 */
+		void	Line(const Math::QXvec3& from, const Math::QXvec3& to, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Draw a box of size 1 during the next frame
+		 *
+		 * @param trs world matrix of the box
+		 * @param color packed color
+		 */
+		void	Box(const Math::QXmat4& trs, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Draw a sphere of radius 1 during the next frame
+		 *
+		 * @param trs world matrix of the sphere
+		 * @param color packed color
+		 */
+		void	Sphere(const Math::QXmat4& trs, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Draw a capsule along the y axis of the matrix during the next frame
+		 *
+		 * @param trs world matrix of the capsule
+		 * @param radius radius of the capsule
+		 * @param halfHeight half height of the cylinder between the two hemispheres
+		 * @param color packed color
+		 */
+		void	Capsule(const Math::QXmat4& trs, QXfloat radius, QXfloat halfHeight, QXuint color = DEBUG_DRAW_COLOR) noexcept;
+
+		/**
+		 * @brief Move the lines of every thread in a list, called once per frame
+		 *
+		 * @param out list receiving the lines, cleared first
+		 */
+		void	Flush(DebugDrawList& out) noexcept;
+
+		#pragma region Static
+
+		/**
+		 * @brief Pack a color in RGBA bytes
+		 *
+		 * @param r red between 0 and 1
+		 * @param g green between 0 and 1
+		 * @param b blue between 0 and 1
+		 * @param a alpha between 0 and 1
+		 * @return QXuint packed color
+		 */
+		static QXuint		Color(QXfloat r, QXfloat g, QXfloat b, QXfloat a = 1.f) noexcept;
+
+		/**
+		 * @brief Get the Instance object
+		 *
+		 * @return DebugDraw* debug draw shared by every thread
+		 */
+		static DebugDraw*	GetInstance() noexcept;
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __DEBUGDRAW_H__
@@ -0,0 +1,119 @@
+#ifndef __DYNAMICRESOLUTION_H__
+#define __DYNAMICRESOLUTION_H__
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// Scales are rounded to this step so the scaled targets are only resized on real load changes
+#define DYNAMIC_RESOLUTION_STEP 0.05f
+// Frame time aimed by default in seconds
+#define DYNAMIC_RESOLUTION_TARGET (1.0 / 60.0)
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Scale the resolution of the scene to keep the gpu frame time on a target, the gpu time is the frame
+	 * time measured by the gpu profiler and a PID controller moves the scale between its bounds
+	 */
+	class QUANTIX_API DynamicResolution
+	{
+	private:
+		#pragma region Attributes
+
+		QXuint		_resolved { 0 };
+
+		QXdouble	_gpuTime { 0.0 };
+		QXfloat		_rawScale { 1.f };
+		QXfloat		_scale { 1.f };
+
+		QXfloat		_integral { 0.f };
+		QXfloat		_previousError { 0.f };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Move the scale from the error of the last measured frame
+		 *
+		 * @param gpuTime gpu time of the frame in seconds
+		 */
+		void	Control(QXdouble gpuTime) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Attributes
+
+		QXbool		enable { false };
+
+		QXdouble	targetTime { DYNAMIC_RESOLUTION_TARGET };
+		QXfloat		minScale { 0.5f };
+		QXfloat		maxScale { 1.f };
+
+		// Gains of the controller on the relative error of the frame time
+		QXfloat		kp { 0.2f };
+		QXfloat		ki { 0.05f };
+		QXfloat		kd { 0.05f };
+
+		#pragma endregion
+
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Dynamic Resolution object
+		 */
+		DynamicResolution() = default;
+
+		/**
+		 * @brief Construct a new Dynamic Resolution object (DELETED)
+		 *
+		 * @param resolution resolution to copy
+		 */
+		DynamicResolution(const DynamicResolution& resolution) = delete;
+
+		/**
+		 * @brief Destroy the Dynamic Resolution object
+		 */
+		~DynamicResolution() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Update the scale when the gpu profiler read a new frame, called after the profiler starts the frame
+		 */
+		void	Update() noexcept;
+
+		/**
+		 * @brief Scale a size, never under one pixel
+		 *
+		 * @param size full size
+		 * @return QXuint scaled size
+		 */
+		QXuint	Apply(QXuint size) const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the scale of the scene
+		 *
+		 * @return QXfloat scale of each axis rounded to the step, 1 when disabled
+		 */
+		inline QXfloat	GetScale() const noexcept { return enable ? _scale : 1.f; }
+
+		/**
+		 * @brief Get the last measured gpu frame time
+		 *
+		 * @return QXdouble gpu time in seconds
+		 */
+		inline QXdouble	GetGPUTime() const noexcept { return _gpuTime; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __DYNAMICRESOLUTION_H__
@@ -0,0 +1,228 @@
+#ifndef __FRAMEGRAPH_H__
+#define __FRAMEGRAPH_H__
+
+#include <functional>
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "RenderTargetPool.h"
+
+namespace Quantix::Core::Render
+{
+	using FrameGraphResource = QXuint;
+
+	/**
+	 * @brief Graph of the passes of a frame, passes declare the targets they read and write so the graph can
+	 * cull the passes with no effect on the outputs and share transient targets between passes and views
+	 */
+	class QUANTIX_API FrameGraph
+	{
+	public:
+		#pragma region Internal Classes
+
+		/**
+		 * @brief Builder given to the setup of a pass to declare its resources
+		 */
+		class QUANTIX_API PassBuilder
+		{
+		private:
+			#pragma region Attributes
+
+			FrameGraph&		_graph;
+			QXsizei			_pass;
+
+			#pragma endregion
+
+		public:
+			#pragma region Constructors
+
+			/**
+			 * @brief Construct a new Pass Builder object
+			 *
+			 * @param graph graph of the pass
+			 * @param pass index of the pass
+			 */
+			PassBuilder(FrameGraph& graph, QXsizei pass) noexcept;
+
+			#pragma endregion
+
+			#pragma region Functions
+
+			/**
+			 * @brief Create a transient target, its memory is taken from the pool only between its first and last use
+			 *
+			 * @param name name of the target
+			 * @param desc description of the target
+			 * @return FrameGraphResource handle of the target
+			 */
+			FrameGraphResource	Create(const QXstring& name, const RenderTargetDesc& desc) noexcept;
+
+			/**
+			 * @brief Declare the pass reads a target
+			 *
+			 * @param resource handle of the target
+			 * @return FrameGraphResource handle of the target
+			 */
+			FrameGraphResource	Read(FrameGraphResource resource) noexcept;
+
+			/**
+			 * @brief Declare the pass writes a target
+			 *
+			 * @param resource handle of the target
+			 * @return FrameGraphResource handle of the target
+			 */
+			FrameGraphResource	Write(FrameGraphResource resource) noexcept;
+
+			/**
+			 * @brief Keep the pass even if nothing reads what it writes
+			 */
+			void				SetSideEffect() noexcept;
+
+			#pragma endregion
+		};
+
+		using SetupFunc = std::function<void(PassBuilder&)>;
+		using ExecuteFunc = std::function<void(const FrameGraph&)>;
+
+		#pragma endregion
+
+	private:
+		#pragma region Internal Classes
+
+		struct ResourceNode
+		{
+			QXstring			name;
+			RenderTarget		target;
+			QXsizei				lastPass { 0 };
+			QXbool				imported { false };
+			QXbool				output { false };
+			QXbool				needed { false };
+		};
+
+		struct PassNode
+		{
+			QXstring							name;
+			std::vector<FrameGraphResource>		creates;
+			std::vector<FrameGraphResource>		reads;
+			std::vector<FrameGraphResource>		writes;
+			ExecuteFunc							execute;
+			QXbool								sideEffect { false };
+			QXbool								culled { false };
+		};
+
+		#pragma endregion
+
+		#pragma region Attributes
+
+		std::vector<ResourceNode>	_resources;
+		std::vector<PassNode>		_passes;
+
+		RenderTargetPool			_pool;
+
+		QXuint						_culledPassCount { 0 };
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Frame Graph object
+		 */
+		FrameGraph() = default;
+
+		/**
+		 * @brief Construct a new Frame Graph object (DELETED)
+		 *
+		 * @param graph graph to copy
+		 */
+		FrameGraph(const FrameGraph& graph) = delete;
+
+		/**
+		 * @brief Destroy the Frame Graph object
+		 */
+		~FrameGraph() = default;
+
+		#pragma endregion
+
+		#pragma region Operators
+
+		/**
+		 * @brief Operator for copy (DELETED)
+		 *
+		 * @param graph graph to copy
+		 * @return FrameGraph& reference to the current graph
+		 */
+		FrameGraph& operator=(const FrameGraph& graph) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Import a target owned outside of the graph
+		 *
+		 * @param name name of the target
+		 * @param target target to import
+		 * @return FrameGraphResource handle of the target
+		 */
+		FrameGraphResource	Import(const QXstring& name, const RenderTarget& target) noexcept;
+
+		/**
+		 * @brief Mark a target as a result of the frame, passes writing it are never culled
+		 *
+		 * @param resource handle of the target
+		 */
+		void				MarkOutput(FrameGraphResource resource) noexcept;
+
+		/**
+		 * @brief Add a pass to the graph
+		 *
+		 * @param name name of the pass, also used for profiling
+		 * @param setup function declaring the resources of the pass, called immediately
+		 * @param execute function doing the rendering of the pass
+		 */
+		void				AddPass(const QXstring& name, const SetupFunc& setup, const ExecuteFunc& execute) noexcept;
+
+		/**
+		 * @brief Cull the passes not contributing to an output and compute the lifetime of transient targets
+		 */
+		void				Compile() noexcept;
+
+		/**
+		 * @brief Execute the remaining passes in order, then reset the graph for the next frame
+		 */
+		void				Execute() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the target of a resource, valid only while the pass using it is executed
+		 *
+		 * @param resource handle of the target
+		 * @return const RenderTarget& target
+		 */
+		inline const RenderTarget&	GetTarget(FrameGraphResource resource) const noexcept { return _resources[resource].target; }
+
+		/**
+		 * @brief Get the Pool object
+		 *
+		 * @return RenderTargetPool& pool of transient targets
+		 */
+		inline RenderTargetPool&	GetPool() noexcept { return _pool; }
+
+		/**
+		 * @brief Get the number of passes culled in the last compiled frame
+		 *
+		 * @return QXuint number of culled passes
+		 */
+		inline QXuint				GetCulledPassCount() const noexcept { return _culledPassCount; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __FRAMEGRAPH_H__
@@ -0,0 +1,177 @@
+#ifndef __FRAMEPIPELINE_H__
+#define __FRAMEPIPELINE_H__
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "RenderSnapshot.h"
+
+// Snapshots owned by the pipeline, one is built by the game thread while the other one is rendered
+#define RENDER_SNAPSHOT_COUNT 2
+// Frames in flight by default, 1 simulates and renders each frame on the render thread
+#define RENDER_PIPELINE_DEPTH 2
+// Number of frames averaged by the frame metrics
+#define FRAME_METRICS_WINDOW 120
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Timings of the pipeline in seconds, only written and read by the render thread
+	 */
+	struct QUANTIX_API FrameMetrics
+	{
+		#pragma region Attributes
+
+		QXdouble	gameTime { 0.0 };
+		QXdouble	renderTime { 0.0 };
+		QXdouble	waitTime { 0.0 };
+		QXdouble	frameTime { 0.0 };
+		QXdouble	latency { 0.0 };
+
+		QXdouble	averageFrameTime { 0.0 };
+		QXdouble	averageLatency { 0.0 };
+		QXdouble	maxLatency { 0.0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Run the game update of the next frame on a game thread while the render thread draws the snapshot
+	 * of the previous one. The thread owning the GL context is the render thread
+	 */
+	class QUANTIX_API FramePipeline
+	{
+	private:
+		#pragma region Attributes
+
+		std::thread									_gameThread;
+		std::mutex									_mutex;
+		std::condition_variable						_condition;
+
+		std::function<void(RenderSnapshot&)>		_job;
+		QXbool										_hasJob { false };
+		QXbool										_pending { false };
+		QXbool										_quit { false };
+
+		RenderSnapshot								_snapshots[RENDER_SNAPSHOT_COUNT];
+		QXuint										_renderIndex { 0 };
+		QXuint										_frame { 0 };
+		QXuint										_depth { RENDER_PIPELINE_DEPTH };
+
+		std::chrono::steady_clock::time_point		_renderBegin;
+		std::chrono::steady_clock::time_point		_lastFrame;
+		std::chrono::steady_clock::time_point		_renderedBegin;
+		QXuint										_renderedFrame { 0 };
+		QXuint										_presentedFrame { 0 };
+
+		QXdouble									_frameTimes[FRAME_METRICS_WINDOW] { 0.0 };
+		QXdouble									_latencies[FRAME_METRICS_WINDOW] { 0.0 };
+		QXuint										_sampleIndex { 0 };
+		QXuint										_sampleCount { 0 };
+
+		// Written by the game thread, copied in the metrics at Sync
+		QXdouble									_gameTime { 0.0 };
+		FrameMetrics								_metrics;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Loop of the game thread, waits for a job and runs it
+		 */
+		void	Run() noexcept;
+
+		/**
+		 * @brief Run a job on the snapshot that is not rendered
+		 *
+		 * @param job game update to run
+		 */
+		void	Execute(const std::function<void(RenderSnapshot&)>& job) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Frame Pipeline object, starts the game thread
+		 */
+		FramePipeline() noexcept;
+
+		/**
+		 * @brief Construct a new Frame Pipeline object (DELETED)
+		 *
+		 * @param pipeline pipeline to copy
+		 */
+		FramePipeline(const FramePipeline& pipeline) = delete;
+
+		/**
+		 * @brief Destroy the Frame Pipeline object, waits for the game thread
+		 */
+		~FramePipeline() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Start the game update of the next frame, on the game thread when the depth is 2 or
+		 * right away otherwise
+		 *
+		 * @param job game update, fills the snapshot it receives
+		 */
+		void					Simulate(std::function<void(RenderSnapshot&)> job) noexcept;
+
+		/**
+		 * @brief Wait for the game update and make its snapshot the one to render, the game time of the metrics
+		 * is updated
+		 */
+		void					Sync() noexcept;
+
+		/**
+		 * @brief Update the metrics once the rendered snapshot is presented
+		 */
+		void					Present() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the snapshot to render, never written by the game thread
+		 *
+		 * @return const RenderSnapshot& snapshot to render
+		 */
+		inline const RenderSnapshot&	GetRenderSnapshot() const noexcept { return _snapshots[_renderIndex]; }
+
+		/**
+		 * @brief Set the number of frames in flight, only called between Sync and Simulate
+		 *
+		 * @param depth 1 or 2
+		 */
+		inline void						SetDepth(QXuint depth) noexcept { _depth = depth < 2 ? 1 : RENDER_SNAPSHOT_COUNT; }
+
+		/**
+		 * @brief Get the number of frames in flight
+		 *
+		 * @return QXuint depth
+		 */
+		inline QXuint					GetDepth() const noexcept { return _depth; }
+
+		/**
+		 * @brief Get the metrics of the last frame, only on the render thread
+		 *
+		 * @return const FrameMetrics& metrics
+		 */
+		inline const FrameMetrics&		GetMetrics() const noexcept { return _metrics; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __FRAMEPIPELINE_H__
@@ -10,6 +10,9 @@ namespace Quantix::Core::Render
 		QXuint FBO = 0;
 		QXuint texture[2];
 		QXuint depthBuffer = 0;
+
+		QXuint width = 0;
+		QXuint height = 0;
 	};
 
 	struct Framebuffer
@@ -19,11 +22,31 @@ namespace Quantix::Core::Render
 		QXuint depthBuffer = 0;
 	};
 
-	struct BlurFramebuffer
+	struct RenderTargetDesc
 	{
-		QXuint FBO[2];
-		QXuint texture[2];
+		QXuint width = 0;
+		QXuint height = 0;
+		QXuint format = 0;
+
+		/**
+		 * @brief Operator == to compare descriptions
+		 * 
+		 * @param other description to compare
+		 * @return true descriptions are equal
+		 * @return false descriptions are not equal
+		 */
+		bool operator==(const RenderTargetDesc& other) const noexcept
+		{
+			return width == other.width && height == other.height && format == other.format;
+		}
+	};
+
+	struct RenderTarget
+	{
+		QXuint				FBO = 0;
+		QXuint				texture = 0;
+		RenderTargetDesc	desc;
 	};
 }
 
-#endif //__FRAMEBUFFERS_H__
\ No newline at end of file
+#endif //__FRAMEBUFFERS_H__
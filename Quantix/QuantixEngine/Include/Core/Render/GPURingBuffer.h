@@ -0,0 +1,157 @@
+#ifndef __GPURINGBUFFER_H__
+#define __GPURINGBUFFER_H__
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// Regions of the ring, the cpu writes one while the gpu reads the others
+#define RING_BUFFER_FRAMES 3
+// Size in bytes of a region when the ring is created, doubled when a frame does not fit
+#define RING_BUFFER_SIZE (1024 * 1024)
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Persistently and coherently mapped buffer sub-allocated linearly each frame. Each frame writes in its own
+	 * region, a region is reused once the fence of the frame that wrote it is signaled
+	 */
+	class QUANTIX_API GPURingBuffer
+	{
+	private:
+		#pragma region Attributes
+
+		QXuint		_id { 0 };
+		QXbyte*		_data { nullptr };
+
+		QXsizei		_regionSize { RING_BUFFER_SIZE };
+		QXsizei		_offset { 0 };
+		QXuint		_region { 0 };
+		QXsizei		_alignment { 256 };
+		QXbool		_overflow { false };
+
+		void*		_fences[RING_BUFFER_FRAMES] { nullptr };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Create and map the buffer
+		 */
+		void	Create() noexcept;
+
+		/**
+		 * @brief Unmap and delete the buffer, waits for the gpu
+		 */
+		void	Release() noexcept;
+
+		/**
+		 * @brief Wait for the gpu to be done with a region
+		 *
+		 * @param region region to wait for
+		 */
+		void	Wait(QXuint region) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new GPU Ring Buffer object (DELETED)
+		 */
+		GPURingBuffer() = delete;
+
+		/**
+		 * @brief Construct a new GPU Ring Buffer object (DELETED)
+		 *
+		 * @param buffer buffer to copy
+		 */
+		GPURingBuffer(const GPURingBuffer& buffer) = delete;
+
+		/**
+		 * @brief Construct a new GPU Ring Buffer object, needs the GL context
+		 *
+		 * @param regionSize size in bytes written each frame
+		 */
+		GPURingBuffer(QXsizei regionSize) noexcept;
+
+		/**
+		 * @brief Destroy the GPU Ring Buffer object
+		 */
+		~GPURingBuffer() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Move to the next region, waits if the gpu still reads it
+		 */
+		void	BeginFrame() noexcept;
+
+		/**
+		 * @brief Fence the region written during the frame
+		 */
+		void	EndFrame() noexcept;
+
+		/**
+		 * @brief Allocate memory in the region of the frame, aligned for uniform and storage buffer ranges
+		 *
+		 * @param size size in bytes
+		 * @param offset offset of the allocation in the buffer
+		 * @return void* mapped memory to write, nullptr if the region is full
+		 */
+		void*	Allocate(QXsizei size, QXuint& offset) noexcept;
+
+		/**
+		 * @brief Copy data in the region of the frame and bind it to a uniform buffer binding
+		 *
+		 * @param index binding of the uniform block
+		 * @param data data to copy
+		 * @param size size in bytes, at least the size of the block
+		 * @return QXbool false if the region is full
+		 */
+		QXbool	BindUniform(QXuint index, const void* data, QXsizei size) noexcept;
+
+		/**
+		 * @brief Bind a range of the buffer to a uniform buffer binding
+		 *
+		 * @param index binding of the uniform block
+		 * @param offset offset returned by Allocate
+		 * @param size size in bytes
+		 */
+		void	BindRange(QXuint index, QXuint offset, QXsizei size) noexcept;
+
+		/**
+		 * @brief Bind a range of the buffer to a shader storage buffer binding
+		 *
+		 * @param index binding of the storage block
+		 * @param offset offset returned by Allocate
+		 * @param size size in bytes
+		 */
+		void	BindStorage(QXuint index, QXuint offset, QXsizei size) noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the buffer
+		 *
+		 * @return QXuint id of the buffer
+		 */
+		inline QXuint	GetId() const noexcept { return _id; }
+
+		/**
+		 * @brief Get the alignment of the allocations
+		 *
+		 * @return QXsizei alignment in bytes of the ranges
+		 */
+		inline QXsizei	GetAlignment() const noexcept { return _alignment; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __GPURINGBUFFER_H__
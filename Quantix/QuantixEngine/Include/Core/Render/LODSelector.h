@@ -0,0 +1,108 @@
+#ifndef __LODSELECTOR_H__
+#define __LODSELECTOR_H__
+
+#include <unordered_map>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "RenderSnapshot.h"
+
+// Part of a screen size threshold a mesh has to cross before changing of level
+#define LOD_HYSTERESIS 0.15f
+// Levels added to the selected level for shadow passes
+#define SHADOW_LOD_BIAS 1
+// Views drawn between two prunes, the meshes not selected during a whole period are forgotten
+#define LOD_PRUNE_PERIOD 120
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Select the level of detail of meshes from their projected size, keeps the level of each mesh
+	 * to avoid popping when a mesh stays around a threshold
+	 */
+	class QUANTIX_API LODSelector
+	{
+	private:
+		#pragma region Attributes
+
+		struct Level
+		{
+			QXuint	lod;
+			// View count when the mesh was last selected
+			QXuint	view;
+		};
+
+		std::unordered_map<const void*, Level>			_currentLODs;
+		QXuint											_view { 0 };
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new LOD Selector object
+		 */
+		LODSelector() = default;
+
+		/**
+		 * @brief Construct a new LOD Selector object
+		 *
+		 * @param selector selector to copy
+		 */
+		LODSelector(const LODSelector& selector) = default;
+
+		/**
+		 * @brief Destroy the LOD Selector object
+		 */
+		~LODSelector() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Compute the projected radius of the bounding sphere of a mesh
+		 *
+		 * @param mesh mesh to use
+		 * @param eye position of the view
+		 * @param projScale vertical scale of the projection (cotangent of half the fov)
+		 * @return QXfloat radius relative to half the height of the view
+		 */
+		static QXfloat	ComputeScreenSize(const RenderMesh& mesh, const Math::QXvec3& eye, QXfloat projScale) noexcept;
+
+		/**
+		 * @brief Get the level to use for a screen size, without hysteresis
+		 *
+		 * @param screenSize projected size of the mesh
+		 * @param lodCount number of levels of the mesh
+		 * @return QXuint level to use
+		 */
+		static QXuint	ComputeLOD(QXfloat screenSize, QXuint lodCount) noexcept;
+
+		/**
+		 * @brief Select the level of a mesh for this view
+		 *
+		 * @param mesh mesh to use
+		 * @param eye position of the view
+		 * @param projScale vertical scale of the projection
+		 * @return QXuint level to draw
+		 */
+		QXuint			Select(const RenderMesh& mesh, const Math::QXvec3& eye, QXfloat projScale) noexcept;
+
+		/**
+		 * @brief End the selection of a view, every LOD_PRUNE_PERIOD views the meshes destroyed or out of the view
+		 * during the whole period are forgotten
+		 */
+		void			Prune() noexcept;
+
+		/**
+		 * @brief Forget the levels of all meshes
+		 */
+		inline void		Clear() noexcept { _currentLODs.clear(); }
+
+		#pragma endregion
+	};
+}
+
+#endif // __LODSELECTOR_H__
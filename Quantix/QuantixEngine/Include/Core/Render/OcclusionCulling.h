@@ -0,0 +1,147 @@
+#ifndef __OCCLUSIONCULLING_H__
+#define __OCCLUSIONCULLING_H__
+
+#include <vector>
+
+#include <Type.h>
+#include <Mat4.h>
+#include "Core/DLLHeader.h"
+#include "RenderSnapshot.h"
+
+// Size of the software depth buffer, width must be a multiple of 8 for the SIMD rows
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 128
+// Size in pixels of a hierarchical-Z tile
+#define OCCLUSION_TILE_SIZE 8
+// Rows of the depth buffer rasterized by each job
+#define OCCLUSION_BAND_HEIGHT 16
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief CPU occlusion culling, the coarsest level of the static meshes in the view is rasterized in a low
+	 * resolution depth buffer and the bounding box of each mesh is tested against a hierarchical-Z of this buffer
+	 */
+	class QUANTIX_API OcclusionCulling
+	{
+	private:
+		#pragma region Internal Classes
+
+		struct ScreenTriangle
+		{
+			QXfloat x[3];
+			QXfloat y[3];
+			QXfloat z[3];
+		};
+
+		#pragma endregion
+
+		#pragma region Attributes
+
+		std::vector<QXfloat>			_depth;
+		std::vector<QXfloat>			_hiZ;
+		std::vector<ScreenTriangle>		_triangles;
+
+		// Clip positions of the vertices of the occluder, only the vertices of its indices are transformed
+		std::vector<QXfloat>			_clip;
+		std::vector<QXuint>				_stamps;
+		QXuint							_stamp { 0 };
+
+		Math::QXmat4					_viewProj;
+
+		QXbool							_useAVX2;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Project the triangles of the coarsest level of an occluder in screen space, skipped when its
+		 * bounding box is out of the view
+		 *
+		 * @param mesh occluder to add
+		 */
+		void	AddOccluder(const RenderMesh& mesh) noexcept;
+
+		/**
+		 * @brief Rasterize the triangles overlapping a band of rows
+		 *
+		 * @param firstRow first row of the band
+		 * @param lastRow row after the last row of the band
+		 */
+		void	RasterizeBand(QXuint firstRow, QXuint lastRow) noexcept;
+
+		/**
+		 * @brief Keep the farthest depth of each tile of the band
+		 *
+		 * @param firstRow first row of the band
+		 * @param lastRow row after the last row of the band
+		 */
+		void	BuildHiZ(QXuint firstRow, QXuint lastRow) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Occlusion Culling object
+		 */
+		OcclusionCulling() noexcept;
+
+		/**
+		 * @brief Construct a new Occlusion Culling object
+		 *
+		 * @param culling culling to copy
+		 */
+		OcclusionCulling(const OcclusionCulling& culling) = default;
+
+		/**
+		 * @brief Destroy the Occlusion Culling object
+		 */
+		~OcclusionCulling() = default;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Rasterize the occluders of a view, static meshes in the view are used as occluders
+		 *
+		 * @param viewProj projection * view matrix of the view
+		 * @param meshes meshes of the scene
+		 */
+		void	Update(const Math::QXmat4& viewProj, const std::vector<RenderMesh>& meshes) noexcept;
+
+		/**
+		 * @brief Test the bounding box of a mesh against the depth of the occluders
+		 *
+		 * @param mesh mesh to test
+		 * @return QXbool true if the mesh can be visible, false if it is hidden or out of the view
+		 */
+		QXbool	IsVisible(const RenderMesh& mesh) const noexcept;
+
+		/**
+		 * @brief Keep only the visible meshes
+		 *
+		 * @param meshes meshes to test
+		 * @param visible output list of visible meshes
+		 */
+		void	Cull(const std::vector<RenderMesh>& meshes, std::vector<const RenderMesh*>& visible) const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the depth buffer
+		 *
+		 * @return const std::vector<QXfloat>& depth of the occluders, 1 where there is none
+		 */
+		inline const std::vector<QXfloat>&	GetDepth() const noexcept { return _depth; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __OCCLUSIONCULLING_H__
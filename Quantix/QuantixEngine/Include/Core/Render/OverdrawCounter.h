@@ -0,0 +1,94 @@
+#ifndef __OVERDRAWCOUNTER_H__
+#define __OVERDRAWCOUNTER_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// Frames in flight, the samples of a frame are read this many frames later
+#define OVERDRAW_QUERIES 4
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Count the samples passing the depth test during a pass with occlusion queries, divided by the pixels of
+	 * the targets it gives the average number of fragments written per pixel
+	 */
+	class QUANTIX_API OverdrawCounter
+	{
+	private:
+		#pragma region Attributes
+
+		struct FrameQueries
+		{
+			std::vector<QXuint>	queries;
+			QXsizei				used { 0 };
+			QXsizei				pixels { 0 };
+			QXbool				pending { false };
+		};
+
+		FrameQueries	_frames[OVERDRAW_QUERIES];
+		QXuint			_current { 0 };
+
+		QXfloat			_overdraw { 0.f };
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Overdraw Counter object
+		 */
+		OverdrawCounter() = default;
+
+		/**
+		 * @brief Construct a new Overdraw Counter object (DELETED)
+		 *
+		 * @param counter counter to copy
+		 */
+		OverdrawCounter(const OverdrawCounter& counter) = delete;
+
+		/**
+		 * @brief Destroy the Overdraw Counter object, deletes the queries
+		 */
+		~OverdrawCounter() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Start counting the samples of a pass, passes can not be nested
+		 *
+		 * @param pixels pixels of the target of the pass
+		 */
+		void	Begin(QXsizei pixels) noexcept;
+
+		/**
+		 * @brief Stop counting the samples of the pass
+		 */
+		void	End() noexcept;
+
+		/**
+		 * @brief End the frame and update the overdraw with the oldest finished frame
+		 */
+		void	EndFrame() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the overdraw of the last measured frame
+		 *
+		 * @return QXfloat fragments per pixel, 0 when nothing was measured
+		 */
+		inline QXfloat	GetOverdraw() const noexcept { return _overdraw; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __OVERDRAWCOUNTER_H__
@@ -0,0 +1,86 @@
+#ifndef __PASSTIMER_H__
+#define __PASSTIMER_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Timings of a pass in seconds
+	 */
+	struct QUANTIX_API PassTiming
+	{
+		#pragma region Attributes
+
+		QXstring	name;
+		QXuint		view { 0 };
+		QXdouble	cpuTime { 0.0 };
+		QXdouble	gpuTime { 0.0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Give the cpu and gpu time of each pass executed by the frame graph, the passes are the outermost scopes
+	 * of the gpu profiler which is kept recording while the timer exists. The timings are a few frames old
+	 */
+	class QUANTIX_API PassTimer
+	{
+	private:
+		#pragma region Attributes
+
+		QXuint						_resolved { 0 };
+		std::vector<PassTiming>		_timings;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Pass Timer object, the gpu profiler records its scopes from now on
+		 */
+		PassTimer() noexcept;
+
+		/**
+		 * @brief Construct a new Pass Timer object (DELETED)
+		 *
+		 * @param timer timer to copy
+		 */
+		PassTimer(const PassTimer& timer) = delete;
+
+		/**
+		 * @brief Destroy the Pass Timer object
+		 */
+		~PassTimer() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Take the timings of the passes of the last frame read by the gpu profiler
+		 *
+		 * @return QXbool true when the profiler read a new frame since the last call
+		 */
+		QXbool	Resolve() noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the timings of the last resolved frame, in the order of execution
+		 *
+		 * @return const std::vector<PassTiming>& timings of the passes
+		 */
+		inline const std::vector<PassTiming>&	GetTimings() const noexcept { return _timings; }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __PASSTIMER_H__
@@ -2,6 +2,7 @@
 #define __BLOOM_H__
 
 #include "PostProcessEffect.h"
+#include "Core/Render/Framebuffers.h"
 
 namespace Quantix::Core::Render::PostProcess
 {
@@ -12,8 +13,8 @@ namespace Quantix::Core::Render::PostProcess
 
 		Resources::ShaderProgram*	_bloomProgram;
 
-		BlurFramebuffer				_blurBuffer;
-		Framebuffer					_bloomBuffer;
+		// Ping-pong targets of the blur, created by the frame graph for the post process pass
+		RenderTarget				_blurBuffer[2];
 
 		QXuint						_VAO;
 
@@ -28,17 +29,6 @@ namespace Quantix::Core::Render::PostProcess
 
 		#pragma endregion
 
-		#pragma region Functions
-
-		/**
-		 * @brief Init buffers for the bloom
-		 * 
-		 * @param info app info
-		 */
-		void Init(QXuint width, QXuint height) noexcept;
-
-		#pragma endregion
-
 	public:
 		#pragma region Constructors
 
@@ -48,9 +38,8 @@ namespace Quantix::Core::Render::PostProcess
 		 * @param blurProgram shader program for blur
 		 * @param bloomProgram shader program for bloom
 		 * @param model model to use
-		 * @param info app info
 		 */
-		Bloom(Resources::ShaderProgram* blurProgram, Resources::ShaderProgram* bloomProgram, Resources::Model* model, Platform::AppInfo& info) noexcept;
+		Bloom(Resources::ShaderProgram* blurProgram, Resources::ShaderProgram* bloomProgram, Resources::Model* model) noexcept;
 
 		/**
 		 * @brief Destroy the Bloom object
@@ -72,7 +61,13 @@ namespace Quantix::Core::Render::PostProcess
 		 */
 		void Render(Platform::AppInfo& info, QXuint sceneTexture, QXuint otherTexture, QXuint FBO) noexcept override;
 
-		void Resize(QXuint width, QXuint height);
+		/**
+		 * @brief Set the ping-pong targets of the blur, they are only valid during the pass rendering the effect
+		 *
+		 * @param first first target of the blur
+		 * @param second second target of the blur
+		 */
+		inline void SetBlurTargets(const RenderTarget& first, const RenderTarget& second) noexcept { _blurBuffer[0] = first; _blurBuffer[1] = second; }
 
 		#pragma endregion
 
@@ -48,6 +48,28 @@ namespace Quantix::Core::Render::PostProcess
 		 */
 		void	Render(Platform::AppInfo & info, QXuint sceneTexture, QXuint otherTexture, QXuint FBO) noexcept override;
 
+		/**
+		 * @brief Effect is merged in the fused post process pass once its texture is ready
+		 * 
+		 * @return QXbool true if the crosshair texture is ready
+		 */
+		QXbool IsFusable() noexcept override { return _crosshairTex->IsReady(); }
+
+		/**
+		 * @brief Get the define enabling the effect in the fused shader
+		 * 
+		 * @return const QXchar* define name
+		 */
+		const QXchar* GetFusedDefine() const noexcept override { return "CROSSHAIR"; }
+
+		/**
+		 * @brief Send the effect data to the fused program
+		 * 
+		 * @param info App info
+		 * @param program fused program in use
+		 */
+		void SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept override;
+
 		#pragma endregion
 
 		CLASS_REGISTRATION(Quantix::Core::Render::PostProcess::PostProcessEffect)
@@ -0,0 +1,89 @@
+#ifndef __POSTPROCESSCOMPOSER_H__
+#define __POSTPROCESSCOMPOSER_H__
+
+#include <vector>
+
+#include "PostProcessEffect.h"
+
+namespace Quantix::Core::DataStructure
+{
+	class ResourcesManager;
+}
+
+namespace Quantix::Core::Render::PostProcess
+{
+	/**
+	 * @brief Run the post process chain, consecutive per-pixel effects are merged in one full screen pass
+	 * with a shader specialized by the defines of the enabled effects
+	 */
+	class PostProcessComposer
+	{
+	private:
+		#pragma region Attributes
+
+		DataStructure::ResourcesManager*							_manager;
+
+		std::vector<PostProcessEffect*>								_fusedEffects;
+
+		QXuint														_VAO;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Render the pending fused effects in one pass
+		 *
+		 * @param info App info
+		 * @param sceneTexture Texture of the scene
+		 * @param FBO FBO to use
+		 */
+		void Flush(Platform::AppInfo& info, QXuint sceneTexture, QXuint FBO) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Post Process Composer object (DELETED)
+		 */
+		PostProcessComposer() = delete;
+
+		/**
+		 * @brief Construct a new Post Process Composer object (DELETED)
+		 *
+		 * @param composer composer to copy
+		 */
+		PostProcessComposer(const PostProcessComposer& composer) = delete;
+
+		/**
+		 * @brief Construct a new Post Process Composer object
+		 *
+		 * @param manager Resources manager which owns the fused programs
+		 */
+		PostProcessComposer(DataStructure::ResourcesManager& manager) noexcept;
+
+		/**
+		 * @brief Destroy the Post Process Composer object
+		 */
+		~PostProcessComposer() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Render the post process chain
+		 *
+		 * @param effects effects to render in order
+		 * @param info App info
+		 * @param buffer Framebuffer of the scene
+		 */
+		void Render(std::vector<PostProcessEffect*>& effects, Platform::AppInfo& info, RenderFramebuffer& buffer) noexcept;
+
+		#pragma endregion
+	};
+}
+
+#endif // __POSTPROCESSCOMPOSER_H__
@@ -97,6 +97,28 @@ namespace Quantix::Core::Render::PostProcess
 		 */
 		virtual void Render(Platform::AppInfo& info, QXuint sceneTexture, QXuint otherTexture, QXuint FBO) noexcept = 0;
 
+		/**
+		 * @brief Can the effect be merged in the fused post process pass (only per-pixel effects)
+		 * 
+		 * @return QXbool true if the effect only reads its own pixel
+		 */
+		virtual QXbool IsFusable() noexcept { return false; }
+
+		/**
+		 * @brief Get the define enabling the effect in the fused shader
+		 * 
+		 * @return const QXchar* define name
+		 */
+		virtual const QXchar* GetFusedDefine() const noexcept { return ""; }
+
+		/**
+		 * @brief Send the effect data to the fused program
+		 * 
+		 * @param info app info
+		 * @param program fused program in use
+		 */
+		virtual void SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept {}
+
 		#pragma endregion
 
 		#pragma region Attributes
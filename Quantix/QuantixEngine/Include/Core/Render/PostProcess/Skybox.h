@@ -2,7 +2,7 @@
 #define __SKYBOX_H__
 
 #include "PostProcessEffect.h"
-#include "Resources/Texture.h"
+#include "Resources/Environment.h"
 
 namespace Quantix::Core::Render::PostProcess
 {
@@ -11,30 +11,12 @@ namespace Quantix::Core::Render::PostProcess
 	private:
 		#pragma region Attributes
 
-		Resources::Texture*			_skyboxTexture;
-		Resources::ShaderProgram*	_cubemapProgram;
-
-		QXuint						_captureFBO;
-		QXuint						_envCubemap;
-
-		QXbool						_isCubemapReady = false;
+		Resources::Environment*		_environment;
 
 		#pragma endregion
 
 		#pragma region Functions
 
-		/**
-		 * @brief Init the data for the skybox rendering
-		 * 
-		 */
-		void Init() noexcept;
-
-		/**
-		 * @brief Do the pass to change hdr texture to cubemap
-		 * 
-		 */
-		void CaptureCubemap() noexcept;
-
 		/**
 		 * @brief Draw a cube
 		 * 
@@ -68,17 +50,16 @@ namespace Quantix::Core::Render::PostProcess
 		/**
 		 * @brief Construct a new Skybox object
 		 * 
-		 * @param cubemapShader Shader to create the cubemap
 		 * @param backgroundProgram Shader to render the cubemap to make the skybox
-		 * @param quadModel Model to use for rendering
-		 * @param skyTexture texture to use for the skybox
+		 * @param model Model to use for rendering
+		 * @param environment baked environment giving the cubemap
 		 */
-		Skybox(Resources::ShaderProgram* cubemapShader, Resources::ShaderProgram* backgroundProgram, Resources::Model* model, Resources::Texture* skyTexture) noexcept;
+		Skybox(Resources::ShaderProgram* backgroundProgram, Resources::Model* model, Resources::Environment* environment) noexcept;
 
 		/**
 		 * @brief Destroy the Skybox object
 		 */
-		~Skybox();
+		~Skybox() = default;
 
 		#pragma endregion
 
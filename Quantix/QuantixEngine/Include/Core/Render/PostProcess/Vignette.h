@@ -48,6 +48,28 @@ namespace Quantix::Core::Render::PostProcess
 		 */
 		void Render(Platform::AppInfo& info, QXuint sceneTexture, QXuint otherTexture, QXuint FBO) noexcept override;
 
+		/**
+		 * @brief Effect is merged in the fused post process pass
+		 * 
+		 * @return QXbool true
+		 */
+		QXbool IsFusable() noexcept override { return true; }
+
+		/**
+		 * @brief Get the define enabling the effect in the fused shader
+		 * 
+		 * @return const QXchar* define name
+		 */
+		const QXchar* GetFusedDefine() const noexcept override { return "VIGNETTE"; }
+
+		/**
+		 * @brief Send the effect data to the fused program
+		 * 
+		 * @param info App info
+		 * @param program fused program in use
+		 */
+		void SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept override;
+
 		#pragma endregion
 
 		CLASS_REGISTRATION(Quantix::Core::Render::PostProcess::PostProcessEffect)
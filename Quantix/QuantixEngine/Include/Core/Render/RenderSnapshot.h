@@ -0,0 +1,175 @@
+#ifndef __RENDERSNAPSHOT_H__
+#define __RENDERSNAPSHOT_H__
+
+#include <vector>
+#include <chrono>
+
+#include <Type.h>
+#include <Mat4.h>
+#include "Core/DLLHeader.h"
+#include "Core/Platform/AppInfo.h"
+#include "Core/Components/Mesh.h"
+#include "Core/Components/Light.h"
+#include "Core/Components/Camera.h"
+#include "Core/Components/Collider.h"
+#include "Core/Components/Sprite.h"
+#include "DebugDraw.h"
+
+// Sprites placed by a job when the snapshot is built
+#define SNAPSHOT_SPRITE_GRAIN 1024
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Copy of the values of a material, the game thread can edit the material while the copy is drawn.
+	 * The material itself is only used for its shader program, which never changes
+	 */
+	struct QUANTIX_API RenderMaterial
+	{
+		#pragma region Attributes
+
+		Resources::Material*	shader { nullptr };
+		Resources::MaterialData	data;
+		Resources::Texture*		diffuse { nullptr };
+		Resources::Texture*		emissive { nullptr };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Copy of an enabled mesh, only resources are shared with the game thread
+	 */
+	struct QUANTIX_API RenderMesh
+	{
+		#pragma region Attributes
+
+		const void*				id { nullptr };
+		Resources::Model*		model { nullptr };
+		QXuint					material { 0 };
+		Math::QXmat4			trs;
+		QXuint					key { 0 };
+		QXuint					shaderID { 0 };
+		QXuint					textureID { 0 };
+		QXbool					isStatic { false };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Copy of a mesh drawn once per instance, its transforms are a range of the instances of the snapshot
+	 */
+	struct QUANTIX_API RenderBatch
+	{
+		#pragma region Attributes
+
+		const void*				id { nullptr };
+		Resources::Model*		model { nullptr };
+		QXuint					material { 0 };
+		QXuint					key { 0 };
+		QXuint					shaderID { 0 };
+		QXuint					textureID { 0 };
+		QXuint					first { 0 };
+		QXuint					count { 0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Copy of an enabled sprite, the corners are in pixels from the bottom left of the view
+	 */
+	struct QUANTIX_API RenderSprite
+	{
+		#pragma region Attributes
+
+		QXfloat					corners[4][2];
+		Resources::Texture*		texture { nullptr };
+		QXuint					color { 0 };
+		QXint					layer { 0 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Copy of a camera
+	 */
+	struct QUANTIX_API RenderView
+	{
+		#pragma region Attributes
+
+		Math::QXmat4			lookAt;
+		Math::QXvec3			position;
+		QXbool					drawSprites { true };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Everything the renderer reads from a frame, built at the end of the game update and never
+	 * modified while it is rendered
+	 */
+	struct QUANTIX_API RenderSnapshot
+	{
+		#pragma region Attributes
+
+		QXuint									frame { 0 };
+		std::chrono::steady_clock::time_point	begin;
+
+		Platform::AppInfo						info;
+
+		std::vector<RenderMaterial>				materials;
+		std::vector<RenderMesh>					meshes;
+		std::vector<RenderBatch>				batches;
+		std::vector<Math::QXmat4>				instances;
+		DebugDrawList							colliders;
+		DebugDrawList							debug;
+		std::vector<Components::Light>			lights;
+		std::vector<RenderSprite>				sprites;
+		std::vector<RenderView>					views;
+
+		QXbool									depthPrepass { false };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Copy the state of the scene, meshes are sorted by key and the debug lines of the frame are
+		 * taken from the debug draw. The mesh of a fractured block becomes a batch of its cubes. Each material
+		 * is copied once, meshes and batches keep its index
+		 *
+		 * @param meshes meshes of the scene
+		 * @param colliders colliders of the scene
+		 * @param lights lights of the scene
+		 * @param appInfo app info
+		 * @param displayColliders build the lines of the colliders, left empty when no view draws them
+		 */
+		void	Build(const std::vector<Components::Mesh*>& meshes, const std::vector<Components::ICollider*>& colliders,
+						const std::vector<Components::Light>& lights, const Platform::AppInfo& appInfo, QXbool displayColliders) noexcept;
+
+		/**
+		 * @brief Copy the sprites of the scene, placed in parallel and sorted by layer then by texture
+		 *
+		 * @param sprites sprites of the scene, their transforms are already updated
+		 */
+		void	BuildSprites(const std::vector<Components::Sprite*>& sprites) noexcept;
+
+		/**
+		 * @brief Add a view to the snapshot
+		 *
+		 * @param cam camera to copy
+		 * @return QXuint index of the view
+		 */
+		QXuint	AddView(Components::Camera* cam) noexcept;
+
+		/**
+		 * @brief Check if the snapshot was built
+		 *
+		 * @return QXbool true once a game update filled it
+		 */
+		inline QXbool	IsValid() const noexcept { return frame != 0; }
+
+		#pragma endregion
+	};
+}
+
+#endif // __RENDERSNAPSHOT_H__
@@ -0,0 +1,145 @@
+#ifndef __RENDERTARGETPOOL_H__
+#define __RENDERTARGETPOOL_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Framebuffers.h"
+
+// Number of pool updates a target can stay unused before being destroyed
+#define RENDER_TARGET_MAX_IDLE 8
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Pool of transient render targets, targets with the same description are reused between passes and views
+	 */
+	class QUANTIX_API RenderTargetPool
+	{
+	private:
+		#pragma region Internal Classes
+
+		struct PoolEntry
+		{
+			RenderTarget	target;
+			QXuint			idleCount { 0 };
+			QXbool			inUse { false };
+		};
+
+		#pragma endregion
+
+		#pragma region Attributes
+
+		std::vector<PoolEntry>	_entries;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Create the texture and framebuffer of a target
+		 * 
+		 * @param desc description of the target
+		 * @return RenderTarget new target
+		 */
+		RenderTarget	CreateTarget(const RenderTargetDesc& desc) noexcept;
+
+		/**
+		 * @brief Delete the texture and framebuffer of a target
+		 * 
+		 * @param target target to destroy
+		 */
+		void			DestroyTarget(RenderTarget& target) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Render Target Pool object
+		 */
+		RenderTargetPool() = default;
+
+		/**
+		 * @brief Construct a new Render Target Pool object (DELETED)
+		 * 
+		 * @param pool pool to copy
+		 */
+		RenderTargetPool(const RenderTargetPool& pool) = delete;
+
+		/**
+		 * @brief Destroy the Render Target Pool object
+		 */
+		~RenderTargetPool() noexcept;
+
+		#pragma endregion
+
+		#pragma region Operators
+
+		/**
+		 * @brief Operator for copy (DELETED)
+		 * 
+		 * @param pool pool to copy
+		 * @return RenderTargetPool& reference to the current pool
+		 */
+		RenderTargetPool& operator=(const RenderTargetPool& pool) = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Get a free target matching the description, create it if none is free
+		 * 
+		 * @param desc description of the target
+		 * @return RenderTarget target to use until it is released
+		 */
+		RenderTarget	Acquire(const RenderTargetDesc& desc) noexcept;
+
+		/**
+		 * @brief Give back a target to the pool
+		 * 
+		 * @param target target to release
+		 */
+		void			Release(const RenderTarget& target) noexcept;
+
+		/**
+		 * @brief Age unused targets and destroy the ones idle for too long (old sizes after a resize)
+		 */
+		void			Update() noexcept;
+
+		/**
+		 * @brief Destroy every target which is not in use
+		 */
+		void			Trim() noexcept;
+
+		/**
+		 * @brief Destroy every target of the pool
+		 */
+		void			Clear() noexcept;
+
+		/**
+		 * @brief Get the memory used by the pool
+		 * 
+		 * @return QXsizei size in bytes
+		 */
+		QXsizei			GetMemoryUsage() const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of targets in the pool
+		 * 
+		 * @return QXsizei number of targets
+		 */
+		inline QXsizei	GetTargetCount() const noexcept { return _entries.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __RENDERTARGETPOOL_H__
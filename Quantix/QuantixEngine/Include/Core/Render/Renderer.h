@@ -9,6 +9,19 @@
 #include "Core/Components/Collider.h"
 #include "PostProcess/Bloom.h"
 #include "PostProcess/ToneMapping.h"
+#include "PostProcess/PostProcessComposer.h"
+#include "FrameGraph.h"
+#include "OcclusionCulling.h"
+#include "LODSelector.h"
+#include "RenderSnapshot.h"
+#include "GPURingBuffer.h"
+#include "TexturePool.h"
+#include "DynamicResolution.h"
+#include "OverdrawCounter.h"
+#include "SpriteAtlas.h"
+
+// Sprites written by a job when the sprite vertices are filled
+#define SPRITE_VERTEX_GRAIN 1024
 
 namespace Quantix::Core::DataStructure
 {
@@ -17,6 +30,29 @@ namespace Quantix::Core::DataStructure
 
 namespace Quantix::Core::Render
 {
+	/**
+	 * @brief Values of a draw in the std140 layout of the Instance uniform block
+	 */
+	struct QUANTIX_API InstanceData
+	{
+		Math::QXmat4	trs;
+		QXuint			materialIndex { 0 };
+		// Index of the first transform of an instanced batch, trs is ignored when instanced
+		QXuint			firstInstance { 0 };
+		QXuint			instanced { 0 };
+		QXuint			padding[1] { 0 };
+	};
+
+	/**
+	 * @brief Vertex of a sprite, the third coordinate of the uv is the page of the atlas, negative without texture
+	 */
+	struct QUANTIX_API SpriteVertex
+	{
+		QXfloat			position[2];
+		QXfloat			uv[3];
+		QXuint			color;
+	};
+
 	class QUANTIX_API Renderer
 	{
 	private:
@@ -25,39 +61,76 @@ namespace Quantix::Core::Render
 		Framebuffer 					_uniShadowBuffer;
 		Framebuffer 					_omniShadowBuffer;
 
-		QXuint							_viewProjMatrixUBO = 0;
 		QXuint							_viewProjShadowMatrixUBO = 0;
-		QXuint							_lightUBO = 0;
+
+		// Camera, lights, materials and transforms written each frame
+		GPURingBuffer					_frameData;
+
+		// Instance blocks of the pass being drawn, reserved in the frame data before its first draw
+		QXbyte*							_instanceBlocks { nullptr };
+		QXuint							_instanceOffset { 0 };
+		QXsizei							_instanceStride { 0 };
+		// Instance block uploaded before each draw when the frame data is full
+		QXuint							_instanceFallback { 0 };
+
+		TexturePool								_texturePool;
+		std::vector<Resources::MaterialData>	_materialData;
 
 		Math::QXmat4 					_projLight;
 
+		FrameGraph						_frameGraph;
+
+		OcclusionCulling						_occlusion;
+		// Time spent culling the views and the shadow casters since the frame began, in seconds
+		QXdouble								_occlusionTime { 0.0 };
+		std::vector<const RenderMesh*>			_visibleMeshes;
+		std::vector<QXuint>						_visibleLODs;
+		std::vector<QXfloat>					_visibleDepths;
+		std::vector<QXuint>						_drawOrder;
+		std::unordered_map<QXuint, LODSelector>	_lodSelectors;
+		std::vector<QXbool>						_visibleShadowCasters;
+		// Cull the point shadow casters with one occlusion pass per face, off by default as it costs six views
+		QXbool									_shadowOcclusion { false };
+
+		// Transforms of the batches of the draw in the frame data
+		QXuint									_batchOffset { 0 };
+		QXsizei									_batchSize { 0 };
+
 		std::vector<PostProcess::PostProcessEffect*>	_effects;
+		PostProcess::PostProcessComposer*				_composer;
+		PostProcess::Bloom*								_bloom;
 
 		Resources::ShaderProgram* _wireFrameProgram;
 		Resources::ShaderProgram* _uniShadowProgram;
 		Resources::ShaderProgram* _omniShadowProgram;
+		Resources::ShaderProgram* _depthProgram;
 
-		Resources::Model* _cube;
-		Resources::Model* _sphere;
-		Resources::Model* _caps;
+		QXuint							_debugVAO = 0;
 
-		QXfloat							_farPlane;
+		// Sprites are read from the frame ring buffer, the indices of the quads are shared by every frame
+		SpriteAtlas						_spriteAtlas;
+		std::vector<SpriteRect>			_spriteRects;
+		Resources::ShaderProgram*		_spriteProgram;
+		QXuint							_spriteVAO = 0;
+		QXuint							_spriteIBO = 0;
+		QXsizei							_spriteCapacity = 0;
 
-		QXbool							_needResize { false };
+		// Scene targets at the scaled resolution, one per output framebuffer
+		DynamicResolution							_dynamicResolution;
+		std::unordered_map<QXuint, RenderFramebuffer>	_scaledBuffers;
+
+		// Samples written by the depth prepass and by the shading of the opaque meshes
+		OverdrawCounter					_depthOverdraw;
+		OverdrawCounter					_shadedOverdraw;
+
+		Resources::Environment*			_environment;
+
+		QXfloat							_farPlane;
 
 		#pragma endregion
 
 		#pragma region Functions
 
-		/**
-		 * @brief Create a Framebuffer object
-		 * 
-		 * @param width Width of the window
-		 * @param height Height of the window
-		 * @param fbo fbo to initialize
-		 */
-		void CreateFramebuffer(QXuint width, QXuint height, Framebuffer& fbo) noexcept;
-
 		/**
 		 * @brief Init the shadow buffer for unidirectionnal light
 		 * 
@@ -84,8 +157,8 @@ namespace Quantix::Core::Render
 		 * @param info app info
 		 * @param lights ligths to use
 		 */
-		void RenderShadows(std::vector<Core::Components::Mesh*> & meshes, Quantix::Core::Platform::AppInfo & info,
-			std::vector<Core::Components::Light> & lights) noexcept;
+		void RenderShadows(const std::vector<RenderMesh>& meshes, Quantix::Core::Platform::AppInfo & info,
+			const std::vector<Core::Components::Light>& lights) noexcept;
 
 		/**
 		 * @brief Draw the shadow pass for point lights
@@ -94,27 +167,119 @@ namespace Quantix::Core::Render
 		 * @param info App info
 		 * @param lights lights to use
 		 */
-		void RenderPointLightsShadows(std::vector<Core::Components::Mesh*>& meshes, Quantix::Core::Platform::AppInfo& info,
-			std::vector<Core::Components::Light>& lights) noexcept;
+		void RenderPointLightsShadows(const std::vector<RenderMesh>& meshes, Quantix::Core::Platform::AppInfo& info,
+			const std::vector<Core::Components::Light>& lights) noexcept;
+
+		/**
+		 * @brief Sort the visible meshes front to back inside each group of meshes sharing a key
+		 * 
+		 * @param position position of the camera
+		 */
+		void SortFrontToBack(const Math::QXvec3& position) noexcept;
+
+		/**
+		 * @brief Copy the transforms of the batches in the frame data, once for the passes of the draw
+		 * 
+		 * @param instances transforms of the batches
+		 * @return QXbool true if the batches can be drawn
+		 */
+		QXbool UploadBatches(const std::vector<Math::QXmat4>& instances) noexcept;
+
+		/**
+		 * @brief Draw the depth of the meshes, the meshes of a model and level are drawn with one instanced draw
+		 * 
+		 * @param meshes meshes to draw
+		 * @param lods level of detail of each mesh
+		 * @param batches batches to draw, one instanced draw each
+		 * @param FBO framebuffer to draw in
+		 * @return QXbool false if the transforms of the meshes did not fit in the frame data, they were not drawn
+		 */
+		QXbool RenderDepth(const std::vector<const RenderMesh*>& meshes, const std::vector<QXuint>& lods, const std::vector<RenderBatch>& batches, QXuint FBO) noexcept;
+
+		/**
+		 * @brief Draw the meshes of the scene
+		 * 
+		 * @param meshes meshes to draw, sorted by key
+		 * @param lods level of detail of each mesh
+		 * @param batches batches to draw after the meshes, one instanced draw each
+		 * @param materials copies of the materials indexed by the meshes and batches
+		 * @param lights lights to use
+		 * @param camera view to use
+		 * @param FBO framebuffer to draw in
+		 * @param depthPrepass the depth is already written, only the visible fragments are shaded
+		 * @param depthComplete the prepass wrote every mesh, without it the depth is tested and written again
+		 */
+		void RenderMeshes(const std::vector<const RenderMesh*>& meshes, const std::vector<QXuint>& lods, const std::vector<RenderBatch>& batches,
+			const std::vector<RenderMaterial>& materials, const std::vector<Core::Components::Light>& lights, const RenderView& camera, QXuint FBO, QXbool depthPrepass, QXbool depthComplete) noexcept;
+
+		/**
+		 * @brief Reserve the instance blocks of a pass in the frame data, before its first draw
+		 * 
+		 * @param count number of draws of the pass
+		 * @param size size in bytes of the block of a draw
+		 */
+		void ReserveInstances(QXsizei count, QXsizei size) noexcept;
+
+		/**
+		 * @brief Write and bind the instance block of a draw, uploaded on its own when the reservation failed
+		 * 
+		 * @param draw index of the draw in the pass
+		 * @param data block of the draw
+		 * @param size size in bytes of the block
+		 */
+		void BindInstance(QXsizei draw, const void* data, QXsizei size) noexcept;
+
+		/**
+		 * @brief Write the materials of the snapshot in the material storage buffer, in the order of their indices
+		 * 
+		 * @param materials copies of the materials
+		 */
+		void UploadMaterials(const std::vector<RenderMaterial>& materials) noexcept;
+
+		/**
+		 * @brief Render debug lines in framebuffer, uploaded and drawn with one draw call
+		 * 
+		 * @param debug lines of the frame
+		 * @param colliders lines of the colliders, nullptr to hide them
+		 */
+		void RenderDebug(const DebugDrawList& debug, const DebugDrawList* colliders) noexcept;
 
 		/**
-		 * @brief Render Colliders in framebuffer
+		 * @brief Draw the sprites over the scene with one draw call, the vertices are written in parallel
 		 * 
-		 * @param colliders colliders to render
+		 * @param sprites sprites of the frame, sorted by layer
+		 * @param width width of the view in pixels
+		 * @param height height of the view in pixels
+		 * @param FBO framebuffer to draw in
 		 */
-		void RenderColliders(std::vector<Components::ICollider*>& colliders) noexcept;
+		void RenderSprites(const std::vector<RenderSprite>& sprites, QXuint width, QXuint height, QXuint FBO) noexcept;
 
 		/**
 		 * @brief send uniform buffers to shader
 		 * 
 		 * @param lights lights to send
 		 * @param info App info
-		 * @param cam camera to send
+		 * @param camera view to send
 		 */
-		void SendUniformBuffer(std::vector<Core::Components::Light>& lights, Core::Platform::AppInfo& info, Components::Camera* cam) noexcept;
+		void SendUniformBuffer(const std::vector<Core::Components::Light>& lights, Core::Platform::AppInfo& info, const RenderView& camera) noexcept;
 
+		/**
+		 * @brief Resize the attachments of a render framebuffer, old attachments are deleted
+		 * 
+		 * @param width new width
+		 * @param height new height
+		 * @param FBO framebuffer to resize
+		 */
 		void ResizeFrameBuffer(QXuint width, QXuint height, RenderFramebuffer& FBO);
 
+		/**
+		 * @brief Upscale the color of the scaled scene in the output framebuffer
+		 * 
+		 * @param source scaled scene
+		 * @param destination framebuffer at full resolution
+		 */
+		void Upscale(const RenderFramebuffer& source, const RenderFramebuffer& destination) noexcept;
+
 		#pragma endregion
 
 	public:
@@ -186,17 +351,26 @@ namespace Quantix::Core::Render
 		void CreateRenderFramebuffer(QXuint width, QXuint height, RenderFramebuffer & fbo) noexcept;
 
 		/**
-		 * @brief Function to draw current scene as a scene
+		 * @brief Start a frame, waits for the gpu to release the region of the ring buffer
+		 */
+		void BeginFrame() noexcept;
+
+		/**
+		 * @brief Draw a view of a frame snapshot, only the snapshot is read from the game state. The scene is drawn at
+		 * the dynamic resolution and upscaled in the buffer
 		 * 
-		 * @param meshes meshes to draw
-		 * @param colliders colliders to draw
-		 * @param lights lights to use
-		 * @param info app info
-		 * @param cam camera to use
+		 * @param snapshot frame to draw
+		 * @param view index of the view of the snapshot
+		 * @param buffer framebuffer to draw in
+		 * @param displayColliders draw the colliders in wireframe
 		 * @return QXuint created texture
 		 */
-		QXuint Draw(std::vector<Core::Components::Mesh*>& meshes, std::vector<Components::ICollider*>& colliders, std::vector<Core::Components::Light>& lights,
-				Quantix::Core::Platform::AppInfo& info, Components::Camera* cam, RenderFramebuffer& buffer, bool displayColliders) noexcept;
+		QXuint Draw(const RenderSnapshot& snapshot, QXuint view, RenderFramebuffer& buffer, bool displayColliders) noexcept;
+
+		/**
+		 * @brief End a frame once every view is drawn, the gpu time of the frame drives the dynamic resolution
+		 */
+		void EndFrame() noexcept;
 
 		void	Resize(QXuint width, QXuint height);
 
@@ -209,6 +383,55 @@ namespace Quantix::Core::Render
 		 */
 		inline std::vector<PostProcess::PostProcessEffect*>& GetEffects() noexcept { return _effects; }
 
+		/**
+		 * @brief Get the Dynamic Resolution object
+		 * 
+		 * @return DynamicResolution& controller of the scene resolution
+		 */
+		inline DynamicResolution& GetDynamicResolution() noexcept { return _dynamicResolution; }
+
+		/**
+		 * @brief Get the Frame Graph object
+		 * 
+		 * @return FrameGraph& graph of the passes of the frame
+		 */
+		inline FrameGraph& GetFrameGraph() noexcept { return _frameGraph; }
+
+		/**
+		 * @brief Get the overdraw of the depth prepass
+		 * 
+		 * @return QXfloat fragments written per pixel, 0 without prepass
+		 */
+		inline QXfloat GetDepthOverdraw() const noexcept { return _depthOverdraw.GetOverdraw(); }
+
+		/**
+		 * @brief Get the overdraw of the opaque meshes
+		 * 
+		 * @return QXfloat fragments shaded per pixel
+		 */
+		inline QXfloat GetShadedOverdraw() const noexcept { return _shadedOverdraw.GetOverdraw(); }
+
+		/**
+		 * @brief Get the time of the occlusion culling of the frame
+		 * 
+		 * @return QXdouble seconds spent rasterizing the occluders and testing the meshes, every view included
+		 */
+		inline QXdouble GetOcclusionTime() const noexcept { return _occlusionTime; }
+
+		/**
+		 * @brief Set the occlusion culling of the point shadow casters
+		 * 
+		 * @param enable true to rasterize the occluders from each face of the light, false to draw every caster
+		 */
+		inline void SetShadowOcclusion(QXbool enable) noexcept { _shadowOcclusion = enable; }
+
+		/**
+		 * @brief Get the occlusion culling of the point shadow casters
+		 * 
+		 * @return QXbool true if the casters are culled from each face of the light
+		 */
+		inline QXbool GetShadowOcclusion() const noexcept { return _shadowOcclusion; }
+
 		#pragma endregion
 
 		#pragma endregion
@@ -0,0 +1,141 @@
+#ifndef __SPRITEATLAS_H__
+#define __SPRITEATLAS_H__
+
+#include <vector>
+#include <unordered_map>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Resources/Texture.h"
+
+// Width and height of a page of the atlas
+#define SPRITE_ATLAS_SIZE 2048
+// Empty pixels around each texture so the filtering does not read the neighbours
+#define SPRITE_ATLAS_PADDING 2
+// Pages of the atlas when it is created, doubled when they are all full
+#define SPRITE_ATLAS_PAGES 2
+// Texture unit of the atlas, after the units of the texture pool
+#define SPRITE_ATLAS_UNIT 13
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Place of a texture in the atlas, page is -1 when the texture is not in the atlas
+	 */
+	struct QUANTIX_API SpriteRect
+	{
+		#pragma region Attributes
+
+		QXfloat	uv[4] { 0.f, 0.f, 0.f, 0.f };
+		QXint	page { -1 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Pack the textures of the sprites in the pages of an atlas at runtime, the pages are the layers of one
+	 * texture array so every sprite is drawn with the atlas bound once. Pages are filled with rows of textures
+	 */
+	class QUANTIX_API SpriteAtlas
+	{
+	private:
+		#pragma region Attributes
+
+		struct Shelf
+		{
+			QXint	y { 0 };
+			QXint	height { 0 };
+			QXint	x { 0 };
+		};
+
+		struct Page
+		{
+			std::vector<Shelf>	shelves;
+			QXint				top { 0 };
+		};
+
+		QXuint									_id { 0 };
+		QXint									_capacity { 0 };
+		std::vector<Page>						_pages;
+		std::unordered_map<QXuint, SpriteRect>	_rects;
+
+		// Framebuffers of the copies, the textures are converted to the format of the atlas
+		QXuint									_readFBO { 0 };
+		QXuint									_drawFBO { 0 };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Find a place for a texture, opens a page if none has room
+		 *
+		 * @param width width with the padding
+		 * @param height height with the padding
+		 * @param page page of the place
+		 * @param x left of the place
+		 * @param y bottom of the place
+		 * @return QXbool false if the texture is larger than a page
+		 */
+		QXbool	Place(QXint width, QXint height, QXint& page, QXint& x, QXint& y) noexcept;
+
+		/**
+		 * @brief Double the pages of the atlas, the filled pages are copied in the new storage
+		 */
+		void	Grow() noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Sprite Atlas object, the storage is created with the first texture
+		 */
+		SpriteAtlas() = default;
+
+		/**
+		 * @brief Construct a new Sprite Atlas object (DELETED)
+		 *
+		 * @param atlas atlas to copy
+		 */
+		SpriteAtlas(const SpriteAtlas& atlas) = delete;
+
+		/**
+		 * @brief Destroy the Sprite Atlas object, deletes the pages
+		 */
+		~SpriteAtlas() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Get the place of a texture, the texture is copied in the atlas the first time it is ready
+		 *
+		 * @param texture texture to find, can be nullptr
+		 * @return SpriteRect place of the texture, invalid if it is not ready or can not be packed
+		 */
+		SpriteRect	GetRect(Resources::Texture* texture) noexcept;
+
+		/**
+		 * @brief Bind the pages to the texture unit of the atlas
+		 */
+		void		Bind() const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of pages
+		 *
+		 * @return QXsizei pages holding textures
+		 */
+		inline QXsizei	GetPageCount() const noexcept { return _pages.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __SPRITEATLAS_H__
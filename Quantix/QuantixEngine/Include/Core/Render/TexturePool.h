@@ -0,0 +1,130 @@
+#ifndef __TEXTUREPOOL_H__
+#define __TEXTUREPOOL_H__
+
+#include <vector>
+#include <unordered_map>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Resources/Texture.h"
+
+// Texture arrays of the pool, one per format and size, each one uses a texture unit
+#define TEXTURE_POOL_ARRAYS 8
+// First texture unit of the arrays, the units below are used by the shadows and the environment
+#define TEXTURE_POOL_UNIT 5
+// Layers of an array when it is created, doubled when it is full
+#define TEXTURE_POOL_LAYERS 4
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Place of a texture in the pool, array is -1 when the texture is not pooled
+	 */
+	struct QUANTIX_API TextureSlot
+	{
+		#pragma region Attributes
+
+		QXint	array { -1 };
+		QXint	layer { -1 };
+
+		#pragma endregion
+	};
+
+	/**
+	 * @brief Copy the textures of the materials into texture arrays shared by textures of the same format and size,
+	 * every array is bound once per pass and the materials select their layer
+	 */
+	class QUANTIX_API TexturePool
+	{
+	private:
+		#pragma region Attributes
+
+		struct TextureArray
+		{
+			QXuint	id { 0 };
+			QXuint	format { 0 };
+			QXint	width { 0 };
+			QXint	height { 0 };
+			QXint	layerCount { 0 };
+			QXint	capacity { 0 };
+		};
+
+		std::vector<TextureArray>					_arrays;
+		std::unordered_map<QXuint, TextureSlot>		_slots;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Find the array of a format and size, creates it if there is still a texture unit for it
+		 *
+		 * @param format sized internal format
+		 * @param width width of the textures
+		 * @param height height of the textures
+		 * @return QXint index of the array, -1 if the pool is full
+		 */
+		QXint	FindArray(QXuint format, QXint width, QXint height) noexcept;
+
+		/**
+		 * @brief Double the layers of an array, the pooled layers are copied in the new storage
+		 *
+		 * @param array array to grow
+		 */
+		void	Grow(TextureArray& array) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Texture Pool object
+		 */
+		TexturePool() = default;
+
+		/**
+		 * @brief Construct a new Texture Pool object (DELETED)
+		 *
+		 * @param pool pool to copy
+		 */
+		TexturePool(const TexturePool& pool) = delete;
+
+		/**
+		 * @brief Destroy the Texture Pool object, deletes the arrays
+		 */
+		~TexturePool() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Get the slot of a texture, the texture is copied in the pool the first time it is ready
+		 *
+		 * @param texture texture to find, can be nullptr
+		 * @return TextureSlot slot of the texture, invalid if it is not ready or can not be pooled
+		 */
+		TextureSlot	GetSlot(Resources::Texture* texture) noexcept;
+
+		/**
+		 * @brief Bind every array to its texture unit
+		 */
+		void		Bind() const noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of arrays
+		 *
+		 * @return QXsizei arrays in the pool
+		 */
+		inline QXsizei	GetArrayCount() const noexcept { return _arrays.size(); }
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __TEXTUREPOOL_H__
@@ -0,0 +1,123 @@
+#ifndef __JOBSYSTEM_H__
+#define __JOBSYSTEM_H__
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+namespace Quantix::Core::Threading
+{
+	/**
+	 * @brief Worker threads started once and fed with short jobs of the frame, unlike the task system which
+	 * starts a thread per loading task. One worker less than the hardware threads is started, the thread
+	 * waiting on a parallel loop works with them
+	 */
+	class QUANTIX_API JobSystem
+	{
+	private:
+		#pragma region Attributes
+
+		std::vector<std::thread>			_workers;
+		std::deque<std::function<void()>>	_jobs;
+		std::mutex							_mutex;
+		std::condition_variable				_condition;
+		QXbool								_quit { false };
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Loop of a worker, runs jobs until the system is destroyed
+		 *
+		 * @param index index of the worker
+		 */
+		void	Run(QXuint index) noexcept;
+
+		#pragma endregion
+
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Job System object, starts the workers
+		 */
+		JobSystem() noexcept;
+
+		/**
+		 * @brief Construct a new Job System object (DELETED)
+		 *
+		 * @param system system to copy
+		 */
+		JobSystem(const JobSystem& system) = delete;
+
+		/**
+		 * @brief Destroy the Job System object
+		 */
+		~JobSystem() noexcept;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Run a job on a worker
+		 *
+		 * @param job job to run, must not block on another job
+		 */
+		void	Submit(std::function<void()> job) noexcept;
+
+		/**
+		 * @brief Split a range in chunks run by the workers and the calling thread, returns once every chunk is done
+		 *
+		 * @param count size of the range
+		 * @param grain size of a chunk
+		 * @param func function called with the begin and the end of each chunk
+		 */
+		void	ParallelFor(QXsizei count, QXsizei grain, const std::function<void(QXsizei, QXsizei)>& func) noexcept;
+
+		#pragma region Accessor
+
+		/**
+		 * @brief Get the number of workers
+		 *
+		 * @return QXsizei workers, 0 once destroyed
+		 */
+		inline QXsizei	GetWorkerCount() const noexcept { return _workers.size(); }
+
+		#pragma endregion
+
+		#pragma region Static
+
+		/**
+		 * @brief Get the index of the worker running the calling thread
+		 *
+		 * @return QXint index of the worker, -1 on the other threads
+		 */
+		static QXint		GetWorkerIndex() noexcept;
+
+		/**
+		 * @brief Stop and join the workers, the parallel loops then run on the calling thread
+		 */
+		static void			Destroy() noexcept;
+
+		/**
+		 * @brief Get the Instance object
+		 *
+		 * @return JobSystem* job system shared by the engine
+		 */
+		static JobSystem*	GetInstance() noexcept;
+
+		#pragma endregion
+
+		#pragma endregion
+	};
+}
+
+#endif // __JOBSYSTEM_H__
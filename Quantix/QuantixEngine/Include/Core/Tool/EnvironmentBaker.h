@@ -0,0 +1,93 @@
+#ifndef __ENVIRONMENTBAKER_H__
+#define __ENVIRONMENTBAKER_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+
+// Number of coefficients of the irradiance, spherical harmonics of order 2
+#define ENVIRONMENT_SH_COUNT 9
+// Number of samples of the GGX lobe for each texel of the prefiltered levels
+#define ENVIRONMENT_SPECULAR_SAMPLES 64
+
+namespace Quantix::Core::Tool
+{
+	/**
+	 * @brief Six faces of a cubemap in RGB floats, in the order and orientation of GL_TEXTURE_CUBE_MAP_POSITIVE_X + i
+	 */
+	struct QUANTIX_API CubeMapData
+	{
+		QXuint					size { 0 };
+		std::vector<QXfloat>	faces[6];
+	};
+
+	/**
+	 * @brief Bake the image based lighting of an environment on the cpu, each face is processed by its own thread
+	 */
+	class QUANTIX_API EnvironmentBaker
+	{
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Environment Baker object (DELETED)
+		 */
+		EnvironmentBaker() = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Project an equirectangular image on a cubemap
+		 *
+		 * @param image pixels of the image, the first row is the bottom of the image
+		 * @param width width of the image
+		 * @param height height of the image
+		 * @param channels number of channels of the image, the first three are used
+		 * @param size size of the faces of the cubemap
+		 * @return CubeMapData new cubemap
+		 */
+		static CubeMapData	FromEquirectangular(const QXfloat* image, QXint width, QXint height, QXint channels, QXuint size) noexcept;
+
+		/**
+		 * @brief Halve the size of a cubemap with a box filter
+		 *
+		 * @param cube cubemap to downsample
+		 * @return CubeMapData cubemap of half the size
+		 */
+		static CubeMapData	Downsample(const CubeMapData& cube) noexcept;
+
+		/**
+		 * @brief Project the diffuse irradiance of a cubemap on spherical harmonics, the cosine lobe and the 1 / pi
+		 * of the lambert brdf are already applied
+		 *
+		 * @param cube cubemap to project, a small level is enough
+		 * @param sh result, ENVIRONMENT_SH_COUNT RGB coefficients
+		 */
+		static void			ComputeIrradianceSH(const CubeMapData& cube, QXfloat sh[ENVIRONMENT_SH_COUNT * 3]) noexcept;
+
+		/**
+		 * @brief Prefilter a cubemap with the GGX lobe, the roughness goes from 0 on the first level to 1 on the last one
+		 *
+		 * @param mips mip chain of the cubemap to filter, used for the filtered importance sampling
+		 * @param size size of the first level
+		 * @param levelCount number of levels to compute
+		 * @return std::vector<CubeMapData> prefiltered levels
+		 */
+		static std::vector<CubeMapData>	PrefilterSpecular(const std::vector<CubeMapData>& mips, QXuint size, QXuint levelCount) noexcept;
+
+		/**
+		 * @brief Pack a face in the shared exponent format of GL_RGB9_E5
+		 *
+		 * @param face RGB floats of the face
+		 * @param packed result, one QXuint per texel
+		 */
+		static void			PackRGB9E5(const std::vector<QXfloat>& face, std::vector<QXuint>& packed) noexcept;
+
+		#pragma endregion
+	};
+}
+
+#endif // __ENVIRONMENTBAKER_H__
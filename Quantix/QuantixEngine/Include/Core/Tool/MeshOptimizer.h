@@ -0,0 +1,70 @@
+#ifndef __MESHOPTIMIZER_H__
+#define __MESHOPTIMIZER_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Resources/Model.h"
+
+// Number of vertices of the simulated post transform cache
+#define VERTEX_CACHE_SIZE 32
+
+namespace Quantix::Core::Tool
+{
+	/**
+	 * @brief Reorder the triangles and vertices of a mesh for the gpu, the mesh itself is unchanged
+	 */
+	class QUANTIX_API MeshOptimizer
+	{
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Mesh Optimizer object (DELETED)
+		 */
+		MeshOptimizer() = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Reorder the triangles to reuse the transformed vertices (Forsyth's linear-speed vertex cache optimisation)
+		 *
+		 * @param indices triangle list to reorder
+		 * @param vertexCount number of vertices of the mesh
+		 */
+		static void		OptimizeVertexCache(std::vector<QXuint>& indices, QXsizei vertexCount) noexcept;
+
+		/**
+		 * @brief Reorder the clusters of a cache optimized triangle list to draw the outer triangles first (Tipsify's overdraw pass)
+		 *
+		 * @param indices triangle list to reorder
+		 * @param vertices vertices of the mesh
+		 */
+		static void		OptimizeOverdraw(std::vector<QXuint>& indices, const std::vector<Resources::Vertex>& vertices) noexcept;
+
+		/**
+		 * @brief Reorder the vertices in their order of use and remove the unused ones
+		 *
+		 * @param vertices vertices to reorder
+		 * @param indexLists triangle lists using the vertices, the first one gives the order
+		 */
+		static void		OptimizeVertexFetch(std::vector<Resources::Vertex>& vertices, const std::vector<std::vector<QXuint>*>& indexLists) noexcept;
+
+		/**
+		 * @brief Compute the average number of vertices transformed per triangle with a FIFO cache
+		 *
+		 * @param indices triangle list to test
+		 * @param vertexCount number of vertices of the mesh
+		 * @param cacheSize size of the cache
+		 * @return QXfloat average cache miss ratio, 0.5 is ideal and 3 is the worst
+		 */
+		static QXfloat	ComputeACMR(const std::vector<QXuint>& indices, QXsizei vertexCount, QXuint cacheSize) noexcept;
+
+		#pragma endregion
+	};
+}
+
+#endif // __MESHOPTIMIZER_H__
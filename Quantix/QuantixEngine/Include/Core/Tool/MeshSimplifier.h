@@ -0,0 +1,46 @@
+#ifndef __MESHSIMPLIFIER_H__
+#define __MESHSIMPLIFIER_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Resources/Model.h"
+
+namespace Quantix::Core::Tool
+{
+	/**
+	 * @brief Quadric error mesh simplification, edges are collapsed on existing vertices so the
+	 * simplified indices share the vertex buffer of the source mesh
+	 */
+	class QUANTIX_API MeshSimplifier
+	{
+	public:
+		#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Mesh Simplifier object (DELETED)
+		 */
+		MeshSimplifier() = delete;
+
+		#pragma endregion
+
+		#pragma region Functions
+
+		/**
+		 * @brief Simplify a triangle list, seams and open borders are kept
+		 *
+		 * @param vertices vertices of the mesh
+		 * @param indices triangle list to simplify
+		 * @param targetIndexCount number of indices to reach
+		 * @param maxError max distance of the simplified surface to the source one, relative to the size of the mesh
+		 * @return std::vector<QXuint> simplified triangle list, can be bigger than the target if the error is reached first
+		 */
+		static std::vector<QXuint> Simplify(const std::vector<Resources::Vertex>& vertices, const std::vector<QXuint>& indices,
+			QXsizei targetIndexCount, QXfloat maxError) noexcept;
+
+		#pragma endregion
+	};
+}
+
+#endif // __MESHSIMPLIFIER_H__
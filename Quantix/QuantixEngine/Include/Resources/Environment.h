@@ -0,0 +1,147 @@
+#ifndef __ENVIRONMENT_H__
+#define __ENVIRONMENT_H__
+
+#include <vector>
+
+#include <Type.h>
+#include "Core/DLLHeader.h"
+#include "Core/Tool/EnvironmentBaker.h"
+#include "Resource.h"
+
+// Size of the faces of the sky cubemap, a quarter of the width of the source covers a face
+#define ENVIRONMENT_SIZE 512
+// Size of the first level of the prefiltered specular cubemap
+#define ENVIRONMENT_SPECULAR_SIZE 128
+// Number of levels of the prefiltered specular cubemap, the last one has a roughness of 1
+#define ENVIRONMENT_SPECULAR_MIPS 5
+// Size of the level used for the irradiance projection
+#define ENVIRONMENT_IRRADIANCE_SIZE 32
+// Version of the cache file, a cache of another version is baked again
+#define ENVIRONMENT_CACHE_VERSION 1
+
+namespace Quantix::Resources
+{
+	/**
+	 * @brief Image based lighting of an HDR environment: sky cubemap, irradiance as spherical harmonics and
+	 * prefiltered specular mip chain. Baked once on the cpu then loaded from a binary cache
+	 */
+	class QUANTIX_API Environment : public Resource
+	{
+	private:
+#pragma region Attributes
+
+		std::vector<QXuint>					_skyFaces[6];
+		std::vector<QXuint>					_specularFaces[ENVIRONMENT_SPECULAR_MIPS][6];
+		QXfloat								_irradianceSH[ENVIRONMENT_SH_COUNT * 3] { 0 };
+
+		QXuint								_skySize { 0 };
+		QXuint								_specularSize { 0 };
+
+		QXuint								_cubemap { 0 };
+		QXuint								_specularMap { 0 };
+
+#pragma endregion
+
+#pragma region Functions
+
+		/**
+		 * @brief Load the baked environment from its quantix file
+		 *
+		 * @param file path to the source file
+		 * @return QXbool load successfully
+		 */
+		QXbool	LoadFromCache(const QXstring& file) noexcept;
+
+		/**
+		 * @brief Save the baked environment next to its source
+		 *
+		 * @param file path to the source file
+		 */
+		void	SaveToCache(const QXstring& file) noexcept;
+
+		/**
+		 * @brief Decode the HDR file and bake the environment
+		 *
+		 * @param file path to the HDR file
+		 * @return QXbool bake successfully
+		 */
+		QXbool	Bake(const QXstring& file) noexcept;
+
+		/**
+		 * @brief Create a cubemap from packed faces
+		 *
+		 * @param faces faces of each level
+		 * @param size size of the first level
+		 * @param levelCount number of levels
+		 * @return QXuint id of the texture
+		 */
+		QXuint	CreateCubemap(const std::vector<QXuint> (*faces)[6], QXuint size, QXuint levelCount) noexcept;
+
+#pragma endregion
+
+	public:
+#pragma region Constructors
+
+		/**
+		 * @brief Construct a new Environment object
+		 */
+		Environment() = default;
+
+		/**
+		 * @brief Construct a new Environment object (DELETED)
+		 *
+		 * @param environment Environment to copy
+		 */
+		Environment(const Environment& environment) = delete;
+
+		/**
+		 * @brief Destroy the Environment object
+		 */
+		~Environment() noexcept;
+
+#pragma endregion
+
+#pragma region Functions
+
+		/**
+		 * @brief Load an environment, from the cache if it exists or from the HDR file
+		 *
+		 * @param file path to the HDR file
+		 */
+		void	Load(const QXstring& file) noexcept override;
+
+		/**
+		 * @brief Create the cubemaps, the cpu copy is released
+		 */
+		void	Init() noexcept override;
+
+#pragma region Accessor
+
+		/**
+		 * @brief Get the sky cubemap
+		 *
+		 * @return QXuint id of the cubemap
+		 */
+		inline QXuint			GetCubemap() const noexcept { return _cubemap; }
+
+		/**
+		 * @brief Get the prefiltered specular cubemap, the level is the roughness times the last level
+		 *
+		 * @return QXuint id of the cubemap
+		 */
+		inline QXuint			GetSpecularMap() const noexcept { return _specularMap; }
+
+		/**
+		 * @brief Get the irradiance, already divided by pi
+		 *
+		 * @return const QXfloat* ENVIRONMENT_SH_COUNT RGB coefficients
+		 */
+		inline const QXfloat*	GetIrradianceSH() const noexcept { return _irradianceSH; }
+
+#pragma endregion
+
+#pragma endregion
+	};
+}
+
+#endif // __ENVIRONMENT_H__
@@ -6,10 +6,27 @@
 
 #include "ShaderProgram.h"
 #include "Texture.h"
+#include "Environment.h"
 #include "Core/Components/Light.h"
 
 namespace Quantix::Resources
 {
+	/**
+	 * @brief Values of a material in the std430 layout of the material storage buffer, the textures are
+	 * (array, layer) slots of the texture pool, array is -1 without texture
+	 */
+	struct QUANTIX_API MaterialData
+	{
+		QXfloat	ambient[4];
+		QXfloat	diffuse[4];
+		QXfloat	specular[3];
+		QXfloat	shininess;
+		QXfloat	tile[2];
+		QXint	diffuseSlot[2];
+		QXint	emissiveSlot[2];
+		QXint	padding[2];
+	};
+
 	class QUANTIX_API Material
 	{
 	private:
@@ -21,6 +38,7 @@ namespace Quantix::Resources
 
 		QXstring		_path;
 
+		QXbool			_samplersSet = false;
 
 #pragma endregion
 
@@ -73,15 +91,19 @@ namespace Quantix::Resources
 		QXbool	IsReady() noexcept;
 
 		/**
-		 * @brief Send Material data to the shader
+		 * @brief Write the values of the material for the material storage buffer, the texture slots are
+		 * left invalid for the texture pool
+		 * 
+		 * @param data values to fill
 		 */
-		void SendData(QXuint shadowTexture, QXbool isPointLight = false) noexcept;
+		void FillData(MaterialData& data) noexcept;
 
 		/**
-		 * @brief Send Textures to shader
+		 * @brief Send the image based lighting of the environment to the shader
 		 * 
+		 * @param environment environment to use, the lighting is disabled until it is ready
 		 */
-		void SendTextures() noexcept;
+		void SendEnvironment(Environment* environment) noexcept;
 
 		/**
 		 * @brief Set a float in a shader
@@ -179,12 +201,12 @@ namespace Quantix::Resources
 		 */
 		void SetUint3(QXstring location, const QXuint* value) noexcept;
 
-#pragma region Inline
-
 		/**
-		 * @brief Use material's shader program
+		 * @brief Use material's shader program, the samplers are set on the first use
 		 */
-		inline void UseShader() noexcept { _program->Use(); }
+		void UseShader() noexcept;
+
+#pragma region Inline
 
 		/**
 		 * @brief Unuse material's shader program
@@ -15,6 +15,15 @@
 
 #include "Resource.h"
 
+// Max number of levels of detail of a model, the first one is the source mesh
+#define MODEL_MAX_LOD 4
+// Part of the triangles of the previous level kept by each level
+#define MODEL_LOD_RATIO 0.5f
+// Max error of a simplified level, relative to the size of the model
+#define MODEL_LOD_MAX_ERROR 0.05f
+// Max number of vertices addressed with 16 bits indices
+#define MODEL_SHORT_INDEX_LIMIT 65536
+
 namespace Quantix::Resources
 {
 	struct QUANTIX_API Vertex
@@ -64,9 +73,17 @@ namespace Quantix::Resources
 		std::vector<Vertex> _vertices;
 		std::vector<QXuint>	_indices;
 		QXuint				_VAO = 0;
+		QXuint				_depthVAO = 0;
+
+		std::vector<std::vector<QXuint>>	_lodIndices;
+		std::vector<QXsizei>				_lodOffsets;
+		QXuint								_indexType = 0;
 
 		QXstring			_path;
 
+		Math::QXvec3		_boundsMin;
+		Math::QXvec3		_boundsMax;
+
 #pragma endregion
 
 #pragma region Functions
@@ -86,6 +103,21 @@ namespace Quantix::Resources
 		 */
 		void LoadWithLib(const QXstring& file) noexcept;
 
+		/**
+		 * @brief Compute the local bounding box of the vertices
+		 */
+		void ComputeBounds() noexcept;
+
+		/**
+		 * @brief Simplify the mesh to generate the levels of detail, they share the vertices of the model
+		 */
+		void GenerateLODs() noexcept;
+
+		/**
+		 * @brief Reorder the triangles of each level for the vertex cache and the overdraw, then the vertices in their order of use
+		 */
+		void Optimize() noexcept;
+
 #pragma endregion
 		
 	public:
@@ -140,6 +172,13 @@ namespace Quantix::Resources
 		 */
 		void Init() noexcept override;
 
+		/**
+		 * @brief Save the vertices, the indices and the levels of detail in the quantix file of the model
+		 * 
+		 * @param file path to the source file
+		 */
+		void SaveToCache(const QXstring& file) noexcept;
+
 #pragma region Operators
 
 		/**
@@ -161,6 +200,13 @@ namespace Quantix::Resources
 		 */
 		inline QXuint GetVAO() noexcept { return _VAO; }
 
+		/**
+		 * @brief Get VAO of the positions only, used by the depth prepass
+		 * 
+		 * @return QXuint VAO value
+		 */
+		inline QXuint GetDepthVAO() noexcept { return _depthVAO; }
+
 		/**
 		 * @brief Get the Indices array
 		 * 
@@ -175,6 +221,36 @@ namespace Quantix::Resources
 		 */
 		inline std::vector<Vertex>& GetVertices() noexcept { return _vertices; }
 
+		/**
+		 * @brief Get the number of levels of detail
+		 * 
+		 * @return QXuint number of levels, 1 if the model was not simplified
+		 */
+		inline QXuint					GetLODCount() const noexcept { return (QXuint)_lodIndices.size() + 1; }
+
+		/**
+		 * @brief Get the indices of a level of detail
+		 * 
+		 * @param lod level to get
+		 * @return const std::vector<QXuint>& indices of the level
+		 */
+		inline const std::vector<QXuint>&	GetLODIndices(QXuint lod) const noexcept { return lod == 0 ? _indices : _lodIndices[lod - 1]; }
+
+		/**
+		 * @brief Get the offset in bytes of a level of detail in the index buffer
+		 * 
+		 * @param lod level to get
+		 * @return QXsizei offset to give to the draw call
+		 */
+		inline QXsizei					GetLODOffset(QXuint lod) const noexcept { return lod < _lodOffsets.size() ? _lodOffsets[lod] : 0; }
+
+		/**
+		 * @brief Get the type of the indices in the index buffer
+		 * 
+		 * @return QXuint GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, to give to the draw call
+		 */
+		inline QXuint					GetIndexType() const noexcept { return _indexType; }
+
 		/**
 		 * @brief Get the Path object
 		 * 
@@ -189,6 +265,20 @@ namespace Quantix::Resources
 		 */
 		inline void						SetPath(QXstring path) noexcept { _path = path; }
 
+		/**
+		 * @brief Get the min corner of the local bounding box
+		 * 
+		 * @return const Math::QXvec3& min corner
+		 */
+		inline const Math::QXvec3&		GetBoundsMin() const noexcept { return _boundsMin; }
+
+		/**
+		 * @brief Get the max corner of the local bounding box
+		 * 
+		 * @return const Math::QXvec3& max corner
+		 */
+		inline const Math::QXvec3&		GetBoundsMax() const noexcept { return _boundsMax; }
+
 #pragma endregion
 
 #pragma endregion
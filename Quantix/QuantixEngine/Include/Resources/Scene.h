@@ -4,11 +4,16 @@
 #include "Core/DataStructure/GameObject2D.h"
 #include "Core/DataStructure/GameObject3D.h"
 #include "Core/Components/Collider.h"
+#include "Core/Components/Sprite.h"
 #include "Core/Platform/AppInfo.h"
 
+// Transforms of a depth of the 2D hierarchy updated by a job
+#define SCENE_2D_GRAIN 256
+
 namespace Quantix::Core::DataStructure
 {
 	class ResourcesManager;
+	class ObjectPool;
 }
 
 namespace Quantix::Resources
@@ -25,12 +30,39 @@ namespace Quantix::Resources
 			Core::DataStructure::GameObject3D*					_root3D;
 			QXuint												_id;
 
+			// Draw the depth of the opaque meshes before shading them
+			QXbool												_depthPrepass { false };
+
+			// Objects reused per prefab, made on the first use
+			Core::DataStructure::ObjectPool*					_pool { nullptr };
+
 			std::list<Core::DataStructure::GameComponent*>		_objectsComponent;
 			std::vector<Core::DataStructure::GameObject2D*>		_objects2D;
 			std::vector<Core::DataStructure::GameObject3D*>		_objects;
 			
 			std::atomic_bool									_isReady { false };
 
+			// 2D hierarchy flattened depth by depth, each depth ends at its entry of _depths2D
+			struct Node2D
+			{
+				Core::Physic::Transform2D*	transform;
+				Core::Physic::Transform2D*	parent;
+			};
+
+			std::vector<Node2D>									_nodes2D;
+			std::vector<QXsizei>								_depths2D;
+			std::vector<Core::Components::Sprite*>				_sprites;
+
+			#pragma endregion
+
+			#pragma region Functions
+
+			/**
+			 * @brief Update the transforms of the 2D objects, the transforms of a depth are updated in parallel once
+			 * their parents are, and gather the sprites to draw
+			 */
+			void	Update2D() noexcept;
+
 			#pragma endregion
 
 		public:
@@ -244,6 +276,13 @@ namespace Quantix::Resources
 			 */
 			inline std::vector<Core::DataStructure::GameObject2D*>	GetGameObjects2D() noexcept { return _objects2D; }
 
+			/**
+			 * @brief Get the sprites drawn this frame
+			 * 
+			 * @return const std::vector<Core::Components::Sprite*>& enabled sprites of the 2D objects
+			 */
+			inline const std::vector<Core::Components::Sprite*>&	GetSprites() const noexcept { return _sprites; }
+
 			/**
 			 * @brief Get the Game Components object
 			 * 
@@ -267,6 +306,13 @@ namespace Quantix::Resources
 			 */
 			Core::DataStructure::GameObject2D*						GetGameObject2D(const QXstring& name) noexcept;
 
+			/**
+			 * @brief Get the pool of the objects of the scene, made on the first call
+			 * 
+			 * @return Core::DataStructure::ObjectPool& pool
+			 */
+			Core::DataStructure::ObjectPool&						GetPool() noexcept;
+
 			/**
 			 * @brief Is scene ready
 			 * 
@@ -281,6 +327,20 @@ namespace Quantix::Resources
 			 */
 			inline void												SetReady(QXbool ready) noexcept { _isReady.store(ready); }
 
+			/**
+			 * @brief Is the depth prepass used
+			 * 
+			 * @return QXbool true if the depth is drawn before the opaque meshes
+			 */
+			inline QXbool											GetDepthPrepass() const noexcept { return _depthPrepass; }
+
+			/**
+			 * @brief Set the Depth Prepass object
+			 * 
+			 * @param depthPrepass true to draw the depth before the opaque meshes
+			 */
+			inline void												SetDepthPrepass(QXbool depthPrepass) noexcept { _depthPrepass = depthPrepass; }
+
 			#pragma endregion
 
 			#pragma endregion
@@ -29,33 +29,30 @@ namespace Quantix::Resources
 		QXuint 		_id;
 		EShaderType	_type;
 
+		QXstring	_defines;
+		QXstring	_code;
+
 #pragma endregion
 
 #pragma region Functions
 
 		/**
-		 * @brief Create a Fragment Shader object
-		 * 
-		 * @param file Path to the shader
+		 * @brief Create a Fragment Shader object from the code read by the constructor
 		 */
-		void 				CreateFragmentShader(QXstring file) noexcept;
+		void 				CreateFragmentShader() noexcept;
 
 		/**
-		 * @brief Create a Vertex Shader object
-		 * 
-		 * @param file Path to the shader
+		 * @brief Create a Vertex Shader object from the code read by the constructor
 		 */
-		void 				CreateVertexShader(QXstring file) noexcept;
+		void 				CreateVertexShader() noexcept;
 
 		/**
-		 * @brief Create a Vertex Shader object
-		 *
-		 * @param file Path to the shader
+		 * @brief Create a Geometry Shader object from the code read by the constructor
 		 */
-		void 				CreateGeometryShader(QXstring file) noexcept;
+		void 				CreateGeometryShader() noexcept;
 
 		/**
-		 * @brief Read shader file and put it into a string
+		 * @brief Read shader file and put it into a string, the shader defines are inserted after the #version line
 		 * 
 		 * @param file Path to the shader
 		 * @return QXstring Shader data
@@ -87,12 +84,13 @@ namespace Quantix::Resources
 		Shader(Shader&& shader) noexcept;
 
 		/**
-		 * @brief Construct a new Shader object
+		 * @brief Construct a new Shader object, only reads the file so it can be created outside of the render thread
 		 * 
 		 * @param file Path to the shader
 		 * @param type Type for the shader, can be Vertex, Fragment, Geometry
+		 * @param defines Preprocessor defines used to specialize the shader
 		 */
-		Shader(QXstring file, EShaderType type) noexcept;
+		Shader(QXstring file, EShaderType type, const QXstring& defines = "") noexcept;
 
 		/**
 		 * @brief Destroy the Shader object
@@ -103,10 +101,15 @@ namespace Quantix::Resources
 
 #pragma region Functions
 
+		/**
+		 * @brief Compile the shader the first time it is called, on the render thread
+		 */
+		void				Compile() noexcept;
+
 #pragma region Accessor
 
 		/**
-		 * @brief Get Shader ID
+		 * @brief Get Shader ID, 0 until compiled
 		 * 
 		 * @return QXuint ID value
 		 */
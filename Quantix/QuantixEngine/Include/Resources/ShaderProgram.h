@@ -15,12 +15,25 @@ namespace Quantix::Resources
 
 		QXuint									_id = 0;
 
+		Shader*									_vertexShader = nullptr;
+		Shader*									_fragmentShader = nullptr;
+		Shader*									_geometryShader = nullptr;
+
 		QXuint									_lightUniformBuffer = 0;
 
 		std::vector<QXstring>					_shadersPath;
 
 		std::unordered_map<QXstring, QXuint>	_locations;
 
+#pragma endregion
+
+#pragma region Functions
+
+		/**
+		 * @brief Compile the shaders and link the program the first time it is used, on the render thread
+		 */
+		void Link() noexcept;
+
 #pragma endregion
 	public:
 #pragma region Attributes
@@ -51,7 +64,7 @@ namespace Quantix::Resources
 		ShaderProgram(ShaderProgram&& program) noexcept;
 
 		/**
-		 * @brief Construct a new Shader Program object
+		 * @brief Construct a new Shader Program object, linked on its first use
 		 * 
 		 * @param vertexShader Path to the vertex shader
 		 * @param fragmentShader Path to the Fragment shader
@@ -107,7 +120,7 @@ namespace Quantix::Resources
 		 * 
 		 * @return QXuint ID
 		 */
-		inline QXuint GetID() noexcept { return _id; }
+		inline QXuint GetID() noexcept { Link(); return _id; }
 
 #pragma endregion
 
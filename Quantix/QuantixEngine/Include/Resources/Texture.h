@@ -23,6 +23,7 @@ namespace Quantix::Resources
 		QXint		_width { 0 };
 		QXint		_height { 0 };
 		QXint		_channel { 0 };
+		QXbool		_isHDR { false };
 
 #pragma endregion
 
@@ -86,6 +87,34 @@ namespace Quantix::Resources
 	 */
 	inline QXuint GetId() const noexcept { return _id; }
 
+	/**
+	 * @brief Get the width of the texture
+	 * 
+	 * @return QXint width in pixels
+	 */
+	inline QXint GetWidth() const noexcept { return _width; }
+
+	/**
+	 * @brief Get the height of the texture
+	 * 
+	 * @return QXint height in pixels
+	 */
+	inline QXint GetHeight() const noexcept { return _height; }
+
+	/**
+	 * @brief Get the number of channels of the texture
+	 * 
+	 * @return QXint channels
+	 */
+	inline QXint GetChannel() const noexcept { return _channel; }
+
+	/**
+	 * @brief Is the texture an HDR texture
+	 * 
+	 * @return QXbool true if loaded by LoadHDRTexture
+	 */
+	inline QXbool IsHDR() const noexcept { return _isHDR; }
+
 #pragma endregion
 
 #pragma endregion
@@ -0,0 +1,27 @@
+#version 430 core
+
+layout (location = 0) in vec3 position;
+
+layout (std140, binding = 0) uniform ViewProj
+{
+	mat4 view;
+	mat4 proj;
+};
+
+/* transforms of the frame, the draws of a model are consecutive */
+layout (std430, binding = 1) readonly buffer Transforms
+{
+	mat4 transforms[];
+};
+
+uniform uint firstInstance;
+
+/* the main pass tests the depth with GL_EQUAL, the position must match it exactly */
+invariant gl_Position;
+
+void 	main()
+{
+	mat4 TRS = transforms[firstInstance + gl_InstanceID];
+
+	gl_Position = proj * view * TRS * vec4(position, 1.0);
+}
@@ -2,9 +2,12 @@
 
 layout (location = 0) in vec3 pos;
 
-uniform mat4 model;
+layout (std140, binding = 4) uniform Instance
+{
+	mat4 TRS;
+};
 
 void main()
 {
-    gl_Position = model * vec4(pos, 1.0);
+    gl_Position = TRS * vec4(pos, 1.0);
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 layout (location = 0) in vec3 position;
 layout (location = 1) in vec2 uv;
-layout (location = 2) in vec3 normal;
+layout (location = 2) in vec2 normal;
 
 layout (std140, binding = 0) uniform ViewProj
 {
@@ -0,0 +1,16 @@
+#version 450 core
+
+in vec3 spriteUV;
+in vec4 spriteColor;
+
+out vec4 color;
+
+uniform sampler2DArray atlas;
+
+/* a negative page draws the color of the sprite alone */
+void main()
+{
+    color = spriteColor;
+    if (spriteUV.z >= 0.0)
+        color *= texture(atlas, spriteUV);
+}
@@ -0,0 +1,18 @@
+#version 450 core
+
+layout (location = 0) in vec2 pos;
+layout (location = 1) in vec3 uv;
+layout (location = 2) in vec4 color;
+
+out vec3 spriteUV;
+out vec4 spriteColor;
+
+uniform vec2 screenSize;
+
+/* sprites are placed in pixels from the bottom left of the view */
+void main()
+{
+	spriteUV = uv;
+	spriteColor = color;
+    gl_Position = vec4(pos / screenSize * 2.0 - 1.0, 0.0, 1.0);
+}
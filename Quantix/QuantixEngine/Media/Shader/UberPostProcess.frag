@@ -0,0 +1,80 @@
+#version 450 core
+
+// Per-pixel post process effects merged in one pass,
+// the enabled effects are selected by the defines injected by the composer
+
+layout (location = 0) out vec4 fragColor;
+
+uniform sampler2D scene;
+
+in vec2 UV;
+
+#ifdef TONE_MAPPING
+uniform mat4 uColorTransform;
+#endif
+
+#ifdef FILM_GRAIN
+uniform float uAmount;
+uniform float uCoef;
+
+float random(vec2 pts)
+{
+	vec2 randomPoint = vec2(
+		23.14069263277926,
+		2.665144142690225
+	);
+	return fract( cos( dot(pts, randomPoint) ) * 12345.6789 );
+}
+#endif
+
+#ifdef VIGNETTE
+uniform vec2 uResolution;
+uniform float uOuterRadius;
+uniform float uInnerRadius;
+#endif
+
+#ifdef CROSSHAIR
+uniform sampler2D crosshairTex;
+
+// Size of the crosshair quad in NDC
+const float crosshairScale = 0.05;
+#endif
+
+void main()
+{
+    fragColor = vec4(texture(scene, UV).rgb, 1.0);
+
+#ifdef TONE_MAPPING
+    // Treat color like a homogeneous vector
+    fragColor.rgb = (uColorTransform * vec4(fragColor.rgb, 1.0)).rgb;
+#endif
+
+#ifdef FILM_GRAIN
+    vec2 uvRandom = UV;
+	uvRandom.y *= random(vec2(uvRandom.y, uAmount));
+	// Apply Noises
+	fragColor.rgb += random(uvRandom) * uCoef;
+#endif
+
+#ifdef VIGNETTE
+	// Calc Vignette Coef
+	vec2 relativePosition = gl_FragCoord.xy / uResolution - .5;
+	float len = length(relativePosition);
+	float vignette = smoothstep(uOuterRadius, uInnerRadius, len);
+
+    fragColor.rgb = fragColor.rgb * vignette;
+#endif
+
+#ifdef CROSSHAIR
+    // Map the screen UV to the crosshair quad centered on the screen
+    vec2 crosshairUV = (UV * 2.0 - 1.0) / crosshairScale * 0.5 + 0.5;
+
+    if (all(greaterThanEqual(crosshairUV, vec2(0.0))) && all(lessThanEqual(crosshairUV, vec2(1.0))))
+    {
+        vec4 texColor = texture(crosshairTex, crosshairUV);
+
+        if (texColor.a != 0)
+            fragColor = texColor;
+    }
+#endif
+}
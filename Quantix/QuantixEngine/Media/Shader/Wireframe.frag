@@ -1,8 +1,10 @@
 #version 450 core
 
+in vec4 lineColor;
+
 out vec4 color;
 
 void main()
 {
-    color = vec4(1.0, 0.0, 0.0, 1.0);
-}
\ No newline at end of file
+    color = lineColor;
+}
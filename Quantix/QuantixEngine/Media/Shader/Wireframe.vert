@@ -1,18 +1,19 @@
 #version 450 core
 
 layout (location = 0) in vec3 pos;
+layout (location = 1) in vec4 color;
+
+out vec4 lineColor;
 
 layout (std140, binding = 0) uniform ViewProj
 {
 	mat4 view;
 	mat4 proj;
-	mat4 lightProj;
-	mat4 lightView;
 };
 
-uniform mat4 TRS;
-
+/* debug lines are already in world space */
 void main()
 {
-    gl_Position = proj * view * TRS * vec4(pos, 1.0);
-}
\ No newline at end of file
+	lineColor = color;
+    gl_Position = proj * view * vec4(pos, 1.0);
+}
@@ -1,4 +1,4 @@
-#version 420 core
+#version 430 core
 
 layout (location = 0) out vec4			fragColor;
 layout (location = 1) out vec4			brightColor;
@@ -24,22 +24,40 @@ struct Light
 	int		type;
 };
 
-struct Material
+/* values of the material, textures are (array, layer) slots of the texture arrays */
+struct MaterialData
 {
 	vec3	ambient;
 	vec3	diffuse;
 	vec3	specular;
-
 	float	shininess;
-	bool	isTextured;
-	bool	hasEmissive;
+	vec2	tile;
+	ivec2	diffuseSlot;
+	ivec2	emissiveSlot;
+};
 
+struct Material
+{
 	sampler2D	shadowMap;
 	samplerCube	pointShadowMap;
-	sampler2D	diffuseTexture;
-	sampler2D	emissiveTexture;
 };
 
+layout (std430, binding = 0) readonly buffer Materials
+{
+	MaterialData materials[];
+};
+
+layout (std140, binding = 4) uniform Instance
+{
+	mat4 TRS;
+	uint materialIndex;
+	uint firstInstance;
+	uint instanced;
+};
+
+/* the arrays are bound once per pass, the index is the same for the whole draw */
+uniform sampler2DArray	textureArrays[8];
+
 layout (std140, binding = 2) uniform lights
 {
 	uint count;
@@ -61,6 +79,12 @@ uniform vec3		viewPos;
 uniform float		farPlane;
 uniform vec3		lightPos;
 
+/* image based lighting baked from the environment */
+uniform bool		hasEnvironment;
+uniform vec3		irradianceSH[9];
+uniform samplerCube	environmentMap;
+uniform float		environmentMaxLevel;
+
 // array of offset direction for sampling
 const vec3 gridSamplingDisk[20] = vec3[]
 (
@@ -82,15 +106,30 @@ vec3	calculatePointLight(Light light, vec3 lightDir, vec3 norm, float shadow);
 vec3	calculateSpotLight(Light light, vec3 lightDir, vec3 norm, float shadow);
 float	ComputeShadow(vec4 fragPosLightSpace, vec3 lightDir, vec3 normal);
 float 	ComputePointShadow(vec3 fragPos);
+vec3	ComputeEnvironment(vec3 norm, out vec3 specular);
+
+/* material of the draw, read once by main */
+MaterialData		materialData;
+
+vec4	SampleSlot(ivec2 slot, vec2 uv)
+{
+	return texture(textureArrays[slot.x], vec3(uv, slot.y));
+}
 
 void main()
 {
 	vec3	norm = normalize(outNormal);
 	vec3	lightDir;
 	vec3	output = vec3(0.0);
+
+	materialData = materials[materialIndex];
+
+	vec2	tiledUV = UV;
+	if (materialData.tile.x >= 1 && materialData.tile.y >= 1)
+		tiledUV *= materialData.tile;
 	
-	if (material.hasEmissive)
-    	brightColor = texture(material.emissiveTexture, UV);
+	if (materialData.emissiveSlot.x >= 0)
+    	brightColor = SampleSlot(materialData.emissiveSlot, tiledUV);
 	else
 		brightColor = vec4(0.0);
 
@@ -119,11 +158,17 @@ void main()
 			output += calculateSpotLight(light[i], lightDir, norm, shadow);
 	}
 
-	if (material.isTextured)
-		fragColor = vec4(output, 1.0) * texture(material.diffuseTexture, UV);
+	vec3 environmentSpecular = vec3(0.0);
+	if (hasEnvironment)
+		output += ComputeEnvironment(norm, environmentSpecular);
+
+	if (materialData.diffuseSlot.x >= 0)
+		fragColor = vec4(output, 1.0) * SampleSlot(materialData.diffuseSlot, tiledUV);
 	else
 		fragColor = vec4(output, 1.0);
 
+	fragColor.rgb += environmentSpecular;
+
 	float brightness = dot(fragColor.rgb, minBright);
 	if(brightness > 1.0)
         brightColor += vec4(fragColor.rgb, 1.0);
@@ -213,6 +258,26 @@ float ComputePointShadow(vec3 fragPos)
     return shadow;
 }
 
+vec3	ComputeEnvironment(vec3 norm, out vec3 specular)
+{
+	/* irradiance is stored already convolved and divided by pi */
+	vec3 irradiance = irradianceSH[0] * 0.282095
+		+ irradianceSH[1] * 0.488603 * norm.y + irradianceSH[2] * 0.488603 * norm.z + irradianceSH[3] * 0.488603 * norm.x
+		+ irradianceSH[4] * 1.092548 * norm.x * norm.y + irradianceSH[5] * 1.092548 * norm.y * norm.z
+		+ irradianceSH[6] * 0.315392 * (3.0 * norm.z * norm.z - 1.0) + irradianceSH[7] * 1.092548 * norm.x * norm.z
+		+ irradianceSH[8] * 0.546274 * (norm.x * norm.x - norm.y * norm.y);
+
+	/* blinn-phong exponent to the roughness of the prefiltered levels */
+	vec3 viewDir = normalize(viewPos - fragPos);
+	float roughness = sqrt(sqrt(2.0 / (materialData.shininess + 2.0)));
+	vec3 prefiltered = textureLod(environmentMap, reflect(-viewDir, norm), roughness * environmentMaxLevel).rgb;
+	float fresnel = 0.04 + 0.96 * pow(1.0 - max(dot(norm, viewDir), 0.0), 5.0);
+
+	specular = prefiltered * materialData.specular * fresnel;
+
+	return max(irradiance, vec3(0.0)) * materialData.diffuse;
+}
+
 vec3	calculateDirectional(Light light, vec3 lightDir, vec3 norm, float shadow)
 {
 	/* direction only */
@@ -283,12 +348,12 @@ vec3 calculateDiffuse(vec3 lightDir, vec3 norm, vec3 diffuse)
 {
 	float diff = max(dot(norm, lightDir), 0.0);
 
-	return diffuse * diff * material.diffuse;
+	return diffuse * diff * materialData.diffuse;
 }
 
 vec3 calculateAmbient(vec3 ambient)
 {
-	return ambient * material.ambient;
+	return ambient * materialData.ambient;
 }
 
 vec3	calculateSpecular(vec3 lightDir, vec3 norm, vec3 specular)
@@ -296,7 +361,7 @@ vec3	calculateSpecular(vec3 lightDir, vec3 norm, vec3 specular)
 	// specular
     vec3 viewDir = normalize(viewPos - fragPos);
 	vec3 halwayDir = normalize(lightDir + viewDir);
-	float spec = pow(max(dot(norm, halwayDir), 0.0), material.shininess);
+	float spec = pow(max(dot(norm, halwayDir), 0.0), materialData.shininess);
 	
-    return specular * spec * material.specular;  
+    return specular * spec * materialData.specular;  
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
-#version 420 core
+#version 430 core
 
 layout (location = 0) in vec3 position;
 layout (location = 1) in vec2 uv;
-layout (location = 2) in vec3 normal;
+layout (location = 2) in vec2 normal;
 
 out vec2 UV;
 out vec3 outNormal;
@@ -10,9 +10,22 @@ out vec3 fragPos;
 out vec3 viewPos;
 out vec4 fragPosLightSpace;
 
-uniform mat4 TRS;
+/* written like the depth prepass so the GL_EQUAL depth test passes */
+invariant gl_Position;
 
-uniform vec2 tile;
+layout (std140, binding = 4) uniform Instance
+{
+	mat4 TRS;
+	uint materialIndex;
+	uint firstInstance;
+	uint instanced;
+};
+
+/* transforms of the instanced batches, read instead of TRS when instanced */
+layout (std430, binding = 1) readonly buffer Transforms
+{
+	mat4 transforms[];
+};
 
 layout (std140, binding = 0) uniform ViewProj
 {
@@ -26,19 +39,29 @@ layout (std140, binding = 1) uniform ViewProjLight
 	mat4 lightProj;
 };
 
+/* normals are octahedral encoded on two shorts */
+vec3	DecodeNormal(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+
+	return normalize(n);
+}
+
 void 	main()
 {
-	fragPos = vec3(TRS * vec4(position, 1.0));
+	mat4 model = instanced != 0u ? transforms[firstInstance + gl_InstanceID] : TRS;
+
+	fragPos = vec3(model * vec4(position, 1.0));
 
 	/* set pos of fragment */
-	gl_Position = proj * view * TRS * vec4(position, 1.0);
+	gl_Position = proj * view * model * vec4(position, 1.0);
 
-	if (tile.x < 1 || tile.y < 1)
-		UV = uv;
-	else
-		UV = uv * tile;
+	/* tiled by the fragment shader with the material */
+	UV = uv;
 
-	outNormal = mat3(transpose(inverse(TRS))) * normal;
+	outNormal = mat3(transpose(inverse(model))) * DecodeNormal(normal);
 
 	fragPosLightSpace = lightProj * lightView * vec4(fragPos, 1.0);
 }
\ No newline at end of file
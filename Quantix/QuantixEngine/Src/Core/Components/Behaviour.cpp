@@ -17,6 +17,19 @@ namespace Quantix::Core::Components
 		Component(object)
 	{}
 
+	void Behaviour::OnPhysicEvent(const Physic::PhysicEvent& event)
+	{
+		if (event.type != Physic::EPhysicEvent::CONTACT)
+		{
+			OnTrigger(event.receiver, event.other);
+			return;
+		}
+
+		Math::QXvec3 position = event.position;
+		Math::QXvec3 normal = event.normal;
+		OnCollision(event.receiver, event.other, position, normal);
+	}
+
 	Behaviour* Behaviour::Copy() const
 	{
 		return new Behaviour(*this);
@@ -23,6 +23,13 @@ namespace Quantix::Core::Components::Behaviours
 		return new Bumper(*this);
 	}
 
+	void	Bumper::Awake()
+	{
+		// Only pushes the objects entering the bumper
+		Unsubscribe(Physic::EPhysicEvent::CONTACT);
+		Unsubscribe(Physic::EPhysicEvent::TRIGGER_EXIT);
+	}
+
 	void    Bumper::OnTrigger(Core::DataStructure::GameObject3D* me, Core::DataStructure::GameObject3D* other)
 	{
 		if (other->GetComponent<Core::Components::Rigidbody>())
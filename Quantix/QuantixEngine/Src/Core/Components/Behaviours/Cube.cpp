@@ -56,28 +56,50 @@ namespace Quantix::Core::Components::Behaviours
 		}
 	}
 
+	QXuint Cube::OverlapMagnet(const Physic::QueryHit*& hits) noexcept
+	{
+		Physic::PhysicHandler* physic = Physic::PhysicHandler::GetInstance();
+		Core::DataStructure::GameObject3D* gameobject = static_cast<Core::DataStructure::GameObject3D*>(_object);
+
+		// The overlap of the last frame ran with the ones of the other cubes
+		QXuint count = 0;
+		hits = nullptr;
+		if (_overlapFrame + 1 == physic->GetQueryFrame())
+		{
+			count = physic->GetQueryResults().GetHitCount(_overlapId);
+			hits = physic->GetQueryResults().GetHits(_overlapId);
+		}
+
+		_overlapId = physic->GetQueryBatch().OverlapSphere(_rangeOfMagnet, gameobject->GetTransform()->GetGlobalPosition());
+		_overlapFrame = physic->GetQueryFrame();
+
+		return count;
+	}
+
 	void Cube::Attract(QXdouble deltaTime) noexcept
 	{
 		Core::DataStructure::GameObject3D* gameobject = static_cast<Core::DataStructure::GameObject3D*>(_object);
 
-		std::vector<Core::DataStructure::GameObject3D*> overlapedObjects = Physic::PhysicHandler::GetInstance()->OverlapSphere(_rangeOfMagnet, gameobject->GetTransform());
+		const Physic::QueryHit* hits;
+		QXuint count = OverlapMagnet(hits);
 		
-		for (QXuint i = 0; i < overlapedObjects.size(); i++)
+		for (QXuint i = 0; i < count; i++)
 		{
-			if (overlapedObjects[i] != _object)
+			Core::DataStructure::GameObject3D* overlaped = hits[i].object;
+			if (overlaped != _object)
 			{
 				Cube* cube = nullptr;
-				if (overlapedObjects[i])
-					cube = overlapedObjects[i]->GetComponent<Cube>(true);
+				if (overlaped)
+					cube = overlaped->GetComponent<Cube>(true);
 
 				if (cube)
 				{
-					if ((gameobject->GetGlobalPosition() - overlapedObjects[i]->GetGlobalPosition()).Length() > 0.5f)
+					if ((gameobject->GetGlobalPosition() - overlaped->GetGlobalPosition()).Length() > 0.5f)
 					{
-						Core::Components::Rigidbody* rigid = overlapedObjects[i]->GetComponent< Core::Components::Rigidbody>();
+						Core::Components::Rigidbody* rigid = overlaped->GetComponent< Core::Components::Rigidbody>();
 
 						if (rigid && cube->GetStatePhysic() == ECubePhysicState::DEFAULT)
-							rigid->AddForce((gameobject->GetGlobalPosition() - overlapedObjects[i]->GetLocalPosition()) * (QXfloat)deltaTime * ATTRACTFORCE);
+							rigid->AddForce((gameobject->GetGlobalPosition() - overlaped->GetLocalPosition()) * (QXfloat)deltaTime * ATTRACTFORCE);
 					}
 				}
 			}
@@ -88,22 +110,24 @@ namespace Quantix::Core::Components::Behaviours
 	{
 		Core::DataStructure::GameObject3D* gameobject = static_cast<Core::DataStructure::GameObject3D*>(_object);
 
-		std::vector<Core::DataStructure::GameObject3D*> overlapedObjects = Physic::PhysicHandler::GetInstance()->OverlapSphere(_rangeOfMagnet, gameobject->GetTransform());
+		const Physic::QueryHit* hits;
+		QXuint count = OverlapMagnet(hits);
 
-		for (QXuint i = 0; i < overlapedObjects.size(); i++)
+		for (QXuint i = 0; i < count; i++)
 		{
-			if (overlapedObjects[i] != _object)
+			Core::DataStructure::GameObject3D* overlaped = hits[i].object;
+			if (overlaped != _object)
 			{
 				Cube* cube = nullptr;
-				if (overlapedObjects[i])
-					cube = overlapedObjects[i]->GetComponent<Cube>(true);
+				if (overlaped)
+					cube = overlaped->GetComponent<Cube>(true);
 
 				if (cube)
 				{
-					Core::Components::Rigidbody* rigid = overlapedObjects[i]->GetComponent< Core::Components::Rigidbody>();
+					Core::Components::Rigidbody* rigid = overlaped->GetComponent< Core::Components::Rigidbody>();
 
 					if (rigid && cube->GetStatePhysic() == ECubePhysicState::DEFAULT)
-						rigid->AddForce((overlapedObjects[i]->GetLocalPosition() - gameobject->GetGlobalPosition()) * (QXfloat)deltaTime * REJECTFORCE);
+						rigid->AddForce((overlaped->GetLocalPosition() - gameobject->GetGlobalPosition()) * (QXfloat)deltaTime * REJECTFORCE);
 				}
 			}
 		}
@@ -3,6 +3,7 @@
 #include "Core/Components/Mesh.h"
 #include "Core/Components/CubeCollider.h"
 #include "Core/Components/Rigidbody.h"
+#include "Core/DataStructure/ObjectPool.h"
 
 RTTR_PLUGIN_REGISTRATION
 {
@@ -49,20 +50,22 @@ namespace Quantix::Core::Components::Behaviours
 				return;
 		}
 
-		for (auto it = _cubes.begin(); it != _cubes.end(); ++it)
+		for (auto it = _cubes.begin(); it != _cubes.end();)
 		{
-			if (!(*it)->GetIsActive())
+			// Released to the pool, the object may be spawned again by another generator
+			if ((*it)->IsParked())
 			{
-				ReUseCube((*it));
-				return;
+				it = _cubes.erase(it);
+				continue;
 			}
 
 			if ((_gameobject->GetGlobalPosition() - (*it)->GetGlobalPosition()).Length() < _distForGeneration)
 				return;
+			++it;
 		}
 
 		if ((QXuint)_cubes.size() < _nbMaxOfCubes)
-			CreateCube();
+			SpawnCube();
 	}
 
 	void CubeGenerator::Destroy()
@@ -96,6 +99,9 @@ namespace Quantix::Core::Components::Behaviours
 		GenerateMesh("Plot2", Math::QXvec3(1.38f, 0.f, 0.f), Math::QXvec3(0.2f, 1.5f, 0.2f), "media/Material/Plot.mat");
 		GenerateMesh("Plot3", Math::QXvec3(0.f, 0.f, -1.38f), Math::QXvec3(0.2f, 1.5f, 0.2f), "media/Material/Plot.mat");
 		GenerateMesh("Plot4", Math::QXvec3(0.f, 0.f, 1.38f), Math::QXvec3(0.2f, 1.5f, 0.2f), "media/Material/Plot.mat");
+
+		RegisterCube();
+		_scene->GetPool().Warm(_prefab, _nbMaxOfCubes);
 	}
 
 	void CubeGenerator::SetSceneAndResourcesManager(Quantix::Resources::Scene* scene, Quantix::Core::DataStructure::ResourcesManager* rm)
@@ -104,39 +110,52 @@ namespace Quantix::Core::Components::Behaviours
 		_manager = rm;
 	}
 
-	void CubeGenerator::CreateCube() noexcept
+	void CubeGenerator::RegisterCube() noexcept
 	{
-		//GAMEOBJECT
-		Core::DataStructure::GameObject3D* cube = _scene->AddGameObject("Generated Cube " + std::to_string(_cubes.size() + 1));
-		cube->SetTransformValue(_gameobject->GetGlobalPosition(), _gameobject->GetGlobalRotation(), _gameobject->GetGlobalScale());
-		cube->SetLayer(Core::DataStructure::Layer::SELECTABLE);
+		Quantix::Core::DataStructure::ResourcesManager* manager = _manager;
 
-		//MESH
-		Core::Components::Mesh* mesh = cube->AddComponent<Core::Components::Mesh>();
-		mesh->Init(cube);
-		_manager->CreateMesh(mesh, "media/Mesh/cube.obj");
-		mesh->SetMaterial(_manager->CreateMaterial("media/Material/Cube.mat"));
+		auto build = [manager](Core::DataStructure::GameObject3D* cube)
+		{
+			cube->SetLayer(Core::DataStructure::Layer::SELECTABLE);
+
+			//MESH
+			Core::Components::Mesh* mesh = cube->AddComponent<Core::Components::Mesh>();
+			mesh->Init(cube);
+			manager->CreateMesh(mesh, "media/Mesh/cube.obj");
+			mesh->SetMaterial(manager->CreateMaterial("media/Material/Cube.mat"));
 
-		//CUBE COLLIDER
-		Core::Components::CubeCollider* collider = cube->AddComponent<Core::Components::CubeCollider>();
-		collider->Init(cube);
+			//CUBE COLLIDER
+			Core::Components::CubeCollider* collider = cube->AddComponent<Core::Components::CubeCollider>();
+			collider->Init(cube);
 
-		//RIGIDBODY
-		Core::Components::Rigidbody* rigid = cube->AddComponent<Core::Components::Rigidbody>();
-		rigid->Init(cube);
-		rigid->SetTransformPosition(_gameobject->GetGlobalPosition());
+			//RIGIDBODY
+			Core::Components::Rigidbody* rigid = cube->AddComponent<Core::Components::Rigidbody>();
+			rigid->Init(cube);
 
-		//CUBE BEHAVIOUR
-		cube->AddComponent<Cube>()->Init(cube);
+			//CUBE BEHAVIOUR
+			cube->AddComponent<Cube>()->Init(cube);
+		};
 
-		_cubes.push_back(cube);
+		// A cube frozen or magnetized by the arms comes back as a plain cube
+		auto reset = [](Core::DataStructure::GameObject3D* cube)
+		{
+			Core::Components::Rigidbody* rigid = cube->GetComponent<Core::Components::Rigidbody>();
+			rigid->SetRigidFlagKinematic(false);
+			rigid->SetRigidFlagKineForQueries(false);
+
+			Cube* comp = cube->GetComponent<Cube>();
+			comp->ChangeStatePhysic(ECubePhysicState::DEFAULT);
+			comp->ChangeStateMagnet(ECubeMagnetState::DEFAULT);
+			comp->UpdateMaterial();
+		};
+
+		_prefab = _scene->GetPool().Register("Generated Cube", build, reset);
 	}
 
-	void CubeGenerator::ReUseCube(Core::DataStructure::GameObject3D* cube) noexcept
+	void CubeGenerator::SpawnCube() noexcept
 	{
-		cube->SetTransformValue(_gameobject->GetGlobalPosition(), _gameobject->GetGlobalRotation(), _gameobject->GetGlobalScale());
-		cube->GetComponent<Core::Components::Rigidbody>()->SetTransformPosition(_gameobject->GetGlobalPosition());
-
-		cube->SetIsActive(QX_TRUE);
+		Core::DataStructure::GameObject3D* cube = _scene->GetPool().Spawn(_prefab, _gameobject->GetGlobalPosition(), _gameobject->GetGlobalRotation());
+		if (cube)
+			_cubes.push_back(cube);
 	}
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Core/Components//Behaviours//Killzone.h"
 #include "Core\DataStructure\GameObject3D.h"
+#include "Core\Components\FractureMesh.h"
 
 RTTR_PLUGIN_REGISTRATION
 {
@@ -25,7 +26,22 @@ namespace Quantix::Core::Components::Behaviours
 
 	void Killzone::Awake()
 	{
+		// An object is removed when it enters, leaving the zone has nothing to do
+		Unsubscribe(Physic::EPhysicEvent::TRIGGER_EXIT);
+	}
+
+	void	Killzone::OnPhysicEvent(const Physic::PhysicEvent& event)
+	{
+		// The pieces of a block share its object, the block is destroyed once its last piece is released
+		FractureMesh* block = event.other->GetComponent<FractureMesh>();
+		if (block && block->fracture && event.otherShape)
+		{
+			if (block->fracture->Release(event.otherShape) == 0)
+				event.other->toDestroy = true;
+			return;
+		}
 
+		Behaviour::OnPhysicEvent(event);
 	}
 
 	void    Killzone::OnTrigger(Core::DataStructure::GameObject3D* me, Core::DataStructure::GameObject3D* other)
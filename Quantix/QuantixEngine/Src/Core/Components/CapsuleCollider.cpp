@@ -21,9 +21,9 @@ namespace Quantix::Core::Components
 	{
 		// Create Shape in physic
 		if (par->GetComponent<Rigidbody>())
-			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, true);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, true, key);
 		else
-			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, false);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, false, key);
 	}
 
 	CapsuleCollider::CapsuleCollider(const CapsuleCollider& other) noexcept :
@@ -36,9 +36,7 @@ namespace Quantix::Core::Components
 
 	QXfloat CapsuleCollider::GetRadius() noexcept
 	{
-		physx::PxCapsuleGeometry cap;
-		shape->getCapsuleGeometry(cap);
-		return cap.radius;
+		return key.size.x;
 	}
 
 	void CapsuleCollider::SetRadius(QXfloat f) noexcept
@@ -46,20 +44,20 @@ namespace Quantix::Core::Components
 		scale.x = f;
 		scale.z = f;
 
-		shape->setGeometry(physx::PxCapsuleGeometry(physx::PxReal(f), physx::PxReal(GetHalfHeight())));
+		key.size.x = f;
+		Reshape();
 	}
 
 	QXfloat CapsuleCollider::GetHalfHeight() noexcept
 	{
-		physx::PxCapsuleGeometry cap;
-		shape->getCapsuleGeometry(cap);
-		return cap.halfHeight;
+		return key.size.y;
 	}
 
 	void CapsuleCollider::SetHalfHeight(QXfloat f) noexcept
 	{
 		scale.y = 2 * GetRadius() * f;
-		shape->setGeometry(physx::PxCapsuleGeometry(physx::PxReal(GetRadius()), physx::PxReal(f)));
+		key.size.y = f;
+		Reshape();
 	}
 
 	CapsuleCollider* CapsuleCollider::Copy() const
@@ -74,22 +72,22 @@ namespace Quantix::Core::Components
 		_isDestroyed = false;
 		_isEnable = true;
 
+		// Set Collider Group, on the key only as the shape is taken once it is complete
+		SetCollideFilterCrab(true);
+		SetCollideFilterMine(true);
+		SetCollideFilterPawn(true);
+		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
+
 		// Create shape and Init Pointer On Actor physic
 		if (par->GetComponent<Rigidbody>())
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, true);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, true, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, true);
 		}
 		else
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, false);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCapsuleCollider(par, false, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, false);
 		}
-
-		// Set Collider Group
-		SetCollideFilterCrab(true);
-		SetCollideFilterMine(true);
-		SetCollideFilterPawn(true);
-		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Core/Components/CharacterController.h"
 #include "Core/Physic/PhysicSetting.h"
 #include "Core/Physic/Raycast.h"
+#include "Core/DataStructure/GameObject3D.h"
 
 #include "Core/Components/Camera.h"
 
@@ -35,6 +36,7 @@ namespace Quantix::Core::Components
 		_isEnable = QX_TRUE;
 
 		controller = Physic::PhysicHandler::GetInstance()->CreateController(object);
+		agent = Physic::PhysicHandler::GetInstance()->GetCrowd().Add(controller, (Core::DataStructure::GameObject3D*)object);
 		_velocity = Math::QXvec3(0, 0, 0);
 	}
 
@@ -48,14 +50,13 @@ namespace Quantix::Core::Components
 		if (_object->GetComponent<Core::Components::Camera>())
 			_object->GetComponent<Core::Components::Camera>()->_controller = nullptr;
 
-		Physic::PhysicHandler::GetInstance()->CleanController(controller);
+		Physic::PhysicHandler::GetInstance()->CleanController(controller, agent);
+		agent = CROWD_INVALID_AGENT;
 	}
 
 	void CharacterController::Move(Math::QXvec3 vec, QXint minDist, QXfloat deltaTime) noexcept
 	{
-		physx::PxControllerFilters filters;
-		
-		physx::PxControllerCollisionFlags tmp = controller->move(physx::PxVec3(vec.x, vec.y, vec.z), (physx::PxF32)minDist, deltaTime, filters);
+		Physic::PhysicHandler::GetInstance()->GetCrowd().Move(agent, physx::PxVec3(vec.x, vec.y, vec.z), (physx::PxF32)minDist, deltaTime);
 	}
 
 	QXbool CharacterController::CheckIsFalling() noexcept
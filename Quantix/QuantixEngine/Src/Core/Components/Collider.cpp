@@ -47,6 +47,7 @@ namespace Quantix::Core::Components
 	ICollider::ICollider(const ICollider& col) noexcept :
 		Core::DataStructure::Component(col),
 		shape{ col.shape },
+		key{ col.key },
 		physicType{ col.physicType },
 		actorPhysic{ col.actorPhysic }
 	{}
@@ -54,6 +55,7 @@ namespace Quantix::Core::Components
 	ICollider::ICollider(ICollider&& col) noexcept :
 		Core::DataStructure::Component(col),
 		shape{ std::move(col.shape) },
+		key{ std::move(col.key) },
 		physicType{ std::move(col.physicType) },
 		actorPhysic{ std::move(col.actorPhysic) }
 	{}
@@ -61,6 +63,7 @@ namespace Quantix::Core::Components
 	ICollider& ICollider::operator=(const ICollider& other) noexcept
 	{
 		shape = other.shape;
+		key = other.key;
 		physicType = other.physicType;
 		actorPhysic = other.actorPhysic;
 
@@ -70,6 +73,7 @@ namespace Quantix::Core::Components
 	ICollider& ICollider::operator=(ICollider&& other) noexcept
 	{
 		shape = std::move(other.shape);
+		key = std::move(other.key);
 		physicType = std::move(other.physicType);
 		actorPhysic = std::move(other.actorPhysic);
 
@@ -103,45 +107,53 @@ namespace Quantix::Core::Components
 
 	void ICollider::Destroy()
 	{
-		shape->getActor()->detachShape(*shape);
+		if (shape)
+		{
+			Physic::PhysicHandler::GetInstance()->ReleaseCollider(_object, shape);
+			shape = nullptr;
+		}
+	}
+
+	void ICollider::Reshape() noexcept
+	{
+		// Without shape yet, the key is used once it is created
+		if (shape)
+			shape = Physic::PhysicHandler::GetInstance()->EditCollider(_object, shape, key);
 	}
 
 	Math::QXvec3 ICollider::GetPosition() noexcept
 	{
-		physx::PxVec3 tmp = shape->getLocalPose().p;
+		physx::PxVec3 tmp = key.localPose.p;
 		return Math::QXvec3(tmp.x, tmp.y, tmp.z);
 	}
 
 	void ICollider::SetPosition(Math::QXvec3 v) noexcept
 	{
-		physx::PxVec3 tmp = physx::PxVec3(v.x, v.y, v.z);
-		shape->setLocalPose(physx::PxTransform(tmp, shape->getLocalPose().q));
+		key.localPose.p = physx::PxVec3(v.x, v.y, v.z);
+		Reshape();
 	}
 
 	Math::QXquaternion ICollider::GetRotation() noexcept
 	{
-		physx::PxQuat tmp = shape->getLocalPose().q;
+		physx::PxQuat tmp = key.localPose.q;
 
 		return Math::QXquaternion(tmp.w, tmp.x, tmp.y, tmp.z);
 	}
 
 	void ICollider::SetRotation(Math::QXquaternion q) noexcept
 	{
-		physx::PxQuat tmp = physx::PxQuat(q.v.x, q.v.y, q.v.z, q.w);
-		shape->setLocalPose(physx::PxTransform(shape->getLocalPose().p, tmp));
+		key.localPose.q = physx::PxQuat(q.v.x, q.v.y, q.v.z, q.w);
+		Reshape();
 	}
 
 	void ICollider::SetMyFilterGroup(Physic::FilterGroup::Enum newGroup) noexcept
 	{
-		physx::PxFilterData filterData;
-		filterData.word0 = newGroup; // word0 = own ID
-		filterData.word1 = shape->getSimulationFilterData().word1;  // word1 = ID mask to filter pairs that trigger a
-										// contact callback;
-		shape->setSimulationFilterData(filterData);
+		key.filterData.word0 = newGroup; // word0 = own ID
+		Reshape();
 	}
 
 	Physic::FilterGroup::Enum ICollider::GetMyFilterGroup() noexcept
 	{
-		return (Physic::FilterGroup::Enum)shape->getSimulationFilterData().word0;
+		return (Physic::FilterGroup::Enum)key.filterData.word0;
 	}
 }
\ No newline at end of file
@@ -21,9 +21,9 @@ namespace Quantix::Core::Components
 	{
 		// Create Shape in physic
 		if (par->GetComponent<Rigidbody>())
-			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, true);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, true, key);
 		else
-			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, false);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, false, key);
 	}
 
 	CubeCollider::CubeCollider(const CubeCollider& other) noexcept :
@@ -36,16 +36,15 @@ namespace Quantix::Core::Components
 
 	Math::QXvec3 CubeCollider::GetHalfExtents() noexcept
 	{
-		physx::PxBoxGeometry box;
-		shape->getBoxGeometry(box);
-		physx::PxVec3 vec = box.halfExtents;
+		physx::PxVec3 vec = key.size;
 		return Math::QXvec3(vec.x, vec.y, vec.z);
 	}
 
 	void CubeCollider::SetHalfExtents(Math::QXvec3 vec) noexcept
 	{
 		scale = vec * 2;
-		shape->setGeometry(physx::PxBoxGeometry(vec.x, vec.y, vec.z));
+		key.size = physx::PxVec3(vec.x, vec.y, vec.z);
+		Reshape();
 	}
 
 	CubeCollider* CubeCollider::Copy() const
@@ -60,21 +59,22 @@ namespace Quantix::Core::Components
 		_isDestroyed = false;
 		_isEnable = true;
 
+		// Set Collider Group, on the key only as the shape is taken once it is complete
+		SetCollideFilterCrab(true);
+		SetCollideFilterMine(true);
+		SetCollideFilterPawn(true);
+		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
+
 		// Create shape and Init Pointer On Actor physic
 		if (par->GetComponent<Rigidbody>())
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, true);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, true, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, true);
 		}
 		else
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, false);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, false, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, false);
 		}
-
-		SetCollideFilterCrab(true);
-		SetCollideFilterMine(true);
-		SetCollideFilterPawn(true);
-		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "Core/Components/FractureMesh.h"
+#include "Core/Components/Mesh.h"
+#include "Core/DataStructure/ResourcesManager.h"
+#include "Core/Physic/PhysicHandler.h"
+
+RTTR_PLUGIN_REGISTRATION
+{
+	rttr::registration::class_<Quantix::Core::Components::FractureMesh>("FractureMesh")
+	.constructor<>()
+	.constructor<const Quantix::Core::Components::FractureMesh&>()
+	.constructor<Quantix::Core::Components::FractureMesh&&>()
+	.property("cubeSize", &Quantix::Core::Components::FractureMesh::cubeSize)
+	.property("numCubeInWidth", &Quantix::Core::Components::FractureMesh::numCubeInWidth)
+	.property("numCubeInHeight", &Quantix::Core::Components::FractureMesh::numCubeInHeight)
+	.property("numCubeInDepth", &Quantix::Core::Components::FractureMesh::numCubeInDepth)
+	.property("BreakForce", &Quantix::Core::Components::FractureMesh::GetBreakForce, &Quantix::Core::Components::FractureMesh::SetBreakForce)
+	.property("Density", &Quantix::Core::Components::FractureMesh::density)
+	.method("Generate", &Quantix::Core::Components::FractureMesh::Generate);
+}
+
+namespace Quantix::Core::Components
+{
+	FractureMesh* FractureMesh::Copy() const
+	{
+		FractureMesh* copy = new FractureMesh(*this);
+		copy->fracture = nullptr;
+
+		return copy;
+	}
+
+	void FractureMesh::Awake()
+	{
+		// Only the contacts break the block
+		Unsubscribe(Physic::EPhysicEvent::TRIGGER_ENTER);
+		Unsubscribe(Physic::EPhysicEvent::TRIGGER_EXIT);
+	}
+
+	void FractureMesh::OnPhysicEvent(const Physic::PhysicEvent& event)
+	{
+		if (fracture && event.type == Physic::EPhysicEvent::CONTACT && event.shape)
+			fracture->AddImpact(event.shape, event.impulse);
+	}
+
+	void FractureMesh::Generate(Resources::Scene* scene, Core::DataStructure::ResourcesManager* manager, QXbool fromLoad)
+	{
+		Physic::PhysicHandler* handler = Physic::PhysicHandler::GetInstance();
+		Core::DataStructure::GameObject3D* gameobject = (Core::DataStructure::GameObject3D*)_object;
+
+		if (fracture)
+		{
+			handler->ReleaseFracture(fracture);
+			fracture = nullptr;
+		}
+
+		// The cubes are drawn with the mesh of the object, loaded with it or added once
+		if (!fromLoad && !gameobject->GetComponent<Mesh>())
+		{
+			Core::Components::Mesh* mesh = gameobject->AddComponent<Mesh>();
+			mesh->Init(gameobject);
+			manager->CreateMesh(mesh, "media/Mesh/cube.obj");
+			mesh->SetMaterial(manager->CreateMaterial(FRACTURE_MATERIAL));
+		}
+		gameobject->SetLayer(Core::DataStructure::Layer::DESTRUCTIBLEMESH);
+
+		Math::QXvec3 position = gameobject->GetGlobalPosition();
+		Math::QXquaternion rotation = gameobject->GetGlobalRotation();
+		rotation = rotation.ConjugateQuaternion();
+
+		Physic::FractureDesc desc;
+		desc.width = numCubeInWidth;
+		desc.height = numCubeInHeight;
+		desc.depth = numCubeInDepth;
+		desc.voxelSize = cubeSize;
+		desc.breakForce = breakForce;
+		desc.density = density;
+		desc.pose = physx::PxTransform(physx::PxVec3(position.x, position.y, position.z), physx::PxQuat(rotation.v.x, rotation.v.y, rotation.v.z, rotation.w));
+		desc.userData = gameobject;
+		desc.owner = &fracture;
+
+		fracture = handler->CreateFracture(desc);
+	}
+
+	void FractureMesh::Destroy()
+	{
+		if (fracture)
+		{
+			Physic::PhysicHandler::GetInstance()->ReleaseFracture(fracture);
+			fracture = nullptr;
+		}
+	}
+}
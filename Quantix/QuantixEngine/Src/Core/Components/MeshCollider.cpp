@@ -0,0 +1,152 @@
+#include "Core/Components/MeshCollider.h"
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Components/Mesh.h"
+#include "Core/Components/Rigidbody.h"
+#include "Core/Physic/PhysicHandler.h"
+
+RTTR_PLUGIN_REGISTRATION
+{
+	rttr::registration::class_<Quantix::Core::Components::MeshCollider>("MeshCollider")
+		.constructor<>()
+		.constructor<Quantix::Core::DataStructure::GameComponent*>()
+		.constructor<const Quantix::Core::Components::MeshCollider&>()
+		.constructor<Quantix::Core::Components::MeshCollider&&>()
+		.property("Convex", &Quantix::Core::Components::MeshCollider::GetConvex, &Quantix::Core::Components::MeshCollider::SetConvex);
+}
+
+namespace Quantix::Core::Components
+{
+	MeshCollider::MeshCollider(DataStructure::GameComponent* par):
+		Component(par),
+		ICollider(par)
+	{
+		Physic::PhysicHandler::GetInstance()->AddMeshCollider(this);
+	}
+
+	MeshCollider::MeshCollider(const MeshCollider& other) noexcept :
+		ICollider(other),
+		mesh { other.mesh },
+		convex { other.convex }
+	{}
+
+	MeshCollider::MeshCollider(MeshCollider&& other) noexcept :
+		ICollider(other),
+		mesh { other.mesh },
+		convex { other.convex }
+	{}
+
+	void MeshCollider::SetConvex(QXbool b) noexcept
+	{
+		if (convex == b)
+			return;
+
+		convex = b;
+
+		if (_object == nullptr)
+			return;
+
+		// The shape of the old mesh stays until the new one is cooked
+		mesh = nullptr;
+		Physic::PhysicHandler::GetInstance()->AddMeshCollider(this);
+	}
+
+	MeshCollider* MeshCollider::Copy() const
+	{
+		return new MeshCollider(*this);
+	}
+
+	void MeshCollider::Init(DataStructure::GameComponent* par)
+	{
+		typeShape = ETypeShape::MESH;
+		_object = par;
+		_isDestroyed = false;
+		_isEnable = true;
+
+		// Set Collider Group, on the key only as the shape is taken once the mesh is cooked
+		SetCollideFilterCrab(true);
+		SetCollideFilterMine(true);
+		SetCollideFilterPawn(true);
+		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
+
+		if (par->GetComponent<Rigidbody>())
+			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, true);
+		else
+			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, false);
+
+		Physic::PhysicHandler::GetInstance()->AddMeshCollider(this);
+	}
+
+	void MeshCollider::Destroy()
+	{
+		Physic::PhysicHandler::GetInstance()->RemoveMeshCollider(this);
+		ICollider::Destroy();
+	}
+
+	QXbool MeshCollider::Attach() noexcept
+	{
+		Physic::PhysicHandler* handler = Physic::PhysicHandler::GetInstance();
+		QXbool has_rigidbody = _object->GetComponent<Rigidbody>() != nullptr;
+
+		if (mesh == nullptr)
+		{
+			Mesh* render = _object->GetComponent<Mesh>();
+			if (render == nullptr || render->GetModel() == nullptr)
+				return QX_FALSE;
+
+			Resources::Model* model = render->GetModel();
+			if (model->IsFailed())
+				return QX_TRUE;
+			if (!model->IsReady())
+				return QX_FALSE;
+
+			mesh = handler->GetCollisionMeshes().Request(model, convex || has_rigidbody);
+		}
+
+		Resources::EResourceStatus status = mesh->status.load();
+		if (status == Resources::EResourceStatus::FAILED)
+			return QX_TRUE;
+		if (status != Resources::EResourceStatus::READY)
+			return QX_FALSE;
+
+		key.type = mesh->convex ? physx::PxGeometryType::eCONVEXMESH : physx::PxGeometryType::eTRIANGLEMESH;
+		key.mesh = mesh->mesh;
+
+		// The mesh is drawn at the scale of the object
+		Math::QXvec3 object_scale = static_cast<DataStructure::GameObject3D*>(_object)->GetGlobalScale();
+		key.size = physx::PxVec3(object_scale.x, object_scale.y, object_scale.z);
+
+		if (shape)
+			Reshape();
+		else
+			shape = handler->CreateCollider(_object, has_rigidbody, key);
+
+		return QX_TRUE;
+	}
+
+	QXbool MeshCollider::Refresh() noexcept
+	{
+		if (mesh == nullptr)
+			return QX_FALSE;
+
+		// PhysX does not simulate a triangle mesh on a dynamic actor, a Rigidbody added later needs the convex hull
+		QXbool has_rigidbody = _object->GetComponent<Rigidbody>() != nullptr;
+		if (mesh->convex != (convex || has_rigidbody))
+		{
+			mesh = nullptr;
+			return QX_FALSE;
+		}
+
+		if (mesh->status.load() != Resources::EResourceStatus::READY)
+			return QX_TRUE;
+
+		Math::QXvec3 object_scale = static_cast<DataStructure::GameObject3D*>(_object)->GetGlobalScale();
+		physx::PxVec3 size(object_scale.x, object_scale.y, object_scale.z);
+		if (size != key.size)
+		{
+			key.size = size;
+			Reshape();
+		}
+
+		return QX_TRUE;
+	}
+}
@@ -39,12 +39,12 @@ namespace Quantix::Core::Components
 
 		if (par->GetComponent<Rigidbody>())
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, true);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, true, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, true);
 		}
 		else
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, false);
+			shape = Physic::PhysicHandler::GetInstance()->CreateCubeCollider(par, false, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, false);
 		}
 	}
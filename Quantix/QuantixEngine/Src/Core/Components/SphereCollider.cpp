@@ -22,9 +22,9 @@ namespace Quantix::Core::Components
 	{	
 		// Create Shape in physic
 		if (par->GetComponent<Rigidbody>())
-			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_TRUE);
+			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_TRUE, key);
 		else
-			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_FALSE);
+			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_FALSE, key);
 	}
 	
 	SphereCollider::SphereCollider(const SphereCollider& other) noexcept :
@@ -37,9 +37,7 @@ namespace Quantix::Core::Components
 
 	QXfloat SphereCollider::GetRadius() noexcept
 	{
-		physx::PxSphereGeometry sphere;
-		shape->getSphereGeometry(sphere);
-		return sphere.radius;
+		return key.size.x;
 	}
 
 	void SphereCollider::SetRadius(QXfloat f) noexcept
@@ -48,7 +46,8 @@ namespace Quantix::Core::Components
 		scale.y = f;
 		scale.z = f;
 
-		shape->setGeometry(physx::PxSphereGeometry(f));
+		key.size.x = f;
+		Reshape();
 	}
 
 	SphereCollider* SphereCollider::Copy() const
@@ -63,20 +62,22 @@ namespace Quantix::Core::Components
 		_isDestroyed = QX_FALSE;
 		_isEnable = QX_TRUE;
 
+		// Set Collider Group, on the key only as the shape is taken once it is complete
+		SetCollideFilterCrab(QX_TRUE);
+		SetCollideFilterMine(QX_TRUE);
+		SetCollideFilterPawn(QX_TRUE);
+		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
+
 		// Create shape and Init Pointer On Actor physic
 		if (par->GetComponent<Rigidbody>())
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_TRUE);
+			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_TRUE, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, QX_TRUE);
 		}
 		else
 		{
-			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_FALSE);
+			shape = Physic::PhysicHandler::GetInstance()->CreateSphereCollider(par, QX_FALSE, key);
 			actorPhysic = Physic::PhysicHandler::GetInstance()->GetObject(par, QX_FALSE);
 		}
-		SetCollideFilterCrab(QX_TRUE);
-		SetCollideFilterMine(QX_TRUE);
-		SetCollideFilterPawn(QX_TRUE);
-		SetMyFilterGroup(Physic::FilterGroup::eCRAB);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "Core/Components/Sprite.h"
+
+#include "Core/DataStructure/GameComponent.h"
+
+RTTR_PLUGIN_REGISTRATION
+{
+	rttr::registration::class_<Quantix::Core::Components::Sprite>("Sprite")
+	.constructor<>()
+	.constructor<const Quantix::Core::Components::Sprite&>()
+	.constructor<Quantix::Core::Components::Sprite&&>()
+	.property("Texture", &Quantix::Core::Components::Sprite::_texture)
+	.property("Color", &Quantix::Core::Components::Sprite::_color)
+	.property("Size", &Quantix::Core::Components::Sprite::_size)
+	.property("Layer", &Quantix::Core::Components::Sprite::_layer);
+}
+
+namespace Quantix::Core::Components
+{
+	Sprite* Sprite::Copy() const noexcept
+	{
+		return new Sprite(*this);
+	}
+
+	void Sprite::Init(Core::DataStructure::GameComponent* object) noexcept
+	{
+		_object = object;
+		object->SetRender(true);
+		_isDestroyed = false;
+		_isEnable = true;
+	}
+
+	QXbool Sprite::IsEnable() noexcept
+	{
+		if (_texture && !_texture->IsReady())
+			return false;
+
+		return _isEnable;
+	}
+}
@@ -1,4 +1,5 @@
 #include "Core/DataStructure/GameObject3D.h"
+#include "Core/DataStructure/ObjectPool.h"
 
 #include "Core/Components/CubeCollider.h"
 #include "Core/Components/SoundEmitter.h"
@@ -125,11 +126,19 @@ namespace Quantix::Core::DataStructure
 		for (auto it = list.begin(); it != list.end();)
 		{
 
-			(*it)->GetObject()->CheckDestroy(info);
+			GameObject3D* object = (*it)->GetObject();
+			object->CheckDestroy(info);
 
-			if ((*it)->GetObject()->toDestroy)
+			// An object of a pool is parked in it, its components and actor are reused by the next spawn
+			if (object->toDestroy && object->GetPool())
 			{
-				(*it)->GetObject()->Destroy();
+				object->toDestroy = false;
+				object->GetPool()->Release(object);
+				++it;
+			}
+			else if (object->toDestroy)
+			{
+				object->Destroy();
 				it = list.erase(it);
 			}
 			else
@@ -0,0 +1,130 @@
+#include "Core/DataStructure/ObjectPool.h"
+
+#include "Resources/Scene.h"
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Physic/PhysicHandler.h"
+
+namespace Quantix::Core::DataStructure
+{
+#pragma region Constructors
+
+	ObjectPool::ObjectPool(Resources::Scene* scene) noexcept :
+		_scene { scene }
+	{}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXuint ObjectPool::Register(const QXstring& name, const PrefabBuilder& build, const PrefabReset& reset) noexcept
+	{
+		QXuint prefab = Find(name);
+		if (prefab != POOL_NO_PREFAB)
+			return prefab;
+
+		Prefab entry;
+		entry.name = name;
+		entry.build = build;
+		entry.reset = reset;
+		_prefabs.push_back(std::move(entry));
+
+		return (QXuint)_prefabs.size() - 1;
+	}
+
+	QXuint ObjectPool::Find(const QXstring& name) const noexcept
+	{
+		for (QXsizei i = 0; i < _prefabs.size(); ++i)
+		{
+			if (_prefabs[i].name == name)
+				return (QXuint)i;
+		}
+
+		return POOL_NO_PREFAB;
+	}
+
+	GameObject3D* ObjectPool::Create(QXuint prefab) noexcept
+	{
+		GameObject3D* object = _scene->AddGameObject(_prefabs[prefab].name);
+		object->SetPool(this, prefab);
+
+		// The builder may register other prefabs, the entry is read once it is done
+		PrefabBuilder build = _prefabs[prefab].build;
+		build(object);
+
+		Prefab& entry = _prefabs[prefab];
+		if (entry.created == 0)
+		{
+			entry.render = object->GetRender();
+			entry.update = object->GetToUpdate();
+		}
+		entry.created++;
+
+		Park(object);
+		entry.parked.push_back(object);
+
+		return object;
+	}
+
+	void ObjectPool::Park(GameObject3D* object) noexcept
+	{
+		object->SetRender(QX_FALSE);
+		object->SetToUpdate(QX_FALSE);
+		object->SetParked(QX_TRUE);
+
+		Physic::PhysicHandler::GetInstance()->SetBodyEnabled(object, QX_FALSE);
+	}
+
+	void ObjectPool::Warm(QXuint prefab, QXsizei count) noexcept
+	{
+		if (prefab >= _prefabs.size())
+			return;
+
+		_prefabs[prefab].parked.reserve(count);
+
+		while (_prefabs[prefab].parked.size() < count)
+			Create(prefab);
+	}
+
+	GameObject3D* ObjectPool::Spawn(QXuint prefab, const Math::QXvec3& position, const Math::QXquaternion& rotation) noexcept
+	{
+		if (prefab >= _prefabs.size())
+			return nullptr;
+
+		// Only builds when the pool was not warmed enough
+		if (_prefabs[prefab].parked.empty())
+			Create(prefab);
+
+		Prefab& entry = _prefabs[prefab];
+		GameObject3D* object = entry.parked.back();
+		entry.parked.pop_back();
+
+		if (entry.reset)
+			entry.reset(object);
+
+		object->SetTransformValue(position, rotation, object->GetLocalScale());
+
+		// Enabled before the move, the velocities of a disabled actor can not be cleared
+		Physic::PhysicHandler* handler = Physic::PhysicHandler::GetInstance();
+		handler->SetBodyEnabled(object, QX_TRUE);
+		handler->TeleportBody(object, position, rotation);
+
+		object->SetRender(entry.render);
+		object->SetToUpdate(entry.update);
+		object->SetParked(QX_FALSE);
+
+		return object;
+	}
+
+	QXbool ObjectPool::Release(GameObject3D* object) noexcept
+	{
+		if (object == nullptr || object->GetPool() != this || object->IsParked())
+			return QX_FALSE;
+
+		Park(object);
+		_prefabs[object->GetPrefab()].parked.push_back(object);
+
+		return QX_TRUE;
+	}
+
+#pragma endregion
+}
@@ -49,6 +49,12 @@ namespace Quantix::Core::DataStructure
 			it = _textures.erase(it);
 		}
 
+		for (auto it = _environments.begin(); it != _environments.end();)
+		{
+			delete it->second;
+			it = _environments.erase(it);
+		}
+
 		for (auto it = _meshes.begin(); it != _meshes.end();)
 		{
 			delete it->second;
@@ -210,32 +216,37 @@ namespace Quantix::Core::DataStructure
 		return LoadScene(filepath);
 	}
 
-	ShaderProgram* ResourcesManager::CreateShaderProgram(const QXstring& vertexPath, const QXstring& fragmentPath, const QXstring& geometryPath) noexcept
+	ShaderProgram* ResourcesManager::CreateShaderProgram(const QXstring& vertexPath, const QXstring& fragmentPath, const QXstring& geometryPath,
+		const QXstring& defines) noexcept
 	{
-		auto it = _programs.find(vertexPath + fragmentPath + geometryPath);
+		std::lock_guard<std::recursive_mutex> lock(_programMutex);
+
+		auto it = _programs.find(vertexPath + fragmentPath + geometryPath + defines);
 		if (it != _programs.end() && it->second != nullptr)
 		{
 			return it->second;
 		}
 
-		ShaderProgram* program = new ShaderProgram(	CreateShader(vertexPath, EShaderType::VERTEX),
-													CreateShader(fragmentPath, EShaderType::FRAGMENT),
-													CreateShader(geometryPath, EShaderType::GEOMETRY));
+		ShaderProgram* program = new ShaderProgram(	CreateShader(vertexPath, EShaderType::VERTEX, defines),
+													CreateShader(fragmentPath, EShaderType::FRAGMENT, defines),
+													CreateShader(geometryPath, EShaderType::GEOMETRY, defines));
 		program->AddShaderPath(vertexPath);
 		program->AddShaderPath(fragmentPath);
 		if (geometryPath != "")
 		{
 			program->AddShaderPath(geometryPath);
-			_programs[vertexPath + fragmentPath + geometryPath] = program;
+			_programs[vertexPath + fragmentPath + geometryPath + defines] = program;
 		}
 		else
-			_programs[vertexPath + fragmentPath] = program;
+			_programs[vertexPath + fragmentPath + defines] = program;
 		return program;
 	}
 
-	Shader* ResourcesManager::CreateShader(const QXstring& filePath, EShaderType type) noexcept
+	Shader* ResourcesManager::CreateShader(const QXstring& filePath, EShaderType type, const QXstring& defines) noexcept
 	{
-		auto it = _shaders.find(filePath);
+		std::lock_guard<std::recursive_mutex> lock(_programMutex);
+
+		auto it = _shaders.find(filePath + defines);
 		if (it != _shaders.end() && it->second != nullptr)
 		{
 			return it->second;
@@ -244,11 +255,11 @@ namespace Quantix::Core::DataStructure
 		Shader* shader;
 
 		if (filePath != "")
-			shader = new Shader(filePath, type);
+			shader = new Shader(filePath, type, defines);
 		else
 			return nullptr;
 
-		_shaders[filePath] = shader;
+		_shaders[filePath + defines] = shader;
 		return shader;
 	}
 
@@ -282,6 +293,21 @@ namespace Quantix::Core::DataStructure
 		return texture;
 	}
 
+	Environment* ResourcesManager::CreateEnvironment(const QXstring& filePath) noexcept
+	{
+		auto it = _environments.find(filePath);
+		if (it != _environments.end() && it->second != nullptr)
+		{
+			return it->second;
+		}
+
+		Environment* environment = new Environment;
+		Threading::TaskSystem::GetInstance()->AddTask(&Environment::Load, environment, filePath);
+		_resourcesToBind.push_back(environment);
+		_environments[filePath] = environment;
+		return environment;
+	}
+
 	Material* ResourcesManager::LoadMaterialFromFbx(const QXstring& filePath) noexcept
 	{
 		Assimp::Importer Importer;
@@ -432,21 +458,7 @@ namespace Quantix::Core::DataStructure
 
 	void ResourcesManager::SaveModelToCache(const QXstring& filePath, Model* model) noexcept
 	{
-		QXstring cache_file = filePath + ".quantix";
-		FILE* file;
-
-		fopen_s(&file, cache_file.c_str(), "wb");
-
-		QXsizei vertex_count = model->GetVertices().size();
-		QXsizei index_count = model->GetIndices().size();
-
-		fwrite(&vertex_count, sizeof(QXsizei), 1, file);
-		fwrite(model->GetVertices().data(), sizeof(Vertex), vertex_count, file);
-
-		fwrite(&index_count, sizeof(QXsizei), 1, file);
-		fwrite(model->GetIndices().data(), sizeof(QXuint), index_count, file);
-
-		fclose(file);
+		model->SaveToCache(filePath);
 	}
 
 	void ResourcesManager::DeleteMaterial(const QXstring& filePath) noexcept
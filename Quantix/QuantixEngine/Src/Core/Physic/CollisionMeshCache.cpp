@@ -0,0 +1,198 @@
+#include "Core/Physic/CollisionMeshCache.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+#include "Resources/Model.h"
+#include "Core/Threading/TaskSystem.hpp"
+
+namespace Quantix::Core::Physic
+{
+	using namespace physx;
+
+#pragma region Constructors
+
+	CollisionMeshCache::CollisionMeshCache(PxPhysics* sdk, PxCooking* cooking) noexcept :
+		_sdk { sdk },
+		_cooking { cooking }
+	{}
+
+	CollisionMeshCache::~CollisionMeshCache() noexcept
+	{
+		// The tasks write their mesh and use the cooking released after the cache, the queued ones are started
+		for (CollisionMesh* mesh : _pending)
+		{
+			while (mesh->status.load() == Resources::EResourceStatus::DEFAULT)
+			{
+				Threading::TaskSystem::GetInstance()->Update();
+				std::this_thread::yield();
+			}
+		}
+
+		for (auto& it : _meshes)
+		{
+			CollisionMesh* mesh = it.second;
+
+			if (mesh->mesh)
+				mesh->mesh->release();
+			delete mesh;
+		}
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	CollisionMesh* CollisionMeshCache::Request(Resources::Model* model, QXbool convex) noexcept
+	{
+		auto it = _meshes.find({ model, convex });
+		if (it != _meshes.end())
+			return it->second;
+
+		CollisionMesh* mesh = new CollisionMesh;
+		mesh->convex = convex;
+
+		_meshes[{ model, convex }] = mesh;
+		_pending.push_back(mesh);
+
+		Threading::TaskSystem::GetInstance()->AddTask(&CollisionMeshCache::Cook, this, mesh, model);
+
+		return mesh;
+	}
+
+	void CollisionMeshCache::Cook(CollisionMesh* mesh, Resources::Model* model) noexcept
+	{
+		const std::vector<Resources::Vertex>& vertices = model->GetVertices();
+		const std::vector<QXuint>& indices = model->GetIndices();
+
+		if (vertices.empty() || (!mesh->convex && indices.size() < 3))
+		{
+			mesh->status.store(Resources::EResourceStatus::FAILED);
+			return;
+		}
+
+		// FNV-1a of the positions and the triangles, the other attributes do not change the collisions
+		PxU64 hash = 14695981039346656037ull;
+		auto hash_bytes = [&hash](const void* data, QXsizei size)
+		{
+			const PxU8* bytes = (const PxU8*)data;
+			for (QXsizei i = 0; i < size; ++i)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+		};
+
+		for (const Resources::Vertex& vertex : vertices)
+			hash_bytes(&vertex.position, sizeof(Math::QXvec3));
+		if (!mesh->convex)
+			hash_bytes(indices.data(), indices.size() * sizeof(QXuint));
+		mesh->hash = hash;
+
+		char name[64];
+		snprintf(name, sizeof(name), "%016llx_%d.%s", (unsigned long long)hash, COLLISION_MESH_VERSION, mesh->convex ? "convex" : "triangle");
+		QXstring path = QXstring(COLLISION_MESH_FOLDER) + name;
+
+		FILE* file;
+		fopen_s(&file, path.c_str(), "rb");
+
+		if (file != nullptr)
+		{
+			fseek(file, 0, SEEK_END);
+			long size = ftell(file);
+			fseek(file, 0, SEEK_SET);
+
+			if (size > 0)
+			{
+				mesh->stream.resize((QXsizei)size);
+				fread(mesh->stream.data(), 1, (QXsizei)size, file);
+			}
+			fclose(file);
+
+			if (!mesh->stream.empty())
+			{
+				mesh->status.store(Resources::EResourceStatus::LOADED);
+				return;
+			}
+		}
+
+		PxDefaultMemoryOutputStream output;
+		QXbool cooked;
+
+		if (mesh->convex)
+		{
+			PxConvexMeshDesc desc;
+			desc.points.count = (PxU32)vertices.size();
+			desc.points.stride = sizeof(Resources::Vertex);
+			desc.points.data = &vertices[0].position;
+			desc.flags = PxConvexFlag::eCOMPUTE_CONVEX;
+
+			cooked = _cooking->cookConvexMesh(desc, output);
+		}
+		else
+		{
+			PxTriangleMeshDesc desc;
+			desc.points.count = (PxU32)vertices.size();
+			desc.points.stride = sizeof(Resources::Vertex);
+			desc.points.data = &vertices[0].position;
+			desc.triangles.count = (PxU32)(indices.size() / 3);
+			desc.triangles.stride = sizeof(PxU32) * 3;
+			desc.triangles.data = indices.data();
+
+			cooked = _cooking->cookTriangleMesh(desc, output);
+		}
+
+		if (!cooked || output.getSize() == 0)
+		{
+			mesh->status.store(Resources::EResourceStatus::FAILED);
+			return;
+		}
+
+		mesh->stream.assign(output.getData(), output.getData() + output.getSize());
+
+		std::error_code error;
+		std::filesystem::create_directories(COLLISION_MESH_FOLDER, error);
+
+		fopen_s(&file, path.c_str(), "wb");
+		if (file != nullptr)
+		{
+			fwrite(mesh->stream.data(), 1, mesh->stream.size(), file);
+			fclose(file);
+		}
+
+		mesh->status.store(Resources::EResourceStatus::LOADED);
+	}
+
+	void CollisionMeshCache::Update() noexcept
+	{
+		for (auto it = _pending.begin(); it != _pending.end();)
+		{
+			CollisionMesh* mesh = *it;
+			Resources::EResourceStatus status = mesh->status.load();
+
+			if (status == Resources::EResourceStatus::DEFAULT)
+			{
+				++it;
+				continue;
+			}
+
+			if (status == Resources::EResourceStatus::LOADED)
+			{
+				PxDefaultMemoryInputData input(mesh->stream.data(), (PxU32)mesh->stream.size());
+
+				if (mesh->convex)
+					mesh->mesh = _sdk->createConvexMesh(input);
+				else
+					mesh->mesh = _sdk->createTriangleMesh(input);
+
+				std::vector<PxU8>().swap(mesh->stream);
+				mesh->status.store(mesh->mesh ? Resources::EResourceStatus::READY : Resources::EResourceStatus::FAILED);
+			}
+
+			it = _pending.erase(it);
+		}
+	}
+
+#pragma endregion
+}
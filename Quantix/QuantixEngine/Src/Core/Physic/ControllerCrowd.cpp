@@ -0,0 +1,202 @@
+#include "Core/Physic/ControllerCrowd.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Threading/JobSystem.h"
+
+namespace Quantix::Core::Physic
+{
+	using namespace physx;
+
+#pragma region Functions
+
+	QXuint ControllerCrowd::Add(PxCapsuleController* controller, Core::DataStructure::GameObject3D* object) noexcept
+	{
+		QXuint index;
+		if (_free.empty())
+		{
+			index = (QXuint)_agents.size();
+			_agents.emplace_back();
+		}
+		else
+		{
+			index = _free.back();
+			_free.pop_back();
+		}
+
+		Agent& agent = _agents[index];
+		agent.controller = controller;
+		agent.object = object;
+		agent.displacement = PxVec3(0.f);
+		agent.minDist = 0.f;
+		agent.elapsedTime = 0.f;
+		agent.collision = PxControllerCollisionFlags();
+		agent.pending = false;
+
+		return index;
+	}
+
+	QXbool ControllerCrowd::Remove(QXuint agent, PxCapsuleController* controller) noexcept
+	{
+		if (agent >= _agents.size() || _agents[agent].controller != controller || controller == nullptr)
+			return false;
+
+		// Its slot may be reused before the moves run
+		if (_agents[agent].pending)
+			_pending.erase(std::find(_pending.begin(), _pending.end(), agent));
+
+		_agents[agent].controller = nullptr;
+		_agents[agent].object = nullptr;
+		_agents[agent].pending = false;
+		_free.push_back(agent);
+
+		return true;
+	}
+
+	void ControllerCrowd::Move(QXuint agent, const PxVec3& displacement, PxF32 minDist, PxF32 elapsedTime) noexcept
+	{
+		if (agent >= _agents.size() || _agents[agent].controller == nullptr)
+			return;
+
+		Agent& moved = _agents[agent];
+		moved.displacement += displacement;
+		moved.minDist = minDist;
+		moved.elapsedTime += elapsedTime;
+
+		if (!moved.pending)
+		{
+			moved.pending = true;
+			_pending.push_back(agent);
+		}
+	}
+
+	void ControllerCrowd::MoveAgent(Agent& agent) noexcept
+	{
+		PxControllerFilters filters;
+		agent.collision = agent.controller->move(agent.displacement, agent.minDist, agent.elapsedTime, filters);
+
+		agent.displacement = PxVec3(0.f);
+		agent.elapsedTime = 0.f;
+		agent.pending = false;
+	}
+
+	void ControllerCrowd::Execute() noexcept
+	{
+		_orders.clear();
+		_cells.clear();
+
+		for (QXsizei i = 0; i < _pending.size(); ++i)
+		{
+			Agent& agent = _agents[_pending[i]];
+			PxCapsuleController* controller = agent.controller;
+
+			// The whole capsule whatever its up direction, grown like the volume the controller reads around its move
+			PxF32 reach = (controller->getRadius() + controller->getHeight() * 0.5f + controller->getContactOffset() + agent.displacement.magnitude()) * CROWD_VOLUME_GROWTH;
+			if (reach * 2.f >= CROWD_CELL_SIZE)
+			{
+				MoveAgent(agent);
+				continue;
+			}
+
+			PxExtendedVec3 position = controller->getPosition();
+			PxI32 x = (PxI32)floor(position.x / CROWD_CELL_SIZE);
+			PxI32 z = (PxI32)floor(position.z / CROWD_CELL_SIZE);
+
+			// Cells of the same parity on both axes are in the same pass
+			PxU64 pass = (PxU64)((x & 1) | ((z & 1) << 1));
+			PxU64 cell = (pass << 62) | (((PxU64)x & 0x7FFFFFFF) << 31) | ((PxU64)z & 0x7FFFFFFF);
+
+			_orders.push_back({ cell, _pending[i] });
+		}
+		_pending.clear();
+
+		std::sort(_orders.begin(), _orders.end(), [](const Order& a, const Order& b) { return a.cell < b.cell; });
+
+		for (QXsizei i = 0; i < _orders.size(); ++i)
+		{
+			if (i == 0 || _orders[i].cell != _orders[i - 1].cell)
+				_cells.push_back((QXuint)i);
+		}
+		_cells.push_back((QXuint)_orders.size());
+
+		// A controller only reads the ones of its cell and the cells around, the cells of a pass are moved side by side
+		QXsizei first = 0;
+		while (first + 1 < _cells.size())
+		{
+			PxU64 pass = _orders[_cells[first]].cell >> 62;
+			QXsizei last = first + 1;
+			while (last + 1 < _cells.size() && (_orders[_cells[last]].cell >> 62) == pass)
+				++last;
+
+			auto move_cells = [this, first](QXsizei begin, QXsizei end)
+			{
+				for (QXsizei i = first + begin; i < first + end; ++i)
+				{
+					for (QXuint j = _cells[i]; j < _cells[i + 1]; ++j)
+						MoveAgent(_agents[_orders[j].agent]);
+				}
+			};
+
+			if (_parallel)
+				Threading::JobSystem::GetInstance()->ParallelFor(last - first, CROWD_CELL_GRAIN, move_cells);
+			else
+				move_cells(0, last - first);
+
+			first = last;
+		}
+	}
+
+	void ControllerCrowd::WriteTransforms() noexcept
+	{
+		// Each agent writes the transform of its own object
+		Threading::JobSystem::GetInstance()->ParallelFor(_agents.size(), CROWD_WRITE_GRAIN, [this](QXsizei begin, QXsizei end)
+			{
+				for (QXsizei i = begin; i < end; ++i)
+				{
+					const Agent& agent = _agents[i];
+					if (agent.controller == nullptr)
+						continue;
+
+					PxExtendedVec3 pos = agent.controller->getPosition();
+					agent.object->GetTransform()->SetPosition(Math::QXvec3((QXfloat)pos.x, (QXfloat)pos.y, (QXfloat)pos.z));
+				}
+			});
+	}
+
+	void ControllerCrowd::ReadTransforms() noexcept
+	{
+		for (QXsizei i = 0; i < _agents.size(); ++i)
+		{
+			const Agent& agent = _agents[i];
+			if (agent.controller == nullptr)
+				continue;
+
+			Math::QXvec3 pos = agent.object->GetTransform()->GetPosition();
+
+			PxTransform transform = agent.controller->getActor()->getGlobalPose();
+			transform.p = PxVec3(pos.x, pos.y, pos.z);
+			agent.controller->getActor()->setGlobalPose(transform);
+		}
+	}
+
+	void ControllerCrowd::Clear() noexcept
+	{
+		_agents.clear();
+		_free.clear();
+		_pending.clear();
+		_orders.clear();
+		_cells.clear();
+	}
+
+	PxControllerCollisionFlags ControllerCrowd::GetCollision(QXuint agent) const noexcept
+	{
+		if (agent >= _agents.size() || _agents[agent].controller == nullptr)
+			return PxControllerCollisionFlags();
+
+		return _agents[agent].collision;
+	}
+
+#pragma endregion
+}
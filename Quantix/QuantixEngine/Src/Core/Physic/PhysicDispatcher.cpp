@@ -0,0 +1,68 @@
+#include "Core/Physic/PhysicDispatcher.h"
+
+#include <chrono>
+#include <string>
+
+#include "Core/Threading/JobSystem.h"
+#include "Core/Profiler/Profiler.h"
+
+namespace Quantix::Core::Physic
+{
+#pragma region Constructors
+
+	PhysicDispatcher::PhysicDispatcher() noexcept :
+		_busy(Threading::JobSystem::GetInstance()->GetWorkerCount() + 1),
+		_tasks(Threading::JobSystem::GetInstance()->GetWorkerCount() + 1)
+	{}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void PhysicDispatcher::Run(physx::PxBaseTask& task) noexcept
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+		task.run();
+		task.release();
+
+		QXsizei time = (QXsizei)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+		// The job system has no worker anymore or the task runs on the thread that submitted it
+		QXint worker = Threading::JobSystem::GetWorkerIndex();
+		QXsizei slot = worker >= 0 && (QXsizei)worker < _busy.size() - 1 ? (QXsizei)worker : _busy.size() - 1;
+
+		_busy[slot].fetch_add(time, std::memory_order_relaxed);
+		_tasks[slot].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void PhysicDispatcher::submitTask(physx::PxBaseTask& task)
+	{
+		// PhysX tasks never wait for each other, the next ones are submitted when a task ends
+		Threading::JobSystem::GetInstance()->Submit([this, &task] { Run(task); });
+	}
+
+	physx::PxU32 PhysicDispatcher::getWorkerCount() const
+	{
+		return (physx::PxU32)Threading::JobSystem::GetInstance()->GetWorkerCount();
+	}
+
+	void PhysicDispatcher::Report() noexcept
+	{
+		QXbool profiling = GETSTATE_PROFILING();
+
+		for (QXsizei i = 0; i < _busy.size(); ++i)
+		{
+			QXsizei time = _busy[i].exchange(0, std::memory_order_relaxed);
+			QXsizei tasks = _tasks[i].exchange(0, std::memory_order_relaxed);
+
+			if (!profiling || tasks == 0)
+				continue;
+
+			QXstring name = i + 1 < _busy.size() ? "PhysX Worker " + std::to_string(i) : "PhysX Other Threads";
+			Profiling::Profiler::GetInstance()->AddProfiling(name, time * 1e-9, std::to_string(tasks) + " tasks\n");
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,146 @@
+#include "Core/Physic/PhysicEvent.h"
+
+#include <algorithm>
+
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Components/Behaviour.h"
+
+namespace Quantix::Core::Physic
+{
+	/**
+	 * @brief Order of the events in a dispatch, by receiver then by pair and by shapes
+	 *
+	 * @param a first event
+	 * @param b second event
+	 * @return QXbool true if a is sent before b
+	 */
+	static QXbool Before(const PhysicEvent& a, const PhysicEvent& b) noexcept
+	{
+		if (a.receiver != b.receiver)
+			return a.receiver < b.receiver;
+		if (a.type != b.type)
+			return a.type < b.type;
+		if (a.other != b.other)
+			return a.other < b.other;
+		if (a.shape != b.shape)
+			return a.shape < b.shape;
+
+		return a.otherShape < b.otherShape;
+	}
+
+#pragma region Functions
+
+	void PhysicEventQueue::AddContact(Core::DataStructure::GameObject3D* object0, Core::DataStructure::GameObject3D* object1,
+										physx::PxShape* shape0, physx::PxShape* shape1, const Math::QXvec3& position, const Math::QXvec3& normal, QXfloat impulse) noexcept
+	{
+		if (impulse < _threshold)
+		{
+			_dropped++;
+			return;
+		}
+
+		PhysicEvent event;
+		event.type = EPhysicEvent::CONTACT;
+		event.position = position;
+		event.normal = normal;
+		event.impulse = impulse;
+
+		event.receiver = object0;
+		event.other = object1;
+		event.shape = shape0;
+		event.otherShape = shape1;
+		_events.push_back(event);
+
+		event.receiver = object1;
+		event.other = object0;
+		event.shape = shape1;
+		event.otherShape = shape0;
+		_events.push_back(event);
+	}
+
+	void PhysicEventQueue::AddTrigger(Core::DataStructure::GameObject3D* trigger, Core::DataStructure::GameObject3D* other, physx::PxShape* otherShape, QXbool enter) noexcept
+	{
+		PhysicEvent event;
+		event.type = enter ? EPhysicEvent::TRIGGER_ENTER : EPhysicEvent::TRIGGER_EXIT;
+		event.receiver = trigger;
+		event.other = other;
+		event.otherShape = otherShape;
+
+		_events.push_back(event);
+	}
+
+	void PhysicEventQueue::DispatchReceiver(QXsizei first, QXsizei last) noexcept
+	{
+		Core::DataStructure::GameObject3D* receiver = _events[first].receiver;
+		if (!receiver->GetToUpdate())
+			return;
+
+		// The behaviours are gathered once for every event of the receiver
+		_behaviours.clear();
+		for (Core::DataStructure::Component* component : receiver->GetComponents())
+		{
+			Core::Components::Behaviour* behaviour = dynamic_cast<Core::Components::Behaviour*>(component);
+			if (behaviour)
+				_behaviours.push_back(behaviour);
+		}
+
+		if (_behaviours.empty())
+			return;
+
+		for (QXsizei i = first; i < last; ++i)
+		{
+			PhysicEvent& event = _events[i];
+
+			if (_deduplicate)
+			{
+				// Merged into the strongest event of its pair on the same shapes, the last one of the run carries it. The
+				// shapes are kept apart so each piece of a compound sends or receives its own event
+				if (i + 1 < last && event.type == _events[i + 1].type && event.other == _events[i + 1].other &&
+					event.shape == _events[i + 1].shape && event.otherShape == _events[i + 1].otherShape)
+				{
+					if (event.impulse > _events[i + 1].impulse)
+						_events[i + 1] = event;
+					continue;
+				}
+			}
+
+			for (Core::Components::Behaviour* behaviour : _behaviours)
+			{
+				if (behaviour->IsSubscribed(event.type))
+					behaviour->OnPhysicEvent(event);
+			}
+
+			_dispatched++;
+		}
+	}
+
+	void PhysicEventQueue::Dispatch() noexcept
+	{
+		_dispatched = 0;
+
+		if (_events.empty())
+			return;
+
+		// Stable so the events of a pair keep the order of PhysX
+		std::stable_sort(_events.begin(), _events.end(), Before);
+
+		QXsizei first = 0;
+		for (QXsizei i = 1; i <= _events.size(); ++i)
+		{
+			if (i < _events.size() && _events[i].receiver == _events[first].receiver)
+				continue;
+
+			DispatchReceiver(first, i);
+			first = i;
+		}
+
+		_events.clear();
+	}
+
+	void PhysicEventQueue::Clear() noexcept
+	{
+		_events.clear();
+	}
+
+#pragma endregion
+}
@@ -8,10 +8,14 @@
 
 #include "Core/Physic/ControllerBehaviorCallback.h"
 #include "Core/Physic/ControllerHitReport.h"
+#include "Core/Components/MeshCollider.h"
 
 #include <vector>
+#include <algorithm>
+#include <chrono>
 
-#define PVD_HOST "127.0.0.1"	//Set this to the IP address of the system running the PhysX Visual Debugger that you want to connect to.
+#include "Core/Threading/JobSystem.h"
+#include "Core/Profiler/Profiler.h"
 
 RTTR_PLUGIN_REGISTRATION
 {
@@ -41,10 +45,38 @@ namespace Quantix::Core::Physic
 		{
 			pairFlags = physx::PxPairFlag::eCONTACT_DEFAULT;
 			pairFlags |= physx::PxPairFlag::eNOTIFY_TOUCH_FOUND;
+			pairFlags |= physx::PxPairFlag::eNOTIFY_CONTACT_POINTS;
 		}
 		return physx::PxFilterFlag::eDEFAULT;
 	}
 
+	/**
+	 * @brief Skip the actors parked out of the simulation in the immediate queries, like the batched ones
+	 */
+	class ParkedFilter : public PxQueryFilterCallback
+	{
+	private:
+		PxQueryHitType::Enum	_hitType;
+
+	public:
+		ParkedFilter(PxQueryHitType::Enum hitType) noexcept :
+			_hitType { hitType }
+		{}
+
+		PxQueryHitType::Enum preFilter(const PxFilterData&, const PxShape*, const PxRigidActor* actor, PxHitFlags&) override
+		{
+			if (actor->getActorFlags() & PxActorFlag::eDISABLE_SIMULATION)
+				return PxQueryHitType::eNONE;
+
+			return _hitType;
+		}
+
+		PxQueryHitType::Enum postFilter(const PxFilterData&, const PxQueryHit&) override
+		{
+			return _hitType;
+		}
+	};
+
 	PhysicHandler* PhysicHandler::_instance = nullptr;
 
 	PhysicHandler* PhysicHandler::GetInstance() noexcept
@@ -57,31 +89,45 @@ namespace Quantix::Core::Physic
 
 	PhysicHandler::~PhysicHandler()
 	{
-		for (auto it = _physObject.begin(); it != _physObject.end(); ++it)
-			delete it->second;
+		for (QXsizei i = 0; i < _bodies.size(); ++i)
+			delete _bodies[i].type;
 	}
 
 	IPhysicType* PhysicHandler::GetObject(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept
 	{
-		auto it = _physObject.find(object);
+		PhysicBody* body = FindBody(object);
 
 		// None ActorPhysic link at this GameObject
-		if (it == _physObject.end())
+		if (body == nullptr)
 			return CreateAndLinkActorPhysic(object, hasRigidbody);
 
-		else if (!hasRigidbody && it->second->GetType() == ETypePhysic::DYNAMIC)
+		else if (!hasRigidbody && body->type->GetType() == ETypePhysic::DYNAMIC)
 		{
 			// One ActorPhysic link at this GameObject but it is Dynamic
-			return SwapActorPhysicDynamicToStatic(object, it->second->GetObjectDynamic());
+			return SwapActorPhysicDynamicToStatic(object, body->type->GetObjectDynamic());
 		}
-		else if (hasRigidbody && it->second->GetType() == ETypePhysic::STATIC)
+		else if (hasRigidbody && body->type->GetType() == ETypePhysic::STATIC)
 		{
 			// One ActorPhysic link at this GameObject but it is Static
-			return SwapActorPhysicStaticToDynamic(object, it->second->GetObjectStatic());
+			return SwapActorPhysicStaticToDynamic(object, body->type->GetObjectStatic());
 		}
 
 		// Return PhysicActor Link to this GameComponent
-		return it->second;
+		return body->type;
+	}
+
+	PhysicHandler::PhysicBody* PhysicHandler::FindBody(Core::DataStructure::GameComponent* object) noexcept
+	{
+		Core::DataStructure::GameObject3D* gameObject = dynamic_cast<Core::DataStructure::GameObject3D*>(object);
+		if (gameObject == nullptr)
+			return nullptr;
+
+		// A copied object keeps the handle of its source, the body must point back to it
+		QXuint handle = gameObject->GetPhysicHandle();
+		if (handle >= _bodies.size() || _bodies[handle].object != gameObject)
+			return nullptr;
+
+		return &_bodies[handle];
 	}
 
 	IPhysicType* PhysicHandler::CreateAndLinkActorPhysic(Core::DataStructure::GameComponent* object, QXbool dynamic) noexcept
@@ -92,7 +138,7 @@ namespace Quantix::Core::Physic
 			PhysicDynamic* tmp = new PhysicDynamic(mSDK);
 			mScene->addActor(*tmp->GetRigid());
 			tmp->GetRigid()->userData = dynamic_cast<Core::DataStructure::GameObject3D*>(object);
-			_physObject.insert(std::make_pair((Core::DataStructure::GameComponent*)object, tmp));
+			LinkBody(object, tmp, tmp->GetRigid());
 			return tmp;
 		}
 		else
@@ -101,18 +147,125 @@ namespace Quantix::Core::Physic
 			PhysicStatic* tmp = new PhysicStatic(mSDK);
 			tmp->GetRigid()->userData = dynamic_cast<Core::DataStructure::GameObject3D*>(object);
 			mScene->addActor(*tmp->GetRigid());
-			_physObject.insert(std::make_pair((Core::DataStructure::GameComponent*)object, tmp));
+			LinkBody(object, tmp, tmp->GetRigid());
 			return tmp;
 		}
 	}
 
+	void PhysicHandler::LinkBody(Core::DataStructure::GameComponent* object, IPhysicType* type, PxRigidActor* actor) noexcept
+	{
+		Core::DataStructure::GameObject3D* gameObject = dynamic_cast<Core::DataStructure::GameObject3D*>(object);
+		PhysicBody* body = FindBody(object);
+
+		if (body == nullptr)
+		{
+			gameObject->SetPhysicHandle((QXuint)_bodies.size());
+			_bodies.emplace_back();
+			body = &_bodies.back();
+		}
+
+		PxTransform pose = actor->getGlobalPose();
+		*body = PhysicBody{ gameObject, type, actor, pose, pose, 0 };
+
+		// The new actor is placed on the object by the next editor sync
+		gameObject->GetTransform()->SetDirty(QX_TRUE);
+	}
+
+	void PhysicHandler::SetBodyEnabled(Core::DataStructure::GameComponent* object, QXbool enabled) noexcept
+	{
+		PhysicBody* body = FindBody(object);
+		if (body == nullptr)
+			return;
+
+		QueueChange({ enabled ? EBodyChange::ENABLE : EBodyChange::DISABLE, body->object->GetPhysicHandle(), body->actor, nullptr, PxTransform(PxIdentity) });
+	}
+
+	void PhysicHandler::TeleportBody(Core::DataStructure::GameComponent* object, const Math::QXvec3& position, const Math::QXquaternion& rotation) noexcept
+	{
+		PhysicBody* body = FindBody(object);
+		if (body == nullptr)
+			return;
+
+		Math::QXquaternion quat = rotation;
+		quat = quat.ConjugateQuaternion();
+
+		PxTransform pose(PxVec3(position.x, position.y, position.z), PxQuat(quat.v.x, quat.v.y, quat.v.z, quat.w));
+
+		// The object is drawn at its new place in this frame already
+		WriteTransform(*body, pose);
+
+		QueueChange({ EBodyChange::TELEPORT, body->object->GetPhysicHandle(), body->actor, nullptr, pose });
+	}
+
+	void PhysicHandler::QueueChange(const BodyChange& change) noexcept
+	{
+		if (mSimulating)
+			_changes.push_back(change);
+		else
+			ApplyChange(change);
+	}
+
+	void PhysicHandler::ApplyChange(const BodyChange& change) noexcept
+	{
+		if (change.type == EBodyChange::ATTACH)
+		{
+			change.actor->attachShape(*change.shape);
+			return;
+		}
+
+		if (change.type == EBodyChange::DETACH)
+		{
+			if (change.actor)
+				change.actor->detachShape(*change.shape);
+			mShapes->Release(change.shape);
+			return;
+		}
+
+		if (change.handle >= _bodies.size() || _bodies[change.handle].actor != change.actor)
+			return;
+
+		PhysicBody& body = _bodies[change.handle];
+
+		PxRigidDynamic* dynamic = body.actor->is<PxRigidDynamic>();
+		QXbool simulated = dynamic && !(dynamic->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC);
+
+		switch (change.type)
+		{
+		case EBodyChange::ENABLE:
+			body.actor->setActorFlag(PxActorFlag::eDISABLE_SIMULATION, false);
+			if (simulated)
+				dynamic->wakeUp();
+			break;
+
+		case EBodyChange::DISABLE:
+			body.actor->setActorFlag(PxActorFlag::eDISABLE_SIMULATION, true);
+			break;
+
+		case EBodyChange::TELEPORT:
+			body.actor->setGlobalPose(change.pose);
+			if (simulated && !(dynamic->getActorFlags() & PxActorFlag::eDISABLE_SIMULATION))
+			{
+				dynamic->setLinearVelocity(PxVec3(0.f));
+				dynamic->setAngularVelocity(PxVec3(0.f));
+			}
+
+			// Both poses are the new one, the next step moves the object from there
+			body.previous = change.pose;
+			body.current = change.pose;
+			body.step = mStepCount;
+			break;
+
+		default:
+			break;
+		}
+	}
+
 	IPhysicType* PhysicHandler::SwapActorPhysicStaticToDynamic(Core::DataStructure::GameComponent* object, PhysicStatic* staticActor) noexcept
 	{
 		PhysicDynamic* tmp = new PhysicDynamic(mSDK, staticActor);
 		mScene->removeActor(*staticActor->GetRigid());
 		mScene->addActor(*tmp->GetRigid());
-		_physObject.erase(object);
-		_physObject.insert(std::make_pair((Core::DataStructure::GameComponent*)object, tmp));
+		LinkBody(object, tmp, tmp->GetRigid());
 		return tmp;
 	}
 
@@ -121,62 +274,132 @@ namespace Quantix::Core::Physic
 		PhysicStatic* tmp = new PhysicStatic(mSDK, dynamicActor);
 		mScene->removeActor(*dynamicActor->GetRigid());
 		mScene->addActor(*tmp->GetRigid());
-		_physObject.erase(object);
-		_physObject.insert(std::make_pair((Core::DataStructure::GameComponent*)object, tmp));
+		LinkBody(object, tmp, tmp->GetRigid());
 		return tmp;
 	}
 
-	PxShape* PhysicHandler::CreateCubeCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept
+	PxShape* PhysicHandler::CreateCubeCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept
+	{
+		key.type = PxGeometryType::eBOX;
+		key.size = PxVec3(0.5f, 0.5f, 0.5f);
+
+		return CreateCollider(object, hasRigidbody, key);
+	}
+
+	PxShape* PhysicHandler::CreateSphereCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept
+	{
+		key.type = PxGeometryType::eSPHERE;
+		key.size = PxVec3(1.f, 1.f, 1.f);
+
+		return CreateCollider(object, hasRigidbody, key);
+	}
+
+	PxShape* PhysicHandler::CreateCapsuleCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept
+	{
+		key.type = PxGeometryType::eCAPSULE;
+		key.size = PxVec3(1.f, 1.f, 1.f);
+
+		return CreateCollider(object, hasRigidbody, key);
+	}
+
+	PxShape* PhysicHandler::CreateCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody, ShapeKey& key) noexcept
 	{
 		// Take ActorPhysic Link to the GameComponent
 		IPhysicType* physicType = GetObject(object, hasRigidbody);
 
-		// Create Shape With BoxGeometrie
-		PxShape* s = mSDK->createShape(PxBoxGeometry(0.5f, 0.5f, 0.5f), *mMaterial, QX_TRUE);
-		
+		if (key.material == nullptr)
+			key.material = mMaterial;
+
+		PxShape* s = mShapes->Acquire(key);
+		if (s == nullptr)
+			return nullptr;
+
 		// Attach the shape to the actor
+		PxRigidActor* actor;
 		if (hasRigidbody)
-			physicType->GetObjectDynamic()->GetRigid()->attachShape(*s);
+			actor = physicType->GetObjectDynamic()->GetRigid();
 		else
-			physicType->GetObjectStatic()->GetRigid()->attachShape(*s);
+			actor = physicType->GetObjectStatic()->GetRigid();
+
+		QueueChange({ EBodyChange::ATTACH, 0, actor, s, PxTransform(PxIdentity) });
 
 		return s;
 	}
 
-	PxShape* PhysicHandler::CreateSphereCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept
+	PxShape* PhysicHandler::EditCollider(Core::DataStructure::GameComponent* object, PxShape* shape, const ShapeKey& key) noexcept
 	{
-		// Take ActorPhysic Link to the GameComponent
-		IPhysicType* physicType = GetObject(object, hasRigidbody);
+		PhysicBody* body = FindBody(object);
+		if (body == nullptr)
+			return shape;
 
-		// Create Shape With SphereGeometrie
-		PxShape* s = mSDK->createShape(PxSphereGeometry(1.f), *mMaterial, QX_TRUE);
-		
-		// Attach the shape to the actor
-		if (hasRigidbody)
+		// Taken before the old one is given back, a shape used by this collider only is not made again
+		PxShape* s = mShapes->Acquire(key);
+		if (s == nullptr || s == shape)
 		{
-			physicType->GetObjectDynamic()->GetRigid()->attachShape(*s);
+			if (s)
+				mShapes->Release(s);
+			return shape;
 		}
-		else
-			physicType->GetObjectStatic()->GetRigid()->attachShape(*s);
+
+		QueueChange({ EBodyChange::DETACH, 0, body->actor, shape, PxTransform(PxIdentity) });
+		QueueChange({ EBodyChange::ATTACH, 0, body->actor, s, PxTransform(PxIdentity) });
 
 		return s;
 	}
 
-	PxShape* PhysicHandler::CreateCapsuleCollider(Core::DataStructure::GameComponent* object, QXbool hasRigidbody) noexcept
+	void PhysicHandler::ReleaseCollider(Core::DataStructure::GameComponent* object, PxShape* shape) noexcept
 	{
-		// Take ActorPhysic Link to the GameComponent
-		IPhysicType* physicType = GetObject(object, hasRigidbody);
+		PhysicBody* body = FindBody(object);
 
-		// Create Shape With CapsuleGeometrie
-		PxShape* s = mSDK->createShape(PxCapsuleGeometry(1.f, 1.f), *mMaterial, QX_TRUE);
-		
-		// Attach the shape to the actor
-		if (hasRigidbody)
-			physicType->GetObjectDynamic()->GetRigid()->attachShape(*s);
-		else
-			physicType->GetObjectStatic()->GetRigid()->attachShape(*s);
+		QueueChange({ EBodyChange::DETACH, 0, body ? body->actor : nullptr, shape, PxTransform(PxIdentity) });
+	}
 
-		return s;
+	void PhysicHandler::AddMeshCollider(Components::MeshCollider* collider) noexcept
+	{
+		if (std::find(mPendingMeshColliders.begin(), mPendingMeshColliders.end(), collider) == mPendingMeshColliders.end())
+			mPendingMeshColliders.push_back(collider);
+	}
+
+	void PhysicHandler::RemoveMeshCollider(Components::MeshCollider* collider) noexcept
+	{
+		auto it = std::find(mPendingMeshColliders.begin(), mPendingMeshColliders.end(), collider);
+		if (it != mPendingMeshColliders.end())
+			mPendingMeshColliders.erase(it);
+
+		it = std::find(mMeshColliders.begin(), mMeshColliders.end(), collider);
+		if (it != mMeshColliders.end())
+			mMeshColliders.erase(it);
+	}
+
+	void PhysicHandler::UpdateMeshColliders() noexcept
+	{
+		mCollisionMeshes->Update();
+
+		// A collider needing another mesh waits for it again, its shape stays until the mesh is cooked
+		for (auto it = mMeshColliders.begin(); it != mMeshColliders.end();)
+		{
+			if ((*it)->Refresh())
+			{
+				++it;
+				continue;
+			}
+
+			AddMeshCollider(*it);
+			it = mMeshColliders.erase(it);
+		}
+
+		for (auto it = mPendingMeshColliders.begin(); it != mPendingMeshColliders.end();)
+		{
+			if (!(*it)->Attach())
+			{
+				++it;
+				continue;
+			}
+
+			if ((*it)->shape && std::find(mMeshColliders.begin(), mMeshColliders.end(), *it) == mMeshColliders.end())
+				mMeshColliders.push_back(*it);
+			it = mPendingMeshColliders.erase(it);
+		}
 	}
 
 	void PhysicHandler::InitSystem() noexcept
@@ -186,10 +409,14 @@ namespace Quantix::Core::Physic
 		if (!pDefaultFundation)
 			std::cerr << "PxCreateFoundation failed!" << std::endl;
 
-		// Init PVD
-		pPvd = PxCreatePvd(*pDefaultFundation);
-		PxPvdTransport* transport = PxDefaultPvdSocketTransportCreate(PVD_HOST, 5425, 10);
-		pPvd->connect(*transport, PxPvdInstrumentationFlag::eALL);
+		// Init PVD, only when a debugger is given: the connection is tried at boot and slows it
+		if (!mPvdHost.empty())
+		{
+			pPvd = PxCreatePvd(*pDefaultFundation);
+			PxPvdTransport* transport = PxDefaultPvdSocketTransportCreate(mPvdHost.c_str(), PVD_PORT, PVD_TIMEOUT);
+			if (!pPvd->connect(*transport, PxPvdInstrumentationFlag::eALL))
+				std::cerr << "PhysX Visual Debugger not found at " << mPvdHost << std::endl;
+		}
 
 		// Init Physic
 		mSDK = PxCreatePhysics(PX_PHYSICS_VERSION, *pDefaultFundation, PxTolerancesScale(), recordMemoryAllocations, pPvd);
@@ -216,6 +443,11 @@ namespace Quantix::Core::Physic
 
 		InitScene();
 		manager = PxCreateControllerManager(*mScene);
+		// The controllers of the crowd are moved from several workers
+		manager->setLockingEnabled(true);
+
+		mShapes = new ShapeLibrary(mSDK);
+		mCollisionMeshes = new CollisionMeshCache(mSDK, mCooking);
 
 		// Init Default Material
 		mMaterial = mSDK->createMaterial(0.5f, 0.5f, 0.1f);
@@ -240,11 +472,10 @@ namespace Quantix::Core::Physic
 		sceneDesc.flags |= PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 		
 		sceneDesc.filterShader = &contactReportFilterShader;
-		sceneDesc.simulationEventCallback = new SimulationCallback();
+		sceneDesc.simulationEventCallback = new SimulationCallback(&mEvents);
 
-		mCpuDispatcher = PxDefaultCpuDispatcherCreate(4);
-		if (!mCpuDispatcher)
-			std::cerr << "PxDefaultCpuDispatcherCreate failed!";
+		// The solver runs on the workers of the engine, as many as the hardware threads
+		mCpuDispatcher = new PhysicDispatcher();
 		sceneDesc.cpuDispatcher = mCpuDispatcher;
 
 		mScene = mSDK->createScene(sceneDesc);
@@ -254,13 +485,33 @@ namespace Quantix::Core::Physic
 
 	void PhysicHandler::ReleaseSystem() noexcept
 	{
+		// The events of the last step are dropped with the objects
+		FetchSimulation();
+		mEvents.Clear();
+		mFetched = false;
+		StopRecording();
+
+		for (VoxelFracture* fracture : mFractures)
+			delete fracture;
+		mFractures.clear();
+
 		manager->purgeControllers();
 		manager->release();
+		mCrowd.Clear();
+
+		mPendingMeshColliders.clear();
+		mMeshColliders.clear();
+		delete mCollisionMeshes;
+		mCollisionMeshes = nullptr;
+		delete mShapes;
+		mShapes = nullptr;
+
 		mCooking->release();
 
 		PxCloseExtensions();
 
-		mCpuDispatcher->release();
+		delete mCpuDispatcher;
+		mCpuDispatcher = nullptr;
 		mSDK->release();
 
 		if (pPvd)
@@ -326,117 +577,252 @@ namespace Quantix::Core::Physic
 
 	void PhysicHandler::UpdateSystem(double deltaTime) noexcept
 	{
+		FetchSimulation();
+		DispatchEvents();
+
 		mAccumulator += (physx::PxReal)deltaTime;
-		if (mAccumulator < mStepSize)
+
+		PxU32 steps = (PxU32)(mAccumulator / mStepSize);
+		if (steps > mMaxSubsteps)
+		{
+			steps = mMaxSubsteps;
+			mAccumulator = (PxReal)steps * mStepSize;
+		}
+
+		for (PxU32 i = 0; i < steps; ++i)
+		{
+			mAccumulator -= mStepSize;
+
+			if (mRecorder)
+				mStepBegin = std::chrono::steady_clock::now();
+
+			mScene->simulate(mStepSize);
+			mSimulating = true;
+
+			// Only the last step overlaps the behaviours and the drawing of the frame
+			if (i + 1 < steps || !mAsyncSimulation)
+			{
+				FetchSimulation();
+				DispatchEvents();
+			}
+		}
+	}
+
+	void PhysicHandler::FetchSimulation() noexcept
+	{
+		if (!mSimulating)
 			return;
 
-		mAccumulator = 0.0f;
+		std::chrono::steady_clock::time_point fetch_begin = std::chrono::steady_clock::now();
 
-		mScene->simulate(PxReal(mStepSize));
+		// The events are added by the callbacks of the fetch
+		QXsizei events = mEvents.GetEventCount();
 
 		mScene->fetchResults(QX_TRUE);
+		mSimulating = false;
+		mFetched = true;
+
+		if (mRecorder)
+		{
+			std::chrono::steady_clock::time_point fetch_end = std::chrono::steady_clock::now();
+
+			// Read before the report restarts the count
+			QXdouble solver_time = 0.0;
+			for (QXsizei i = 0; i < mCpuDispatcher->GetSlotCount(); ++i)
+				solver_time += mCpuDispatcher->GetBusyTime(i);
+
+			mRecorder->BeginStep(mScene, mStepCount + 1,
+				std::chrono::duration<QXfloat>(fetch_end - mStepBegin).count(),
+				std::chrono::duration<QXfloat>(fetch_end - fetch_begin).count(),
+				(QXfloat)solver_time, (QXuint)(mEvents.GetEventCount() - events));
+		}
+
+		mCpuDispatcher->Report();
+
+		RecordPoses();
+
+		if (mRecorder)
+			mRecorder->EndStep();
+
+		// After the poses, a teleported body does not take back the pose of the step
+		for (QXsizei i = 0; i < _changes.size(); ++i)
+			ApplyChange(_changes[i]);
+		_changes.clear();
 	}
 
-	void PhysicHandler::UpdatePhysicActor(QXbool isPlaying) noexcept
+	void PhysicHandler::DispatchEvents() noexcept
 	{
-		if (isPlaying)
-			UpdatePlayingActor();
-		else
-			UpdateEditorActor();
+		if (!mFetched)
+			return;
+
+		mFetched = false;
+
+		// The scene is unlocked, the behaviours may touch the actors
+		START_PROFILING("PhysicEvents");
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+		mEvents.Dispatch();
+
+		mEventTime = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - begin).count();
+		STOP_PROFILING("PhysicEvents");
+
+		// The impacts were given to the blocks by the events
+		if (!mFractures.empty())
+		{
+			START_PROFILING("Fracture");
+			for (VoxelFracture* fracture : mFractures)
+				fracture->Update(mStepSize);
+			STOP_PROFILING("Fracture");
+		}
 	}
 
-	void PhysicHandler::UpdatePlayingActor() noexcept
+	void PhysicHandler::RecordPoses() noexcept
 	{
+		mStepCount++;
+
+		// Bodies not moved by this step are written once more with their final pose
+		for (QXsizei i = 0; i < _moving.size(); ++i)
+			_settled.push_back(_moving[i]);
+		_moving.clear();
+
 		PxU32 nbActors;
 		PxActor** listActor = mScene->getActiveActors(nbActors);
 
 		for (PxU32 index = 0; index < nbActors; index++)
 		{
-			PxRigidDynamic* currentActor = (PxRigidDynamic*)listActor[index];
-			if (currentActor)
-			{
-				PxTransform transformPhysic = currentActor->getGlobalPose();
-				transformPhysic.q = transformPhysic.q.getConjugate();
+			PxRigidActor* currentActor = listActor[index]->is<PxRigidActor>();
+			if (!currentActor || !currentActor->userData)
+				continue;
 
-				if (((Core::DataStructure::GameObject3D*)currentActor->userData))
-				{
-					// Set Transform GameObject On PhysicActor Transform
-					Transform3D* transform = ((Core::DataStructure::GameObject3D*)currentActor->userData)->GetTransform();
-					transform->SetPosition(Math::QXvec3(transformPhysic.p.x, transformPhysic.p.y, transformPhysic.p.z));
-					transform->SetRotation(Math::QXquaternion(transformPhysic.q.w, transformPhysic.q.x, transformPhysic.q.y, transformPhysic.q.z));
-				}
-			}
-		}
+			QXuint handle = ((Core::DataStructure::GameObject3D*)currentActor->userData)->GetPhysicHandle();
+			if (handle >= _bodies.size() || _bodies[handle].actor != currentActor)
+				continue;
 
-		// Update Controller : his linked GameObject follow the Controller Physic  
-		int numController = manager->getNbControllers();
-		for (int i = 0; i < numController; i++)
-		{
-			PxController* controller = manager->getController(i);
+			PhysicBody& body = _bodies[handle];
+			PxTransform pose = currentActor->getGlobalPose();
 
-			if (controller)
-			{
-				PxExtendedVec3 pos = controller->getPosition();
-				((Core::DataStructure::GameObject3D*)controller->getUserData())->GetTransform()->SetPosition(Math::QXvec3((QXfloat)pos.x, (QXfloat)pos.y, (QXfloat)pos.z));
-			}
+			if (mRecorder)
+				mRecorder->AddPose(handle, body.object, pose);
+
+			// A body waking up starts from its new pose, not from the one it fell asleep with
+			body.previous = body.step + 1 == mStepCount ? body.current : pose;
+			body.current = pose;
+			body.step = mStepCount;
+
+			_moving.push_back(handle);
 		}
 	}
 
-	void PhysicHandler::UpdateEditorActor() noexcept
+	void PhysicHandler::UpdatePhysicActor(QXbool isPlaying) noexcept
 	{
-		for (auto it = _physObject.begin(); it != _physObject.end(); ++it)
+		MoveControllers();
+
+		if (isPlaying)
+			UpdatePlayingActor();
+		else
+			UpdateEditorActor();
+	}
+
+	void PhysicHandler::MoveControllers() noexcept
+	{
+		START_PROFILING("Crowd");
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+		// The step was fetched, the controllers read the scene while they move
+		mCrowd.Execute();
+
+		mCrowdTime = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - begin).count();
+		STOP_PROFILING("Crowd");
+	}
+
+	void PhysicHandler::UpdatePlayingActor() noexcept
+	{
+		// Objects are drawn between their last two steps, one step behind the simulation. The step was started before the
+		// behaviours of the last frame, so what they changed is drawn two frames later
+		PxReal alpha = mInterpolate ? std::min(mAccumulator / mStepSize, 1.f) : 1.f;
+
+		for (QXsizei i = 0; i < _settled.size(); ++i)
 		{
-			if (it->second && it->first)
+			PhysicBody& body = _bodies[_settled[i]];
+
+			// Moved again by a later step, written with the moving bodies
+			if (body.step != mStepCount)
+				WriteTransform(body, body.current);
+		}
+		_settled.clear();
+
+		// Each body writes the transform of its own object, the moving bodies are written in parallel
+		Threading::JobSystem::GetInstance()->ParallelFor(_moving.size(), PHYSIC_WRITE_GRAIN, [this, alpha](QXsizei begin, QXsizei end)
 			{
-				// Set RigidBody Transform On GameOject Transform
-				Math::QXvec3 pos = ((Core::DataStructure::GameObject3D*)it->first)->GetTransform()->GetGlobalPosition();
-				Math::QXquaternion quat = ((Core::DataStructure::GameObject3D*)it->first)->GetLocalRotation();
-				quat = quat.ConjugateQuaternion();
-				if (it->second->GetType() == ETypePhysic::DYNAMIC)
+				for (QXsizei i = begin; i < end; ++i)
 				{
-					PxTransform transform = it->second->GetObjectDynamic()->GetRigid()->getGlobalPose();
+					PhysicBody& body = _bodies[_moving[i]];
+					if (body.step != mStepCount)
+						continue;
+
+					PxTransform transformPhysic;
+					transformPhysic.p = body.previous.p + (body.current.p - body.previous.p) * alpha;
 
-					transform.p = PxVec3(pos.x, pos.y, pos.z);
-					transform.q = PxQuat(quat.v.x, quat.v.y, quat.v.z, quat.w);
+					// Normalized lerp on the shortest arc, the rotation of one step is small
+					PxQuat to = body.previous.q.dot(body.current.q) < 0.f ? -body.current.q : body.current.q;
+					transformPhysic.q = (body.previous.q * (1.f - alpha) + to * alpha).getNormalized();
 
-					it->second->GetObjectDynamic()->GetRigid()->setGlobalPose(transform);
+					WriteTransform(body, transformPhysic);
 				}
-				else
-				{
-					PxTransform transform = it->second->GetObjectStatic()->GetRigid()->getGlobalPose();
+			});
 
-					transform.p = PxVec3(pos.x, pos.y, pos.z);
-					transform.q = PxQuat(quat.v.x, quat.v.y, quat.v.z, quat.w);
+		// Update Controller : his linked GameObject follow the Controller Physic
+		mCrowd.WriteTransforms();
+	}
 
-					it->second->GetObjectStatic()->GetRigid()->setGlobalPose(transform);
-				}
-			}
-		}
+	void PhysicHandler::WriteTransform(PhysicBody& body, const PxTransform& pose) noexcept
+	{
+		PxQuat q = pose.q.getConjugate();
 
-		// Update Controller : Controller Physic follow his linked GameObject
-		int numController = manager->getNbControllers();
-		for (int i = 0; i < numController; i++)
+		// Set Transform GameObject On PhysicActor Transform
+		Transform3D* transform = body.object->GetTransform();
+		transform->SetPosition(Math::QXvec3(pose.p.x, pose.p.y, pose.p.z));
+		transform->SetRotation(Math::QXquaternion(q.w, q.x, q.y, q.z));
+	}
+
+	void PhysicHandler::UpdateEditorActor() noexcept
+	{
+		for (QXsizei i = 0; i < _bodies.size(); ++i)
 		{
-			PxController* controller = manager->getController(i);
+			PhysicBody& body = _bodies[i];
 
-			if (controller)
-			{
-				Math::QXvec3 pos = ((Core::DataStructure::GameObject3D*)controller->getUserData())->GetTransform()->GetPosition();
+			// Only the objects moved since their last sync, an idle editor pushes no pose
+			Transform3D* transform = body.object->GetTransform();
+			if (!transform->IsDirty())
+				continue;
 
-				PxTransform transform = controller->getActor()->getGlobalPose();
+			// Set RigidBody Transform On GameOject Transform
+			Math::QXvec3 pos = transform->GetGlobalPosition();
+			Math::QXquaternion quat = body.object->GetLocalRotation();
+			quat = quat.ConjugateQuaternion();
 
-				transform.p = PxVec3(pos.x, pos.y, pos.z);
+			PxTransform pose = body.actor->getGlobalPose();
+			pose.p = PxVec3(pos.x, pos.y, pos.z);
+			pose.q = PxQuat(quat.v.x, quat.v.y, quat.v.z, quat.w);
+			body.actor->setGlobalPose(pose);
 
-				controller->getActor()->setGlobalPose(transform);
-			}
+			transform->SetDirty(QX_FALSE);
 		}
+
+		// Update Controller : Controller Physic follow his linked GameObject
+		mCrowd.ReadTransforms();
 	}
 
 	void PhysicHandler::Raycast(const Math::QXvec3& origin, const Math::QXvec3& unitDir, QXfloat distMax, Physic::Raycast& ownRaycast) noexcept 
 	{
 		PxRaycastBuffer hitRaycast; // resultat du ray cast apres test
 
-		ownRaycast.status = mScene->raycast(PxVec3(origin.x, origin.y, origin.z), PxVec3(unitDir.x, unitDir.y, unitDir.z), distMax, hitRaycast);
+		PxQueryFilterData fd;
+		fd.flags |= PxQueryFlag::ePREFILTER;
+		ParkedFilter filter(PxQueryHitType::eBLOCK);
+
+		ownRaycast.status = mScene->raycast(PxVec3(origin.x, origin.y, origin.z), PxVec3(unitDir.x, unitDir.y, unitDir.z), distMax, hitRaycast,
+											PxHitFlag::eDEFAULT, fd, &filter);
 		if (ownRaycast.status && hitRaycast.hasBlock)
 		{
 			// Load Own Raycast Struct
@@ -457,20 +843,52 @@ namespace Quantix::Core::Physic
 		PxSphereGeometry overlapGeometrie = PxSphereGeometry(radius);
 
 		PxQueryFilterData fd;
-		fd.flags |= PxQueryFlag::eNO_BLOCK;
+		fd.flags |= PxQueryFlag::eNO_BLOCK | PxQueryFlag::ePREFILTER;
+		ParkedFilter filter(PxQueryHitType::eTOUCH);
 
 		PxOverlapHit hitBuffer[256];
 		PxOverlapBuffer hit(hitBuffer, 256);
 
-		QXbool status = mScene->overlap(overlapGeometrie, shapePosition, hit, fd);
+		QXbool status = mScene->overlap(overlapGeometrie, shapePosition, hit, fd, &filter);
 		std::vector<Core::DataStructure::GameObject3D*> list;
 		for (QXuint i = 0; i < hit.nbTouches; i++)
 				list.push_back((Core::DataStructure::GameObject3D*)(hit.touches[i].actor->userData));
 		return list;
 	}
 
+	void PhysicHandler::ExecuteQueries() noexcept
+	{
+		START_PROFILING("SceneQueries");
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+		mQueries[mQueryIndex].Execute(mScene);
+
+		mQueryTime = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - begin).count();
+		STOP_PROFILING("SceneQueries");
+
+		mQueryIndex = 1 - mQueryIndex;
+		mQueries[mQueryIndex].Clear();
+		mQueryFrame++;
+	}
+
 	void PhysicHandler::CleanScene() noexcept
 	{
+		// The events of the last step are dropped with the objects
+		FetchSimulation();
+		mEvents.Clear();
+		mFetched = false;
+		_moving.clear();
+		_settled.clear();
+
+		// The objects of the scene are still alive, their blocks must not be reached once deleted
+		for (VoxelFracture* fracture : mFractures)
+		{
+			if (fracture->GetDesc().owner)
+				*fracture->GetDesc().owner = nullptr;
+			delete fracture;
+		}
+		mFractures.clear();
+
 		// Remove Actor Dynamic
 		int numActorsDynamic = mScene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC);
 		PxActor** actorsDyna = (PxActor**)malloc(sizeof(PxActor*) * numActorsDynamic);
@@ -487,11 +905,63 @@ namespace Quantix::Core::Physic
 
 		// Remove Controller
 		manager->purgeControllers();
+		mCrowd.Clear();
 	}
 
-	void PhysicHandler::CleanController(PxCapsuleController* controller) noexcept
+	VoxelFracture* PhysicHandler::CreateFracture(FractureDesc desc) noexcept
 	{
-		manager->purgeControllers();
+		// Added while a step runs, PhysX buffers the actors of the block until the step is fetched
+		// Same groups as the colliders, the voxels collide with everything
+		if (desc.filterData.word0 == 0)
+		{
+			desc.filterData.word0 = FilterGroup::eCRAB;
+			desc.filterData.word1 = FilterGroup::eCRAB | FilterGroup::PAWN | FilterGroup::eMINE_HEAD;
+		}
+
+		VoxelFracture* fracture = new VoxelFracture(mSDK, mScene, mMaterial, desc);
+		mFractures.push_back(fracture);
+
+		return fracture;
+	}
+
+	void PhysicHandler::ReleaseFracture(VoxelFracture* fracture) noexcept
+	{
+		std::vector<VoxelFracture*>::iterator it = std::find(mFractures.begin(), mFractures.end(), fracture);
+		if (it == mFractures.end())
+			return;
+
+		// Its actors are released by PhysX once the step running is fetched
+		mFractures.erase(it);
+		delete fracture;
+	}
+
+	QXbool PhysicHandler::StartRecording(const QXstring& filePath, QXbool poses) noexcept
+	{
+		// The step running was not timed from its start
+		FetchSimulation();
+		StopRecording();
+
+		mRecorder = new PhysicRecorder(filePath, mStepSize, poses);
+		if (!mRecorder->IsOpen())
+		{
+			StopRecording();
+			return false;
+		}
+
+		return true;
+	}
+
+	void PhysicHandler::StopRecording() noexcept
+	{
+		delete mRecorder;
+		mRecorder = nullptr;
+	}
+
+	void PhysicHandler::CleanController(PxCapsuleController* controller, QXuint agent) noexcept
+	{
+		// Already released if the scene was cleaned since
+		if (mCrowd.Remove(agent, controller))
+			controller->release();
 	}
 
 #pragma region FlagSetters
@@ -0,0 +1,128 @@
+#include "Core/Physic/PhysicRecorder.h"
+
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Debugger/Logger.h"
+
+namespace Quantix::Core::Physic
+{
+	using namespace physx;
+
+#pragma region Constructors
+
+	PhysicRecorder::PhysicRecorder(const QXstring& filePath, QXfloat stepSize, QXbool poses) noexcept :
+		_stream { filePath, std::ios::binary | std::ios::trunc },
+		_poses { poses }
+	{
+		if (!_stream)
+		{
+			LOG(ERROR, "physic capture can not be written in " + filePath);
+			return;
+		}
+
+		PhysicCaptureHeader header;
+		header.stepSize = stepSize;
+		header.poses = poses ? 1 : 0;
+
+		_stream.write((const char*)&header, sizeof(header));
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void PhysicRecorder::Append(const void* data, QXsizei size) noexcept
+	{
+		const QXbyte* bytes = (const QXbyte*)data;
+		_buffer.insert(_buffer.end(), bytes, bytes + size);
+	}
+
+	void PhysicRecorder::BeginStep(PxScene* scene, QXuint step, QXfloat stepTime, QXfloat waitTime, QXfloat solverTime, QXuint events) noexcept
+	{
+		PxSimulationStatistics stats;
+		scene->getSimulationStatistics(stats);
+
+		_step = PhysicStepRecord();
+		_step.step = step;
+		_step.stepTime = stepTime;
+		_step.waitTime = waitTime;
+		_step.solverTime = solverTime;
+
+		_step.dynamicBodies = stats.nbDynamicBodies;
+		_step.staticBodies = stats.nbStaticBodies;
+		_step.activeDynamicBodies = stats.nbActiveDynamicBodies;
+		_step.activeKinematicBodies = stats.nbActiveKinematicBodies;
+		_step.activeConstraints = stats.nbActiveConstraints;
+		_step.axisConstraints = stats.nbAxisSolverConstraints;
+		_step.partitions = stats.nbPartitions;
+
+		_step.broadPhaseAdds = stats.getNbBroadPhaseAdds();
+		_step.broadPhaseRemoves = stats.getNbBroadPhaseRemoves();
+		_step.newPairs = stats.nbNewPairs;
+		_step.lostPairs = stats.nbLostPairs;
+
+		_step.contactPairs = stats.nbDiscreteContactPairsTotal;
+		_step.cacheHits = stats.nbDiscreteContactPairsWithCacheHits;
+		_step.touchingPairs = stats.nbDiscreteContactPairsWithContacts;
+		_step.newTouches = stats.nbNewTouches;
+		_step.lostTouches = stats.nbLostTouches;
+
+		_step.events = events;
+
+		_stepPoses.clear();
+		_buffer.clear();
+	}
+
+	void PhysicRecorder::AddPose(QXuint body, Core::DataStructure::GameObject3D* object, const PxTransform& pose) noexcept
+	{
+		if (!_poses || !IsOpen())
+			return;
+
+		if (body >= _named.size())
+			_named.resize(body + 1, nullptr);
+
+		// Named before the step, the replay knows the body when it reads its pose
+		if (_named[body] != object)
+		{
+			_named[body] = object;
+
+			QXstring name = object->GetName();
+			QXuint tag = (QXuint)ECaptureRecord::BODY;
+			QXuint length = (QXuint)name.size();
+
+			Append(&tag, sizeof(tag));
+			Append(&body, sizeof(body));
+			Append(&length, sizeof(length));
+			Append(name.data(), length);
+		}
+
+		PhysicPoseRecord record;
+		record.body = body;
+		record.position[0] = pose.p.x;
+		record.position[1] = pose.p.y;
+		record.position[2] = pose.p.z;
+		record.rotation[0] = pose.q.x;
+		record.rotation[1] = pose.q.y;
+		record.rotation[2] = pose.q.z;
+		record.rotation[3] = pose.q.w;
+
+		_stepPoses.push_back(record);
+	}
+
+	void PhysicRecorder::EndStep() noexcept
+	{
+		if (!IsOpen())
+			return;
+
+		_step.poseCount = (QXuint)_stepPoses.size();
+
+		QXuint tag = (QXuint)ECaptureRecord::STEP;
+		Append(&tag, sizeof(tag));
+		Append(&_step, sizeof(_step));
+		Append(_stepPoses.data(), _stepPoses.size() * sizeof(PhysicPoseRecord));
+
+		_stream.write((const char*)_buffer.data(), _buffer.size());
+		_buffer.clear();
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,314 @@
+#include "Core/Physic/PhysicReplay.h"
+
+#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "Core/Debugger/Logger.h"
+
+namespace Quantix::Core::Physic
+{
+#pragma region Functions
+
+	QXbool PhysicReplay::Load(const QXstring& filePath) noexcept
+	{
+		std::ifstream stream(filePath, std::ios::binary);
+		if (!stream)
+		{
+			LOG(ERROR, "physic capture can not be read: " + filePath);
+			return false;
+		}
+
+		_filePath = filePath;
+		_steps.clear();
+		_firstPoses.clear();
+		_poses.clear();
+		_names.clear();
+
+		if (!stream.read((char*)&_header, sizeof(_header)) || _header.magic != PHYSIC_CAPTURE_MAGIC || _header.version != PHYSIC_CAPTURE_VERSION)
+		{
+			LOG(ERROR, "not a physic capture of version " + std::to_string(PHYSIC_CAPTURE_VERSION) + ": " + filePath);
+			return false;
+		}
+
+		QXuint tag;
+		QXbool cut = false;
+		while (!cut && stream.read((char*)&tag, sizeof(tag)))
+		{
+			if (tag == (QXuint)ECaptureRecord::BODY)
+			{
+				QXuint body;
+				QXuint length;
+				if (!stream.read((char*)&body, sizeof(body)) || !stream.read((char*)&length, sizeof(length)))
+				{
+					cut = true;
+					continue;
+				}
+
+				QXstring name(length, '\0');
+				if (length > 0 && !stream.read(&name[0], length))
+				{
+					cut = true;
+					continue;
+				}
+
+				if (body >= _names.size())
+					_names.resize(body + 1);
+				_names[body] = name;
+			}
+			else if (tag == (QXuint)ECaptureRecord::STEP)
+			{
+				PhysicStepRecord step;
+				if (!stream.read((char*)&step, sizeof(step)))
+				{
+					cut = true;
+					continue;
+				}
+
+				QXsizei first = _poses.size();
+				_poses.resize(first + step.poseCount);
+				if (!stream.read((char*)(_poses.data() + first), step.poseCount * sizeof(PhysicPoseRecord)))
+				{
+					_poses.resize(first);
+					cut = true;
+					continue;
+				}
+
+				_firstPoses.push_back((QXuint)first);
+				_steps.push_back(step);
+			}
+			else
+				cut = true;
+		}
+
+		// A capture of a process which stopped keeps its last whole step
+		if (cut)
+			LOG(WARNING, "physic capture cut after " + std::to_string(_steps.size()) + " steps: " + filePath);
+		_firstPoses.push_back((QXuint)_poses.size());
+
+		// The solver time only holds the work of the step, the step time also holds the frame it ran behind
+		std::vector<QXfloat> times(_steps.size());
+		for (QXsizei i = 0; i < _steps.size(); ++i)
+			times[i] = _steps[i].solverTime;
+
+		if (!times.empty())
+		{
+			std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+			_spikeTime = times[times.size() / 2] * PHYSIC_REPLAY_SPIKE_FACTOR;
+		}
+
+		return true;
+	}
+
+	QXbool PhysicReplay::WriteSummary(const QXstring& filePath) const noexcept
+	{
+		std::ofstream stream(filePath);
+		if (!stream)
+		{
+			LOG(ERROR, "physic summary can not be written in " + filePath);
+			return false;
+		}
+
+		auto average = [this](QXfloat PhysicStepRecord::* field)
+		{
+			QXdouble total = 0.0;
+			for (QXsizei i = 0; i < _steps.size(); ++i)
+				total += _steps[i].*field;
+			return _steps.empty() ? 0.0 : total / _steps.size();
+		};
+
+		auto percentile = [this](QXfloat PhysicStepRecord::* field, QXdouble rank)
+		{
+			if (_steps.empty())
+				return 0.f;
+
+			std::vector<QXfloat> values(_steps.size());
+			for (QXsizei i = 0; i < _steps.size(); ++i)
+				values[i] = _steps[i].*field;
+			std::sort(values.begin(), values.end());
+			return values[std::min(values.size() - 1, (QXsizei)(rank * values.size()))];
+		};
+
+		auto peak = [this](QXuint PhysicStepRecord::* field)
+		{
+			QXuint value = 0;
+			for (QXsizei i = 0; i < _steps.size(); ++i)
+				value = std::max(value, _steps[i].*field);
+			return value;
+		};
+
+		// Times are written in milliseconds
+		const QXdouble ms = 1000.0;
+
+		// Steps with the longest solver, and the bodies and cells moving during the spikes
+		std::vector<QXsizei> slowest(_steps.size());
+		for (QXsizei i = 0; i < slowest.size(); ++i)
+			slowest[i] = i;
+		QXsizei slow_count = std::min(slowest.size(), (QXsizei)PHYSIC_REPLAY_HOT_COUNT);
+		std::partial_sort(slowest.begin(), slowest.begin() + slow_count, slowest.end(),
+			[this](QXsizei a, QXsizei b) { return _steps[a].solverTime > _steps[b].solverTime; });
+
+		std::map<QXuint, QXuint>					bodies;
+		std::map<std::pair<QXint, QXint>, QXuint>	cells;
+		QXsizei										spikes = 0;
+
+		for (QXsizei i = 0; i < _steps.size(); ++i)
+		{
+			if (!IsSpike(_steps[i]))
+				continue;
+
+			spikes++;
+
+			const PhysicPoseRecord* poses = GetPoses(i);
+			for (QXuint j = 0; j < _steps[i].poseCount; ++j)
+			{
+				bodies[poses[j].body]++;
+
+				QXint x = (QXint)floorf(poses[j].position[0] / PHYSIC_REPLAY_CELL_SIZE);
+				QXint z = (QXint)floorf(poses[j].position[2] / PHYSIC_REPLAY_CELL_SIZE);
+				cells[{ x, z }]++;
+			}
+		}
+
+		std::vector<std::pair<QXuint, QXuint>> hot_bodies(bodies.begin(), bodies.end());
+		std::vector<std::pair<std::pair<QXint, QXint>, QXuint>> hot_cells(cells.begin(), cells.end());
+
+		auto by_count = [](const auto& a, const auto& b) { return a.second > b.second; };
+		std::sort(hot_bodies.begin(), hot_bodies.end(), by_count);
+		std::sort(hot_cells.begin(), hot_cells.end(), by_count);
+		hot_bodies.resize(std::min(hot_bodies.size(), (QXsizei)PHYSIC_REPLAY_HOT_COUNT));
+		hot_cells.resize(std::min(hot_cells.size(), (QXsizei)PHYSIC_REPLAY_HOT_COUNT));
+
+		stream << "{\n";
+		stream << "\t\"capture\": \"" << _filePath << "\",\n";
+		stream << "\t\"stepSize\": " << _header.stepSize * ms << ",\n";
+		stream << "\t\"steps\": " << _steps.size() << ",\n";
+		stream << "\t\"poses\": " << (_header.poses ? "true" : "false") << ",\n";
+
+		stream << "\t\"stepTime\": { \"average\": " << average(&PhysicStepRecord::stepTime) * ms << ", \"p95\": " << percentile(&PhysicStepRecord::stepTime, 0.95) * ms
+			<< ", \"max\": " << percentile(&PhysicStepRecord::stepTime, 1.0) * ms << " },\n";
+		stream << "\t\"waitTime\": { \"average\": " << average(&PhysicStepRecord::waitTime) * ms << ", \"p95\": " << percentile(&PhysicStepRecord::waitTime, 0.95) * ms
+			<< ", \"max\": " << percentile(&PhysicStepRecord::waitTime, 1.0) * ms << " },\n";
+		stream << "\t\"solverTime\": { \"average\": " << average(&PhysicStepRecord::solverTime) * ms << ", \"p95\": " << percentile(&PhysicStepRecord::solverTime, 0.95) * ms
+			<< ", \"max\": " << percentile(&PhysicStepRecord::solverTime, 1.0) * ms << " },\n";
+
+		stream << "\t\"spikeTime\": " << _spikeTime * ms << ",\n";
+		stream << "\t\"spikes\": " << spikes << ",\n";
+
+		stream << "\t\"peaks\": {\n";
+		stream << "\t\t\"activeDynamicBodies\": " << peak(&PhysicStepRecord::activeDynamicBodies) << ",\n";
+		stream << "\t\t\"activeConstraints\": " << peak(&PhysicStepRecord::activeConstraints) << ",\n";
+		stream << "\t\t\"partitions\": " << peak(&PhysicStepRecord::partitions) << ",\n";
+		stream << "\t\t\"broadPhaseAdds\": " << peak(&PhysicStepRecord::broadPhaseAdds) << ",\n";
+		stream << "\t\t\"newPairs\": " << peak(&PhysicStepRecord::newPairs) << ",\n";
+		stream << "\t\t\"contactPairs\": " << peak(&PhysicStepRecord::contactPairs) << ",\n";
+		stream << "\t\t\"touchingPairs\": " << peak(&PhysicStepRecord::touchingPairs) << ",\n";
+		stream << "\t\t\"events\": " << peak(&PhysicStepRecord::events) << "\n";
+		stream << "\t},\n";
+
+		stream << "\t\"slowestSteps\": [\n";
+		for (QXsizei i = 0; i < slow_count; ++i)
+		{
+			const PhysicStepRecord& step = _steps[slowest[i]];
+
+			stream << "\t\t{ \"step\": " << step.step << ", \"stepTime\": " << step.stepTime * ms << ", \"waitTime\": " << step.waitTime * ms
+				<< ", \"solverTime\": " << step.solverTime * ms << ", \"activeDynamicBodies\": " << step.activeDynamicBodies
+				<< ", \"activeConstraints\": " << step.activeConstraints << ", \"partitions\": " << step.partitions
+				<< ", \"broadPhaseAdds\": " << step.broadPhaseAdds << ", \"newPairs\": " << step.newPairs
+				<< ", \"contactPairs\": " << step.contactPairs << ", \"touchingPairs\": " << step.touchingPairs
+				<< ", \"events\": " << step.events << " }" << (i + 1 < slow_count ? "," : "") << "\n";
+		}
+		stream << "\t],\n";
+
+		// Poses counted over the spikes, the bodies moving the most often when the steps are slow
+		stream << "\t\"hotBodies\": [\n";
+		for (QXsizei i = 0; i < hot_bodies.size(); ++i)
+		{
+			QXuint body = hot_bodies[i].first;
+			QXstring name = body < _names.size() ? _names[body] : "";
+
+			stream << "\t\t{ \"body\": " << body << ", \"name\": \"" << name << "\", \"spikes\": " << hot_bodies[i].second
+				<< " }" << (i + 1 < hot_bodies.size() ? "," : "") << "\n";
+		}
+		stream << "\t],\n";
+
+		stream << "\t\"hotCells\": [\n";
+		for (QXsizei i = 0; i < hot_cells.size(); ++i)
+		{
+			stream << "\t\t{ \"x\": " << hot_cells[i].first.first * PHYSIC_REPLAY_CELL_SIZE << ", \"z\": " << hot_cells[i].first.second * PHYSIC_REPLAY_CELL_SIZE
+				<< ", \"size\": " << PHYSIC_REPLAY_CELL_SIZE << ", \"poses\": " << hot_cells[i].second << " }" << (i + 1 < hot_cells.size() ? "," : "") << "\n";
+		}
+		stream << "\t]\n";
+
+		stream << "}\n";
+
+		return true;
+	}
+
+	QXbool PhysicReplay::WriteHeatMap(const QXstring& filePath, QXuint size) const noexcept
+	{
+		if (_poses.empty() || size == 0)
+		{
+			LOG(WARNING, "physic capture has no pose to draw: " + _filePath);
+			return false;
+		}
+
+		// Square around every pose, the image keeps the proportions of the scene
+		QXfloat min_x = _poses[0].position[0];
+		QXfloat max_x = min_x;
+		QXfloat min_z = _poses[0].position[2];
+		QXfloat max_z = min_z;
+		for (const PhysicPoseRecord& pose : _poses)
+		{
+			min_x = std::min(min_x, pose.position[0]);
+			max_x = std::max(max_x, pose.position[0]);
+			min_z = std::min(min_z, pose.position[2]);
+			max_z = std::max(max_z, pose.position[2]);
+		}
+		QXfloat extent = std::max(std::max(max_x - min_x, max_z - min_z), 1.f);
+
+		// Each pose adds the solver time of its step to its pixel
+		std::vector<QXfloat> heat(size * size, 0.f);
+		QXfloat hottest = 0.f;
+
+		for (QXsizei i = 0; i < _steps.size(); ++i)
+		{
+			const PhysicPoseRecord* poses = GetPoses(i);
+			for (QXuint j = 0; j < _steps[i].poseCount; ++j)
+			{
+				QXuint x = std::min((QXuint)((poses[j].position[0] - min_x) / extent * size), size - 1);
+				QXuint y = std::min((QXuint)((max_z - poses[j].position[2]) / extent * size), size - 1);
+
+				QXfloat& pixel = heat[y * size + x];
+				pixel += _steps[i].solverTime;
+				hottest = std::max(hottest, pixel);
+			}
+		}
+
+		std::ofstream stream(filePath, std::ios::binary);
+		if (!stream)
+		{
+			LOG(ERROR, "physic heat map can not be written in " + filePath);
+			return false;
+		}
+
+		stream << "P6\n" << size << " " << size << "\n255\n";
+
+		// Black to red to yellow, on a square root so the places moved less often stay visible
+		std::vector<QXbyte> pixels(size * size * 3);
+		for (QXsizei i = 0; i < heat.size(); ++i)
+		{
+			QXfloat value = hottest > 0.f ? sqrtf(heat[i] / hottest) : 0.f;
+
+			pixels[i * 3 + 0] = (QXbyte)(std::min(value * 2.f, 1.f) * 255.f);
+			pixels[i * 3 + 1] = (QXbyte)(std::max(value * 2.f - 1.f, 0.f) * 255.f);
+			pixels[i * 3 + 2] = 0;
+		}
+		stream.write((const char*)pixels.data(), pixels.size());
+
+		return true;
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,242 @@
+#include "Core/Physic/SceneQuery.h"
+
+#include <algorithm>
+
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Threading/JobSystem.h"
+
+namespace Quantix::Core::Physic
+{
+	using namespace physx;
+
+	/**
+	 * @brief Skip the objects out of the layers of a request and the actors out of the simulation
+	 */
+	class LayerFilter : public PxQueryFilterCallback
+	{
+	private:
+		QXuint					_layers;
+		PxQueryHitType::Enum	_hitType;
+
+	public:
+		LayerFilter(QXuint layers, PxQueryHitType::Enum hitType) noexcept :
+			_layers { layers },
+			_hitType { hitType }
+		{}
+
+		PxQueryHitType::Enum preFilter(const PxFilterData&, const PxShape*, const PxRigidActor* actor, PxHitFlags&) override
+		{
+			// Actors parked out of the simulation are not in the world
+			if (actor->getActorFlags() & PxActorFlag::eDISABLE_SIMULATION)
+				return PxQueryHitType::eNONE;
+
+			Core::DataStructure::GameObject3D* object = (Core::DataStructure::GameObject3D*)actor->userData;
+			if (object == nullptr || ((QXuint)object->GetLayer() & _layers) == 0)
+				return PxQueryHitType::eNONE;
+
+			return _hitType;
+		}
+
+		PxQueryHitType::Enum postFilter(const PxFilterData&, const PxQueryHit&) override
+		{
+			return _hitType;
+		}
+	};
+
+	/**
+	 * @brief Convert a rotation of the engine to PhysX
+	 *
+	 * @param rotation rotation of a transform
+	 * @return PxQuat rotation of an actor
+	 */
+	static PxQuat ToPhysic(const Math::QXquaternion& rotation) noexcept
+	{
+		Math::QXquaternion q = rotation;
+		q = q.ConjugateQuaternion();
+
+		return PxQuat(q.v.x, q.v.y, q.v.z, q.w);
+	}
+
+#pragma region Functions
+
+	QXuint SceneQueryBatch::Add(const Request& request) noexcept
+	{
+		QueryResult result;
+		result.first = (QXuint)_hits.size();
+
+		_requests.push_back(request);
+		_results.push_back(result);
+		_hits.resize(_hits.size() + request.maxHits);
+		_executed = false;
+
+		return (QXuint)_requests.size() - 1;
+	}
+
+	QXuint SceneQueryBatch::Raycast(const Math::QXvec3& origin, const Math::QXvec3& unitDir, QXfloat distMax, QXuint layers) noexcept
+	{
+		Request request;
+		request.type = EQueryType::RAYCAST;
+		request.pose = PxTransform(PxVec3(origin.x, origin.y, origin.z));
+		request.direction = PxVec3(unitDir.x, unitDir.y, unitDir.z);
+		request.distance = distMax;
+		request.layers = layers;
+		request.maxHits = 1;
+
+		return Add(request);
+	}
+
+	QXuint SceneQueryBatch::SweepSphere(QXfloat radius, const Math::QXvec3& origin, const Math::QXvec3& unitDir, QXfloat distMax, QXuint layers) noexcept
+	{
+		Request request;
+		request.type = EQueryType::SWEEP;
+		request.geometry.storeAny(PxSphereGeometry(radius));
+		request.pose = PxTransform(PxVec3(origin.x, origin.y, origin.z));
+		request.direction = PxVec3(unitDir.x, unitDir.y, unitDir.z);
+		request.distance = distMax;
+		request.layers = layers;
+		request.maxHits = 1;
+
+		return Add(request);
+	}
+
+	QXuint SceneQueryBatch::SweepBox(const Math::QXvec3& halfExtents, const Math::QXvec3& origin, const Math::QXquaternion& rotation,
+										const Math::QXvec3& unitDir, QXfloat distMax, QXuint layers) noexcept
+	{
+		Request request;
+		request.type = EQueryType::SWEEP;
+		request.geometry.storeAny(PxBoxGeometry(halfExtents.x, halfExtents.y, halfExtents.z));
+		request.pose = PxTransform(PxVec3(origin.x, origin.y, origin.z), ToPhysic(rotation));
+		request.direction = PxVec3(unitDir.x, unitDir.y, unitDir.z);
+		request.distance = distMax;
+		request.layers = layers;
+		request.maxHits = 1;
+
+		return Add(request);
+	}
+
+	QXuint SceneQueryBatch::OverlapSphere(QXfloat radius, const Math::QXvec3& center, QXuint layers, QXuint maxHits) noexcept
+	{
+		Request request;
+		request.type = EQueryType::OVERLAP;
+		request.geometry.storeAny(PxSphereGeometry(radius));
+		request.pose = PxTransform(PxVec3(center.x, center.y, center.z));
+		request.direction = PxVec3(0.f, 0.f, 0.f);
+		request.distance = 0.f;
+		request.layers = layers;
+		request.maxHits = std::min(maxHits, (QXuint)SCENE_QUERY_MAX_TOUCHES);
+
+		return Add(request);
+	}
+
+	QXuint SceneQueryBatch::OverlapBox(const Math::QXvec3& halfExtents, const Math::QXvec3& center, const Math::QXquaternion& rotation,
+										QXuint layers, QXuint maxHits) noexcept
+	{
+		Request request;
+		request.type = EQueryType::OVERLAP;
+		request.geometry.storeAny(PxBoxGeometry(halfExtents.x, halfExtents.y, halfExtents.z));
+		request.pose = PxTransform(PxVec3(center.x, center.y, center.z), ToPhysic(rotation));
+		request.direction = PxVec3(0.f, 0.f, 0.f);
+		request.distance = 0.f;
+		request.layers = layers;
+		request.maxHits = std::min(maxHits, (QXuint)SCENE_QUERY_MAX_TOUCHES);
+
+		return Add(request);
+	}
+
+	void SceneQueryBatch::Run(PxScene* scene, QXuint index, PxOverlapHit* touches) noexcept
+	{
+		const Request& request = _requests[index];
+		QueryResult& result = _results[index];
+		QueryHit* hits = _hits.data() + result.first;
+
+		result.count = 0;
+
+		if (request.type == EQueryType::OVERLAP)
+		{
+			// Every object is a touch, none blocks the query
+			LayerFilter filter(request.layers, PxQueryHitType::eTOUCH);
+			PxQueryFilterData filterData(PxQueryFlag::eDYNAMIC | PxQueryFlag::eSTATIC | PxQueryFlag::ePREFILTER | PxQueryFlag::eNO_BLOCK);
+			PxOverlapBuffer buffer(touches, request.maxHits);
+
+			if (!scene->overlap(request.geometry.any(), request.pose, buffer, filterData, &filter))
+				return;
+
+			for (PxU32 i = 0; i < buffer.nbTouches; ++i)
+				hits[i].object = (Core::DataStructure::GameObject3D*)buffer.touches[i].actor->userData;
+			result.count = buffer.nbTouches;
+
+			return;
+		}
+
+		LayerFilter filter(request.layers, PxQueryHitType::eBLOCK);
+		PxQueryFilterData filterData(PxQueryFlag::eDYNAMIC | PxQueryFlag::eSTATIC | PxQueryFlag::ePREFILTER);
+		PxHitFlags flags = PxHitFlag::ePOSITION | PxHitFlag::eNORMAL;
+
+		PxLocationHit block;
+		QXbool status;
+
+		if (request.type == EQueryType::RAYCAST)
+		{
+			PxRaycastBuffer buffer;
+			status = scene->raycast(request.pose.p, request.direction, request.distance, buffer, flags, filterData, &filter) && buffer.hasBlock;
+			block = buffer.block;
+		}
+		else
+		{
+			PxSweepBuffer buffer;
+			status = scene->sweep(request.geometry.any(), request.pose, request.direction, request.distance, buffer, flags, filterData, &filter) && buffer.hasBlock;
+			block = buffer.block;
+		}
+
+		if (!status)
+			return;
+
+		hits[0].object = (Core::DataStructure::GameObject3D*)block.actor->userData;
+		hits[0].position = Math::QXvec3(block.position.x, block.position.y, block.position.z);
+		hits[0].normal = Math::QXvec3(block.normal.x, block.normal.y, block.normal.z);
+		hits[0].distance = block.distance;
+		result.count = 1;
+	}
+
+	void SceneQueryBatch::Execute(PxScene* scene) noexcept
+	{
+		// Scene queries only read the scene, the jobs run them side by side. Each job holds a read lock, required when
+		// the scene is created with eREQUIRE_RW_LOCK and shared with the other readers otherwise
+		Threading::JobSystem::GetInstance()->ParallelFor(_requests.size(), SCENE_QUERY_GRAIN, [this, scene](QXsizei begin, QXsizei end)
+			{
+				PxSceneReadLock lock(*scene, __FILE__, __LINE__);
+				PxOverlapHit touches[SCENE_QUERY_MAX_TOUCHES];
+
+				for (QXsizei i = begin; i < end; ++i)
+					Run(scene, (QXuint)i, touches);
+			});
+
+		_executed = true;
+	}
+
+	void SceneQueryBatch::Clear() noexcept
+	{
+		_requests.clear();
+		_results.clear();
+		_hits.clear();
+		_executed = false;
+	}
+
+	const QueryHit* SceneQueryBatch::GetHits(QXuint id) const noexcept
+	{
+		if (!_executed || id >= _results.size() || _results[id].count == 0)
+			return nullptr;
+
+		return _hits.data() + _results[id].first;
+	}
+
+	QXuint SceneQueryBatch::GetHitCount(QXuint id) const noexcept
+	{
+		if (!_executed || id >= _results.size())
+			return 0;
+
+		return _results[id].count;
+	}
+
+#pragma endregion
+}
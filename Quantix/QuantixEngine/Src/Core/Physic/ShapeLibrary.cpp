@@ -0,0 +1,132 @@
+#include "Core/Physic/ShapeLibrary.h"
+
+#include <functional>
+
+namespace Quantix::Core::Physic
+{
+	using namespace physx;
+
+	/**
+	 * @brief Mix a value in a hash
+	 *
+	 * @param seed hash to update
+	 * @param value hash of the value
+	 */
+	static void HashCombine(QXsizei& seed, QXsizei value) noexcept
+	{
+		seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+
+#pragma region ShapeKey
+
+	PxGeometryHolder ShapeKey::GetGeometry() const noexcept
+	{
+		switch (type)
+		{
+		case PxGeometryType::eBOX:			return PxBoxGeometry(size);
+		case PxGeometryType::eSPHERE:		return PxSphereGeometry(size.x);
+		case PxGeometryType::eCAPSULE:		return PxCapsuleGeometry(size.x, size.y);
+		case PxGeometryType::eCONVEXMESH:	return PxConvexMeshGeometry(static_cast<PxConvexMesh*>(mesh), PxMeshScale(size));
+		case PxGeometryType::eTRIANGLEMESH:	return PxTriangleMeshGeometry(static_cast<PxTriangleMesh*>(mesh), PxMeshScale(size));
+		default:							return PxGeometryHolder();
+		}
+	}
+
+	QXbool ShapeKey::operator==(const ShapeKey& other) const noexcept
+	{
+		return type == other.type && size == other.size && mesh == other.mesh && material == other.material &&
+			localPose.p == other.localPose.p && localPose.q == other.localPose.q &&
+			filterData == other.filterData && flags == other.flags;
+	}
+
+	QXsizei ShapeKeyHash::operator()(const ShapeKey& key) const noexcept
+	{
+		std::hash<PxReal> hash_real;
+		std::hash<PxU32> hash_word;
+		std::hash<const void*> hash_pointer;
+
+		QXsizei seed = hash_word((PxU32)key.type);
+		HashCombine(seed, hash_real(key.size.x));
+		HashCombine(seed, hash_real(key.size.y));
+		HashCombine(seed, hash_real(key.size.z));
+		HashCombine(seed, hash_pointer(key.mesh));
+		HashCombine(seed, hash_pointer(key.material));
+		HashCombine(seed, hash_real(key.localPose.p.x));
+		HashCombine(seed, hash_real(key.localPose.p.y));
+		HashCombine(seed, hash_real(key.localPose.p.z));
+		HashCombine(seed, hash_real(key.localPose.q.x));
+		HashCombine(seed, hash_real(key.localPose.q.y));
+		HashCombine(seed, hash_real(key.localPose.q.z));
+		HashCombine(seed, hash_real(key.localPose.q.w));
+		HashCombine(seed, hash_word(key.filterData.word0));
+		HashCombine(seed, hash_word(key.filterData.word1));
+		HashCombine(seed, hash_word(key.filterData.word2));
+		HashCombine(seed, hash_word(key.filterData.word3));
+		HashCombine(seed, hash_word((PxU32)key.flags));
+
+		return seed;
+	}
+
+#pragma endregion
+
+#pragma region Constructors
+
+	ShapeLibrary::ShapeLibrary(PxPhysics* sdk) noexcept :
+		_sdk { sdk }
+	{}
+
+	ShapeLibrary::~ShapeLibrary() noexcept
+	{
+		// The actors still using a shape keep it alive
+		for (auto& entry : _entries)
+			entry.second.shape->release();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	PxShape* ShapeLibrary::Acquire(const ShapeKey& key) noexcept
+	{
+		auto it = _entries.find(key);
+		if (it != _entries.end())
+		{
+			it->second.users++;
+			return it->second.shape;
+		}
+
+		PxGeometryHolder geometry = key.GetGeometry();
+		if (geometry.getType() == PxGeometryType::eINVALID || key.material == nullptr)
+			return nullptr;
+
+		// Not exclusive, the shape can be attached to any number of actors
+		PxShape* shape = _sdk->createShape(geometry.any(), *key.material, QX_FALSE, key.flags);
+		if (shape == nullptr)
+			return nullptr;
+
+		shape->setLocalPose(key.localPose);
+		shape->setSimulationFilterData(key.filterData);
+
+		_entries.emplace(key, Entry { shape, 1 });
+		_keys.emplace(shape, key);
+
+		return shape;
+	}
+
+	void ShapeLibrary::Release(PxShape* shape) noexcept
+	{
+		auto key = _keys.find(shape);
+		if (key == _keys.end())
+			return;
+
+		auto it = _entries.find(key->second);
+		if (--it->second.users > 0)
+			return;
+
+		shape->release();
+		_entries.erase(it);
+		_keys.erase(key);
+	}
+
+#pragma endregion
+}
@@ -7,6 +7,10 @@
 
 namespace Quantix::Core::Physic
 {
+	SimulationCallback::SimulationCallback(PhysicEventQueue* events) :
+		_events { events }
+	{}
+
 	void SimulationCallback::onConstraintBreak(PxConstraintInfo*, PxU32)
 	{}
 
@@ -18,33 +22,60 @@ namespace Quantix::Core::Physic
 
 	void SimulationCallback::onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs)
 	{
+		if (!_events || pairHeader.flags & (PxContactPairHeaderFlag::eREMOVED_ACTOR_0 | PxContactPairHeaderFlag::eREMOVED_ACTOR_1))
+			return;
+
+		Core::DataStructure::GameObject3D* object0 = (Core::DataStructure::GameObject3D*)pairHeader.actors[0]->userData;
+		Core::DataStructure::GameObject3D* object1 = (Core::DataStructure::GameObject3D*)pairHeader.actors[1]->userData;
+		if (!object0 || !object1)
+			return;
+
 		for (PxU32 i = 0; i < nbPairs; i++)
 		{
 			const PxContactPair& cp = pairs[i];
 
-			if (cp.events & PxPairFlag::eNOTIFY_TOUCH_FOUND)
+			if (!(cp.events & PxPairFlag::eNOTIFY_TOUCH_FOUND))
+				continue;
+
+			// Only a few points are read, enough to know the strength of the contact
+			PxContactPairPoint buffer[PHYSIC_EVENT_MAX_POINTS];
+			PxU32 count = cp.extractContacts(buffer, PHYSIC_EVENT_MAX_POINTS);
+
+			Math::QXvec3 position { 0.f, 0.f, 0.f };
+			Math::QXvec3 normal { 0.f, 0.f, 0.f };
+			QXfloat impulse = 0.f;
+
+			if (count > 0)
 			{
-				if (pairHeader.actors[1] && pairHeader.actors[0])
-				{
-					PxContactPairPoint buffer[1];
-					pairs[i].extractContacts(buffer, 1);
-					Math::QXvec3 normal = Math::QXvec3(buffer[0].normal.x, buffer[0].normal.y, buffer[0].normal.z);
-					Math::QXvec3 position = Math::QXvec3(buffer[0].position.x, buffer[0].position.y, buffer[0].position.z);
-
-					// Call OnContact Function of each GameObject
-					((Core::DataStructure::GameObject3D*)pairHeader.actors[0]->userData)->CallOnContact((Core::DataStructure::GameObject3D*)pairHeader.actors[1]->userData, position, normal);
-					((Core::DataStructure::GameObject3D*)pairHeader.actors[1]->userData)->CallOnContact((Core::DataStructure::GameObject3D*)pairHeader.actors[0]->userData, position, normal);
-				}
+				position = Math::QXvec3(buffer[0].position.x, buffer[0].position.y, buffer[0].position.z);
+				normal = Math::QXvec3(buffer[0].normal.x, buffer[0].normal.y, buffer[0].normal.z);
 			}
+
+			for (PxU32 j = 0; j < count; j++)
+				impulse += buffer[j].impulse.magnitude();
+
+			_events->AddContact(object0, object1, cp.shapes[0], cp.shapes[1], position, normal, impulse);
 		}
 	}
 
 	void SimulationCallback::onTrigger(PxTriggerPair* pairs, PxU32 count)
 	{
+		if (!_events)
+			return;
+
 		for (PxU32 i = 0; i < count; i++)
 		{
-			// Call OnTrigger Function of GameObject who is trigger
-			((Core::DataStructure::GameObject3D*)pairs[i].triggerActor->userData)->CallOnTrigger((Core::DataStructure::GameObject3D*)pairs[i].otherActor->userData);
+			const PxTriggerPair& tp = pairs[i];
+
+			if (tp.flags & (PxTriggerPairFlag::eREMOVED_SHAPE_TRIGGER | PxTriggerPairFlag::eREMOVED_SHAPE_OTHER))
+				continue;
+
+			Core::DataStructure::GameObject3D* trigger = (Core::DataStructure::GameObject3D*)tp.triggerActor->userData;
+			Core::DataStructure::GameObject3D* other = (Core::DataStructure::GameObject3D*)tp.otherActor->userData;
+			if (!trigger || !other)
+				continue;
+
+			_events->AddTrigger(trigger, other, tp.otherShape, tp.status == PxPairFlag::eNOTIFY_TOUCH_FOUND);
 		}
 	}
 
@@ -3,6 +3,8 @@
 #include "Core/Components/CharacterController.h"
 #include "Core/Components/Camera.h"
 
+#include <cstring>
+
 namespace Quantix::Core::Physic
 {
 #pragma region Constructors&Destructor
@@ -248,6 +250,8 @@ namespace Quantix::Core::Physic
 
 	void	Transform3D::Update(Transform3D* parentTransform) noexcept
 	{
+		Math::QXmat4 previous = _trs;
+
 		if (_globalHasChanged)
 			UpdateTRSLocal(parentTransform);
 		UpdateTRS();
@@ -259,6 +263,10 @@ namespace Quantix::Core::Physic
 
 		_trs = _trsLocal * parentTransform->_trs;
 		UpdateGlobalTransform();
+
+		// Moved by itself or by one of its parents
+		if (memcmp(previous.array, _trs.array, sizeof(_trs.array)) != 0)
+			_isDirty = QX_TRUE;
 	}
 
 	void	Transform3D::Translate(const Math::QXvec3& pos) noexcept
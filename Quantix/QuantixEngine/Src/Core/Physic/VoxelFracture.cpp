@@ -0,0 +1,359 @@
+#include "Core/Physic/VoxelFracture.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Core/Threading/JobSystem.h"
+
+// Label of the voxels not reached yet by a split
+#define FRACTURE_NO_ISLAND 0xFFFFFFFF
+
+namespace Quantix::Core::Physic
+{
+	using namespace physx;
+
+#pragma region Constructors
+
+	VoxelFracture::VoxelFracture(PxPhysics* sdk, PxScene* scene, PxMaterial* material, const FractureDesc& desc) noexcept :
+		_sdk { sdk },
+		_scene { scene },
+		_desc { desc }
+	{
+		QXuint count = _desc.width * _desc.height * _desc.depth;
+
+		_voxels.resize(count);
+		_islands.resize(count);
+
+		Piece piece;
+		piece.actor = _sdk->createRigidDynamic(_desc.pose);
+		piece.actor->userData = _desc.userData;
+		piece.pose = _desc.pose;
+		piece.voxels.reserve(count);
+
+		PxBoxGeometry box(_desc.voxelSize.x * 0.5f, _desc.voxelSize.y * 0.5f, _desc.voxelSize.z * 0.5f);
+
+		for (QXuint z = 0; z < _desc.depth; ++z)
+		{
+			for (QXuint y = 0; y < _desc.height; ++y)
+			{
+				for (QXuint x = 0; x < _desc.width; ++x)
+				{
+					QXuint index = x + (y + z * _desc.height) * _desc.width;
+
+					// The shape is kept alive by the block when it moves from an actor to another
+					PxShape* shape = _sdk->createShape(box, *material, QX_TRUE);
+					shape->setLocalPose(PxTransform(PxVec3(x * _desc.voxelSize.x, y * _desc.voxelSize.y, z * _desc.voxelSize.z)));
+					shape->setSimulationFilterData(_desc.filterData);
+					shape->userData = (void*)(QXsizei)index;
+					piece.actor->attachShape(*shape);
+
+					Voxel& voxel = _voxels[index];
+					voxel.shape = shape;
+					voxel.piece = 0;
+					voxel.bonds = (x + 1 < _desc.width ? FRACTURE_BOND_X : 0) | (y + 1 < _desc.height ? FRACTURE_BOND_Y : 0) |
+									(z + 1 < _desc.depth ? FRACTURE_BOND_Z : 0);
+
+					piece.voxels.push_back(index);
+				}
+			}
+		}
+
+		PxRigidBodyExt::updateMassAndInertia(*piece.actor, _desc.density);
+		_scene->addActor(*piece.actor);
+
+		_pieces.push_back(std::move(piece));
+	}
+
+	VoxelFracture::~VoxelFracture() noexcept
+	{
+		for (Piece& piece : _pieces)
+		{
+			if (piece.actor)
+				piece.actor->release();
+		}
+
+		for (Voxel& voxel : _voxels)
+			voxel.shape->release();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXuint VoxelFracture::GetBonded(QXuint voxel, QXuint* neighbours) const noexcept
+	{
+		const QXuint strideY = _desc.width;
+		const QXuint strideZ = _desc.width * _desc.height;
+
+		QXuint x = voxel % _desc.width;
+		QXuint y = (voxel / strideY) % _desc.height;
+		QXuint z = voxel / strideZ;
+		QXuint bonds = _voxels[voxel].bonds;
+		QXuint count = 0;
+
+		// A bond is stored on the voxel with the lowest coordinate
+		if (bonds & FRACTURE_BOND_X)
+			neighbours[count++] = voxel + 1;
+		if (x > 0 && _voxels[voxel - 1].bonds & FRACTURE_BOND_X)
+			neighbours[count++] = voxel - 1;
+		if (bonds & FRACTURE_BOND_Y)
+			neighbours[count++] = voxel + strideY;
+		if (y > 0 && _voxels[voxel - strideY].bonds & FRACTURE_BOND_Y)
+			neighbours[count++] = voxel - strideY;
+		if (bonds & FRACTURE_BOND_Z)
+			neighbours[count++] = voxel + strideZ;
+		if (z > 0 && _voxels[voxel - strideZ].bonds & FRACTURE_BOND_Z)
+			neighbours[count++] = voxel - strideZ;
+
+		return count;
+	}
+
+	void VoxelFracture::Break(QXuint voxel, QXuint radius) noexcept
+	{
+		const QXuint strideY = _desc.width;
+		const QXuint strideZ = _desc.width * _desc.height;
+
+		QXint x = (QXint)(voxel % _desc.width);
+		QXint y = (QXint)((voxel / strideY) % _desc.height);
+		QXint z = (QXint)(voxel / strideZ);
+		QXint r = (QXint)radius;
+
+		for (QXint k = std::max(z - r, 0); k <= std::min(z + r, (QXint)_desc.depth - 1); ++k)
+		{
+			for (QXint j = std::max(y - r, 0); j <= std::min(y + r, (QXint)_desc.height - 1); ++j)
+			{
+				for (QXint i = std::max(x - r, 0); i <= std::min(x + r, (QXint)_desc.width - 1); ++i)
+				{
+					QXuint index = (QXuint)i + ((QXuint)j + (QXuint)k * _desc.height) * _desc.width;
+					QXuint broken = 0;
+
+					broken += (_voxels[index].bonds & FRACTURE_BOND_X) != 0;
+					broken += (_voxels[index].bonds & FRACTURE_BOND_Y) != 0;
+					broken += (_voxels[index].bonds & FRACTURE_BOND_Z) != 0;
+					_voxels[index].bonds = 0;
+
+					// The bonds towards the voxel are kept by its neighbours below it
+					if (i > 0 && _voxels[index - 1].bonds & FRACTURE_BOND_X)
+					{
+						_voxels[index - 1].bonds &= ~FRACTURE_BOND_X;
+						broken++;
+					}
+					if (j > 0 && _voxels[index - strideY].bonds & FRACTURE_BOND_Y)
+					{
+						_voxels[index - strideY].bonds &= ~FRACTURE_BOND_Y;
+						broken++;
+					}
+					if (k > 0 && _voxels[index - strideZ].bonds & FRACTURE_BOND_Z)
+					{
+						_voxels[index - strideZ].bonds &= ~FRACTURE_BOND_Z;
+						broken++;
+					}
+
+					if (broken == 0)
+						continue;
+
+					_brokenBonds += broken;
+					_dirty.push_back(_voxels[index].piece);
+				}
+			}
+		}
+	}
+
+	void VoxelFracture::Split(QXuint piece) noexcept
+	{
+		if (_pieces[piece].actor == nullptr || _pieces[piece].voxels.size() <= 1)
+			return;
+
+		for (QXuint voxel : _pieces[piece].voxels)
+			_islands[voxel] = FRACTURE_NO_ISLAND;
+
+		// Flood the bonds, every island is a group of voxels still connected
+		std::vector<QXuint> sizes;
+		QXuint neighbours[6];
+
+		for (QXuint voxel : _pieces[piece].voxels)
+		{
+			if (_islands[voxel] != FRACTURE_NO_ISLAND)
+				continue;
+
+			QXuint island = (QXuint)sizes.size();
+			sizes.push_back(0);
+
+			_islands[voxel] = island;
+			_stack.push_back(voxel);
+
+			while (!_stack.empty())
+			{
+				QXuint current = _stack.back();
+				_stack.pop_back();
+				sizes[island]++;
+
+				QXuint count = GetBonded(current, neighbours);
+				for (QXuint i = 0; i < count; ++i)
+				{
+					if (_islands[neighbours[i]] != FRACTURE_NO_ISLAND)
+						continue;
+
+					_islands[neighbours[i]] = island;
+					_stack.push_back(neighbours[i]);
+				}
+			}
+		}
+
+		if (sizes.size() == 1)
+			return;
+
+		QXuint kept = (QXuint)(std::max_element(sizes.begin(), sizes.end()) - sizes.begin());
+
+		PxRigidDynamic* source = _pieces[piece].actor;
+		PxTransform pose = source->getGlobalPose();
+		PxVec3 center = pose.transform(source->getCMassLocalPose().p);
+		PxVec3 linear = source->getLinearVelocity();
+		PxVec3 angular = source->getAngularVelocity();
+
+		// Pieces of the islands, the kept one stays on the actor of the piece
+		QXuint first = (QXuint)_pieces.size();
+		std::vector<QXuint> targets(sizes.size());
+
+		for (QXuint i = 0; i < (QXuint)sizes.size(); ++i)
+		{
+			if (i == kept)
+			{
+				targets[i] = piece;
+				continue;
+			}
+
+			targets[i] = (QXuint)_pieces.size();
+
+			Piece created;
+			created.actor = _sdk->createRigidDynamic(pose);
+			created.actor->userData = _desc.userData;
+			created.pose = pose;
+			created.voxels.reserve(sizes[i]);
+
+			_pieces.push_back(std::move(created));
+		}
+
+		std::vector<QXuint> voxels;
+		voxels.swap(_pieces[piece].voxels);
+		_pieces[piece].voxels.reserve(sizes[kept]);
+
+		for (QXuint voxel : voxels)
+		{
+			QXuint target = targets[_islands[voxel]];
+			_pieces[target].voxels.push_back(voxel);
+
+			if (target == piece)
+				continue;
+
+			source->detachShape(*_voxels[voxel].shape);
+			_pieces[target].actor->attachShape(*_voxels[voxel].shape);
+			_voxels[voxel].piece = target;
+		}
+
+		// The new pieces leave with the velocity the block had where they are
+		for (QXuint i = first; i < (QXuint)_pieces.size(); ++i)
+		{
+			PxRigidDynamic* actor = _pieces[i].actor;
+			PxRigidBodyExt::updateMassAndInertia(*actor, _desc.density);
+
+			PxVec3 offset = pose.transform(actor->getCMassLocalPose().p) - center;
+			actor->setLinearVelocity(linear + angular.cross(offset));
+			actor->setAngularVelocity(angular);
+
+			_scene->addActor(*actor);
+		}
+
+		PxRigidBodyExt::updateMassAndInertia(*source, _desc.density);
+
+		PxVec3 offset = pose.transform(source->getCMassLocalPose().p) - center;
+		source->setLinearVelocity(linear + angular.cross(offset));
+	}
+
+	void VoxelFracture::AddImpact(PxShape* shape, QXfloat impulse) noexcept
+	{
+		_impacts.push_back({ shape, impulse });
+	}
+
+	QXsizei VoxelFracture::Release(PxShape* shape) noexcept
+	{
+		QXuint voxel = (QXuint)(QXsizei)shape->userData;
+		if (voxel >= _voxels.size() || _voxels[voxel].shape != shape)
+			return GetPieceCount();
+
+		Piece& piece = _pieces[_voxels[voxel].piece];
+		if (piece.actor == nullptr)
+			return GetPieceCount();
+
+		// The shapes are detached by the actor and kept alive by the block, the index of the piece stays valid
+		piece.actor->release();
+		piece.actor = nullptr;
+		_releasedPieces++;
+
+		return GetPieceCount();
+	}
+
+	void VoxelFracture::Update(QXfloat stepSize) noexcept
+	{
+		for (const Impact& impact : _impacts)
+		{
+			QXuint voxel = (QXuint)(QXsizei)impact.shape->userData;
+			if (voxel >= _voxels.size() || _voxels[voxel].shape != impact.shape || _pieces[_voxels[voxel].piece].actor == nullptr)
+				continue;
+
+			QXfloat ratio = impact.impulse / (stepSize * _desc.breakForce);
+			if (ratio < 1.f)
+				continue;
+
+			// Stronger impacts break the bonds further from the voxel hit
+			Break(voxel, std::min((QXuint)ratio - 1, (QXuint)FRACTURE_MAX_RADIUS));
+		}
+		_impacts.clear();
+
+		std::sort(_dirty.begin(), _dirty.end());
+		_dirty.erase(std::unique(_dirty.begin(), _dirty.end()), _dirty.end());
+
+		for (QXuint piece : _dirty)
+			Split(piece);
+		_dirty.clear();
+
+		// Read once per step, the voxels are placed from them while the next step runs
+		for (Piece& piece : _pieces)
+		{
+			if (piece.actor)
+				piece.pose = piece.actor->getGlobalPose();
+		}
+	}
+
+	void VoxelFracture::FillInstances(Math::QXmat4* transforms) const noexcept
+	{
+		Threading::JobSystem::GetInstance()->ParallelFor(_voxels.size(), FRACTURE_INSTANCE_GRAIN, [this, transforms](QXsizei begin, QXsizei end)
+			{
+				for (QXsizei i = begin; i < end; ++i)
+				{
+					QXuint x = (QXuint)i % _desc.width;
+					QXuint y = ((QXuint)i / _desc.width) % _desc.height;
+					QXuint z = (QXuint)i / (_desc.width * _desc.height);
+
+					// A released voxel is collapsed to a point, the batch keeps one instance per voxel
+					if (_pieces[_voxels[i].piece].actor == nullptr)
+					{
+						memset(transforms[i].array, 0, sizeof(QXfloat) * 16);
+						continue;
+					}
+
+					PxTransform local(PxVec3(x * _desc.voxelSize.x, y * _desc.voxelSize.y, z * _desc.voxelSize.z));
+					PxMat44 matrix(_pieces[_voxels[i].piece].pose.transform(local));
+
+					// The unit cube is scaled to the voxel
+					matrix.column0 *= _desc.voxelSize.x;
+					matrix.column1 *= _desc.voxelSize.y;
+					matrix.column2 *= _desc.voxelSize.z;
+
+					memcpy(transforms[i].array, matrix.front(), sizeof(QXfloat) * 16);
+				}
+			});
+	}
+
+#pragma endregion
+}
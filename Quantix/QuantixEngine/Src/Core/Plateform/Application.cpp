@@ -6,6 +6,7 @@
 #include "Core/Components/Mesh.h"
 #include "Core/Physic/PhysicHandler.h"
 #include "Core/Threading/TaskSystem.hpp"
+#include "Core/Threading/JobSystem.h"
 #include "Core/SoundCore.h"
 
 namespace Quantix::Core::Platform
@@ -25,14 +26,28 @@ namespace Quantix::Core::Platform
 		Physic::PhysicHandler::GetInstance()->ReleaseSystem();
 		Physic::PhysicHandler::GetInstance()->Destroy();
 		Threading::TaskSystem::Destroy();
+		Threading::JobSystem::Destroy();
 		delete scene;
 	}
 
-	void Application::Update(std::vector<Core::Components::Mesh*>& meshes, std::vector<Components::ICollider*>& colliders,
-		std::vector<Components::Light>& lights, QXbool isPlaying) noexcept
+	void Application::UpdateResources() noexcept
 	{
 		Threading::TaskSystem::GetInstance()->Update();
 		manager.UpdateResourcesState();
+	}
+
+	void Application::Update(std::vector<Core::Components::Mesh*>& meshes, std::vector<Components::ICollider*>& colliders,
+		std::vector<Components::Light>& lights, QXbool isPlaying) noexcept
+	{
+		Physic::PhysicHandler* physic = Physic::PhysicHandler::GetInstance();
+
+		// The step left running by the last frame ends before its poses and events reach the game, its events are only
+		// sent here and between the steps, never from a behaviour
+		physic->FetchSimulation();
+		physic->DispatchEvents();
+
+		// In the editor too, the colliders whose mesh was cooked get their shape
+		physic->UpdateMeshColliders();
 
 		if (isPlaying && _firstFrame)
 		{
@@ -48,12 +63,22 @@ namespace Quantix::Core::Platform
 			}
 		}
 
-		scene->Update(meshes, colliders, lights, info, isPlaying);
+		// Playing, the objects follow the interpolated actors before the behaviours run
+		if (isPlaying)
+			physic->UpdatePhysicActor(true);
+
+		// Before the step starts, the queries and the solver do not run on the scene together
+		physic->ExecuteQueries();
 
-		// Updatye Physic
+		// The step simulates with the inputs of the last frame while the behaviours run and the frame is drawn,
+		// PhysX buffers what they write to the actors until the step is fetched
 		if (isPlaying)
-			Physic::PhysicHandler::GetInstance()->UpdateSystem(info.deltaTime);
-		Physic::PhysicHandler::GetInstance()->UpdatePhysicActor(isPlaying);
+			physic->UpdateSystem(info.deltaTime);
+
+		scene->Update(meshes, colliders, lights, info, isPlaying);
+
+		if (!isPlaying)
+			physic->UpdatePhysicActor(false);
 
 		scene->CheckDestroy(info);
 	}
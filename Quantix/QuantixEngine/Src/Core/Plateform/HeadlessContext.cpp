@@ -0,0 +1,279 @@
+#include "Core/Platform/HeadlessContext.h"
+
+#include <stdexcept>
+#include <cstdio>
+#include <cstring>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define QX_EGL_LIBRARY "libEGL.dll"
+#define QX_EGLAPIENTRY __stdcall
+#else
+#include <dlfcn.h>
+#define QX_EGL_LIBRARY "libEGL.so.1"
+#define QX_EGLAPIENTRY
+#endif
+
+// Values of the Khronos headers, EGL is loaded at runtime so only the ones used are declared
+#define EGL_NO_DISPLAY ((void*)0)
+#define EGL_NO_CONTEXT ((void*)0)
+#define EGL_NO_SURFACE ((void*)0)
+#define EGL_DEFAULT_DISPLAY ((void*)0)
+#define EGL_PBUFFER_BIT 0x0001
+#define EGL_OPENGL_BIT 0x0008
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x0001
+#define EGL_ALPHA_SIZE 0x3021
+#define EGL_BLUE_SIZE 0x3022
+#define EGL_GREEN_SIZE 0x3023
+#define EGL_RED_SIZE 0x3024
+#define EGL_DEPTH_SIZE 0x3025
+#define EGL_SURFACE_TYPE 0x3033
+#define EGL_NONE 0x3038
+#define EGL_RENDERABLE_TYPE 0x3040
+#define EGL_EXTENSIONS 0x3055
+#define EGL_HEIGHT 0x3056
+#define EGL_WIDTH 0x3057
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define EGL_OPENGL_API 0x30A2
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+namespace Quantix::Core::Platform
+{
+	typedef QXint			EGLint;
+	typedef QXuint			EGLBoolean;
+	typedef QXuint			EGLenum;
+	typedef void*			EGLDisplay;
+	typedef void*			EGLConfig;
+	typedef void*			EGLContext;
+	typedef void*			EGLSurface;
+
+	typedef void*		(QX_EGLAPIENTRY* PFN_eglGetProcAddress)(const char*);
+	typedef EGLDisplay	(QX_EGLAPIENTRY* PFN_eglGetDisplay)(void*);
+	typedef EGLDisplay	(QX_EGLAPIENTRY* PFN_eglGetPlatformDisplayEXT)(EGLenum, void*, const EGLint*);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglInitialize)(EGLDisplay, EGLint*, EGLint*);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglTerminate)(EGLDisplay);
+	typedef const char*	(QX_EGLAPIENTRY* PFN_eglQueryString)(EGLDisplay, EGLint);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglChooseConfig)(EGLDisplay, const EGLint*, EGLConfig*, EGLint, EGLint*);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglBindAPI)(EGLenum);
+	typedef EGLContext	(QX_EGLAPIENTRY* PFN_eglCreateContext)(EGLDisplay, EGLConfig, EGLContext, const EGLint*);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglDestroyContext)(EGLDisplay, EGLContext);
+	typedef EGLSurface	(QX_EGLAPIENTRY* PFN_eglCreatePbufferSurface)(EGLDisplay, EGLConfig, const EGLint*);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglDestroySurface)(EGLDisplay, EGLSurface);
+	typedef EGLBoolean	(QX_EGLAPIENTRY* PFN_eglMakeCurrent)(EGLDisplay, EGLSurface, EGLSurface, EGLContext);
+
+	// Read by the loader of glad, which takes a function of the default calling convention
+	static PFN_eglGetProcAddress	s_eglGetProcAddress = nullptr;
+
+	/**
+	 * @brief Find a GL function through EGL
+	 *
+	 * @param name name of the function
+	 * @return void* address of the function, nullptr if it is missing
+	 */
+	static void* GetEGLProcAddress(const char* name) noexcept
+	{
+		return s_eglGetProcAddress(name);
+	}
+
+	/**
+	 * @brief Find a function exported by the EGL library
+	 *
+	 * @param library library loaded
+	 * @param name name of the function
+	 * @return void* address of the function, nullptr if it is missing
+	 */
+	static void* GetLibrarySymbol(void* library, const char* name) noexcept
+	{
+#ifdef _WIN32
+		return (void*)GetProcAddress((HMODULE)library, name);
+#else
+		return dlsym(library, name);
+#endif
+	}
+
+#pragma region Constructors
+
+	HeadlessContext::HeadlessContext(QXuint width, QXuint height)
+	{
+		if (!CreateEGL(width, height))
+			CreateGLFW(width, height);
+
+		printf("GL_VERSION: %s\n", glGetString(GL_VERSION));
+		printf("GL_RENDERER: %s\n", glGetString(GL_RENDERER));
+	}
+
+	HeadlessContext::~HeadlessContext() noexcept
+	{
+		if (_window)
+		{
+			glfwDestroyWindow(_window);
+			glfwTerminate();
+		}
+
+		ReleaseEGL();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXbool HeadlessContext::CreateEGL(QXuint width, QXuint height) noexcept
+	{
+#ifdef _WIN32
+		_library = (void*)LoadLibraryA(QX_EGL_LIBRARY);
+#else
+		_library = dlopen(QX_EGL_LIBRARY, RTLD_LAZY | RTLD_LOCAL);
+#endif
+		if (_library == nullptr)
+			return false;
+
+		s_eglGetProcAddress = (PFN_eglGetProcAddress)GetLibrarySymbol(_library, "eglGetProcAddress");
+		PFN_eglGetDisplay get_display = (PFN_eglGetDisplay)GetLibrarySymbol(_library, "eglGetDisplay");
+		PFN_eglInitialize initialize = (PFN_eglInitialize)GetLibrarySymbol(_library, "eglInitialize");
+		PFN_eglQueryString query_string = (PFN_eglQueryString)GetLibrarySymbol(_library, "eglQueryString");
+		PFN_eglChooseConfig choose_config = (PFN_eglChooseConfig)GetLibrarySymbol(_library, "eglChooseConfig");
+		PFN_eglBindAPI bind_api = (PFN_eglBindAPI)GetLibrarySymbol(_library, "eglBindAPI");
+		PFN_eglCreateContext create_context = (PFN_eglCreateContext)GetLibrarySymbol(_library, "eglCreateContext");
+		PFN_eglCreatePbufferSurface create_pbuffer = (PFN_eglCreatePbufferSurface)GetLibrarySymbol(_library, "eglCreatePbufferSurface");
+		PFN_eglMakeCurrent make_current = (PFN_eglMakeCurrent)GetLibrarySymbol(_library, "eglMakeCurrent");
+
+		if (!s_eglGetProcAddress || !get_display || !initialize || !query_string || !choose_config || !bind_api || !create_context ||
+			!create_pbuffer || !make_current)
+		{
+			ReleaseEGL();
+			return false;
+		}
+
+		EGLDisplay display = EGL_NO_DISPLAY;
+
+		// Surfaceless platform of Mesa, no display server nor surface is needed
+		PFN_eglGetPlatformDisplayEXT get_platform_display = (PFN_eglGetPlatformDisplayEXT)s_eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (get_platform_display)
+			display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+		if (display == EGL_NO_DISPLAY || !initialize(display, nullptr, nullptr))
+		{
+			display = get_display(EGL_DEFAULT_DISPLAY);
+			if (display == EGL_NO_DISPLAY || !initialize(display, nullptr, nullptr))
+			{
+				ReleaseEGL();
+				return false;
+			}
+		}
+		_display = display;
+
+		const char* extensions = query_string(display, EGL_EXTENSIONS);
+		QXbool surfaceless = extensions && strstr(extensions, "EGL_KHR_surfaceless_context");
+
+		const EGLint config_attributes[] = {
+			EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+			EGL_DEPTH_SIZE, 24,
+			EGL_NONE
+		};
+
+		// Drivers only giving OpenGL ES through EGL fall back to the window
+		EGLConfig config;
+		EGLint config_count = 0;
+		if (!choose_config(display, config_attributes, &config, 1, &config_count) || config_count == 0 || !bind_api(EGL_OPENGL_API))
+		{
+			ReleaseEGL();
+			return false;
+		}
+
+		const EGLint context_attributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 4,
+			EGL_CONTEXT_MINOR_VERSION, 5,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+
+		_context = create_context(display, config, EGL_NO_CONTEXT, context_attributes);
+		if (_context == EGL_NO_CONTEXT)
+		{
+			ReleaseEGL();
+			return false;
+		}
+
+		if (!surfaceless)
+		{
+			const EGLint surface_attributes[] = { EGL_WIDTH, (EGLint)width, EGL_HEIGHT, (EGLint)height, EGL_NONE };
+			_surface = create_pbuffer(display, config, surface_attributes);
+			if (_surface == EGL_NO_SURFACE)
+			{
+				ReleaseEGL();
+				return false;
+			}
+		}
+
+		if (!make_current(display, _surface, _surface, _context) || !gladLoadGLLoader((GLADloadproc)GetEGLProcAddress))
+		{
+			ReleaseEGL();
+			return false;
+		}
+
+		return true;
+	}
+
+	void HeadlessContext::ReleaseEGL() noexcept
+	{
+		if (_library == nullptr)
+			return;
+
+		if (_display)
+		{
+			PFN_eglMakeCurrent make_current = (PFN_eglMakeCurrent)GetLibrarySymbol(_library, "eglMakeCurrent");
+			PFN_eglDestroySurface destroy_surface = (PFN_eglDestroySurface)GetLibrarySymbol(_library, "eglDestroySurface");
+			PFN_eglDestroyContext destroy_context = (PFN_eglDestroyContext)GetLibrarySymbol(_library, "eglDestroyContext");
+			PFN_eglTerminate terminate = (PFN_eglTerminate)GetLibrarySymbol(_library, "eglTerminate");
+
+			if (make_current)
+				make_current(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			if (_surface && destroy_surface)
+				destroy_surface(_display, _surface);
+			if (_context && destroy_context)
+				destroy_context(_display, _context);
+			if (terminate)
+				terminate(_display);
+		}
+
+#ifdef _WIN32
+		FreeLibrary((HMODULE)_library);
+#else
+		dlclose(_library);
+#endif
+
+		_library = nullptr;
+		_display = nullptr;
+		_context = nullptr;
+		_surface = nullptr;
+		s_eglGetProcAddress = nullptr;
+	}
+
+	void HeadlessContext::CreateGLFW(QXuint width, QXuint height)
+	{
+		if (glfwInit() != QX_TRUE)
+			throw std::runtime_error("Failed to init GLFW");
+
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+		_window = glfwCreateWindow(width, height, "Quantix Headless", nullptr, nullptr);
+		if (_window == nullptr)
+			throw std::runtime_error("Failed to create the hidden window");
+
+		glfwMakeContextCurrent(_window);
+
+		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+			throw std::runtime_error("Failed to init openGL");
+	}
+
+#pragma endregion
+}
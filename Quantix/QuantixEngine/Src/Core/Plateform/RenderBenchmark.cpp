@@ -0,0 +1,368 @@
+#include "Core/Platform/RenderBenchmark.h"
+
+#include <glad/glad.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "MathDefines.h"
+#include "Core/Debugger/Logger.h"
+#include "Core/Physic/PhysicHandler.h"
+#include "Core/Components/Mesh.h"
+
+namespace Quantix::Core::Platform
+{
+#pragma region Constructors
+
+	RenderBenchmark::RenderBenchmark(Application& app, const BenchmarkConfig& config) noexcept :
+		_app { app },
+		_config { config }
+	{
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXbool RenderBenchmark::LoadScene() noexcept
+	{
+		if (!_config.scene.empty())
+		{
+			Physic::PhysicHandler::GetInstance()->CleanScene();
+			_app.newScene = _app.manager.LoadScene(_config.scene);
+			if (_app.newScene == nullptr)
+			{
+				LOG(ERROR, "benchmark scene can not be loaded: " + _config.scene);
+				return false;
+			}
+
+			// A scene failing or never ready stops the run instead of hanging it
+			std::chrono::steady_clock::time_point load_begin = std::chrono::steady_clock::now();
+			while (!_app.newScene->IsReady())
+			{
+				if (_app.newScene->IsFailed() ||
+					std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - load_begin).count() > BENCHMARK_LOAD_TIMEOUT)
+				{
+					LOG(ERROR, "benchmark scene is not ready: " + _config.scene);
+					_app.newScene = nullptr;
+					return false;
+				}
+
+				_app.UpdateResources();
+			}
+
+			_app.scene = _app.newScene;
+			_app.newScene = nullptr;
+		}
+
+		Populate();
+
+		// The meshes of the scene are only drawn once their models and textures are initialized
+		do
+		{
+			_app.UpdateResources();
+		} while (_app.manager.IsLoading());
+
+		return true;
+	}
+
+	void RenderBenchmark::PlaceCamera(QXuint frame) noexcept
+	{
+		const std::vector<BenchmarkKey>& path = _config.path;
+		QXfloat t = _config.frames > 1 ? (QXfloat)frame / (QXfloat)(_config.frames - 1) : 0.f;
+
+		BenchmarkKey key;
+		if (path.empty())
+		{
+			QXfloat angle = t * 2.f * Q_PI;
+			key.position = Math::QXvec3(cosf(angle) * BENCHMARK_ORBIT_RADIUS, BENCHMARK_ORBIT_HEIGHT, sinf(angle) * BENCHMARK_ORBIT_RADIUS);
+			key.target = Math::QXvec3(0.f, 0.f, 0.f);
+		}
+		else if (path.size() == 1)
+			key = path[0];
+		else
+		{
+			QXfloat position = t * (QXfloat)(path.size() - 1);
+			QXsizei index = std::min((QXsizei)position, path.size() - 2);
+			QXfloat blend = position - (QXfloat)index;
+
+			const BenchmarkKey& from = path[index];
+			const BenchmarkKey& to = path[index + 1];
+			key.position = from.position + (to.position - from.position) * blend;
+			key.target = from.target + (to.target - from.target) * blend;
+		}
+
+		Math::QXvec3 dir = key.target - key.position;
+		QXfloat length = dir.Length();
+		if (length > 0.f)
+			dir = dir * (1.f / length);
+		else
+			dir = Math::QXvec3(0.f, 0.f, 1.f);
+
+		_camera.SetDir(dir);
+		_camera.SetUp(Math::QXvec3(0.f, 1.f, 0.f));
+		_camera.UpdateLookAt(key.position);
+	}
+
+	void RenderBenchmark::Record(QXdouble cpuTime, QXdouble wallTime, QXbool resolved) noexcept
+	{
+		_cpuFrames.push_back(cpuTime);
+		_wallFrames.push_back(wallTime);
+		_occlusionFrames.push_back(_app.renderer.GetOcclusionTime());
+		_depthOverdraw.push_back(_app.renderer.GetDepthOverdraw());
+		_shadedOverdraw.push_back(_app.renderer.GetShadedOverdraw());
+		Sample();
+
+		// The pass timings are a few frames old, a frame dropped by the timer is not counted twice
+		if (!resolved)
+			return;
+
+		const std::vector<Render::PassTiming>& timings = _timer.GetTimings();
+		QXdouble gpu_time = 0.0;
+
+		for (QXsizei i = 0; i < timings.size(); ++i)
+		{
+			const Render::PassTiming& timing = timings[i];
+			gpu_time += timing.gpuTime;
+
+			// Stats are kept in the order the passes first ran
+			auto it = std::find_if(_stats.begin(), _stats.end(), [&timing](const PassStats& stats) { return stats.name == timing.name; });
+			if (it == _stats.end())
+			{
+				_stats.emplace_back();
+				_stats.back().name = timing.name;
+				it = _stats.end() - 1;
+			}
+
+			it->count++;
+			it->cpuTotal += timing.cpuTime;
+			it->cpuMax = std::max(it->cpuMax, timing.cpuTime);
+			it->gpuTotal += timing.gpuTime;
+			it->gpuMax = std::max(it->gpuMax, timing.gpuTime);
+		}
+
+		_gpuFrames.push_back(gpu_time);
+	}
+
+	void RenderBenchmark::Capture(const Render::RenderFramebuffer& buffer, QXuint frame) noexcept
+	{
+		std::vector<QXbyte> pixels(buffer.width * buffer.height * 3);
+
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glGetTextureImage(buffer.texture[0], 0, GL_RGB, GL_UNSIGNED_BYTE, (GLsizei)pixels.size(), pixels.data());
+
+		QXchar name[32];
+		snprintf(name, sizeof(name), "/frame_%04u.ppm", frame);
+
+		std::ofstream stream(_config.captureDir + name, std::ios::binary);
+		if (!stream)
+		{
+			LOG(ERROR, "benchmark capture can not be written in " + _config.captureDir);
+			return;
+		}
+
+		stream << "P6\n" << buffer.width << " " << buffer.height << "\n255\n";
+
+		// GL rows start at the bottom of the image
+		QXsizei row = buffer.width * 3;
+		for (QXuint y = buffer.height; y > 0; --y)
+			stream.write((const char*)pixels.data() + (y - 1) * row, row);
+	}
+
+	QXbool RenderBenchmark::WriteReport() const noexcept
+	{
+		std::ofstream stream(_config.output);
+		if (!stream)
+		{
+			LOG(ERROR, "benchmark report can not be written in " + _config.output);
+			return false;
+		}
+
+		auto average = [](const std::vector<QXdouble>& values)
+		{
+			QXdouble total = 0.0;
+			for (QXsizei i = 0; i < values.size(); ++i)
+				total += values[i];
+			return values.empty() ? 0.0 : total / values.size();
+		};
+
+		auto percentile = [](std::vector<QXdouble> values, QXdouble rank)
+		{
+			if (values.empty())
+				return 0.0;
+			std::sort(values.begin(), values.end());
+			return values[std::min(values.size() - 1, (QXsizei)(rank * values.size()))];
+		};
+
+		// Times are written in milliseconds
+		const QXdouble ms = 1000.0;
+
+		stream << "{\n";
+		stream << "\t\"scene\": \"" << _config.scene << "\",\n";
+		stream << "\t\"renderer\": \"" << (const char*)glGetString(GL_RENDERER) << "\",\n";
+		stream << "\t\"width\": " << _config.width << ",\n";
+		stream << "\t\"height\": " << _config.height << ",\n";
+		stream << "\t\"frames\": " << _cpuFrames.size() << ",\n";
+
+		stream << "\t\"frame\": {\n";
+		stream << "\t\t\"cpuAverage\": " << average(_cpuFrames) * ms << ",\n";
+		stream << "\t\t\"cpuP95\": " << percentile(_cpuFrames, 0.95) * ms << ",\n";
+		stream << "\t\t\"gpuAverage\": " << average(_gpuFrames) * ms << ",\n";
+		stream << "\t\t\"gpuP95\": " << percentile(_gpuFrames, 0.95) * ms << ",\n";
+		stream << "\t\t\"wallAverage\": " << average(_wallFrames) * ms << ",\n";
+		stream << "\t\t\"wallP95\": " << percentile(_wallFrames, 0.95) * ms << "\n";
+		stream << "\t},\n";
+
+		WriteSections(stream);
+
+		// Time of the occlusion culling of the frame, the camera and the faces of the point light shadows when they are culled
+		stream << "\t\"occlusion\": {\n";
+		stream << "\t\t\"average\": " << average(_occlusionFrames) * ms << ",\n";
+		stream << "\t\t\"p95\": " << percentile(_occlusionFrames, 0.95) * ms << "\n";
+		stream << "\t},\n";
+
+		// Fragments per pixel, the depth prepass writes what the opaque pass would shade without it
+		stream << "\t\"overdraw\": {\n";
+		stream << "\t\t\"depthPrepass\": " << (_app.scene->GetDepthPrepass() ? "true" : "false") << ",\n";
+		stream << "\t\t\"depth\": " << average(_depthOverdraw) << ",\n";
+		stream << "\t\t\"shaded\": " << average(_shadedOverdraw) << "\n";
+		stream << "\t},\n";
+
+		stream << "\t\"passes\": [\n";
+		for (QXsizei i = 0; i < _stats.size(); ++i)
+		{
+			const PassStats& stats = _stats[i];
+			QXdouble frames = _cpuFrames.empty() ? 1.0 : (QXdouble)_cpuFrames.size();
+
+			stream << "\t\t{ \"name\": \"" << stats.name << "\", \"count\": " << stats.count
+				<< ", \"cpuAverage\": " << stats.cpuTotal / frames * ms << ", \"cpuMax\": " << stats.cpuMax * ms
+				<< ", \"gpuAverage\": " << stats.gpuTotal / frames * ms << ", \"gpuMax\": " << stats.gpuMax * ms
+				<< " }" << (i + 1 < _stats.size() ? "," : "") << "\n";
+		}
+		stream << "\t],\n";
+
+		stream << "\t\"cpuFrames\": [";
+		for (QXsizei i = 0; i < _cpuFrames.size(); ++i)
+			stream << (i ? ", " : "") << _cpuFrames[i] * ms;
+		stream << "],\n";
+
+		stream << "\t\"gpuFrames\": [";
+		for (QXsizei i = 0; i < _gpuFrames.size(); ++i)
+			stream << (i ? ", " : "") << _gpuFrames[i] * ms;
+		stream << "]\n";
+
+		stream << "}\n";
+
+		return true;
+	}
+
+	QXbool RenderBenchmark::Run() noexcept
+	{
+		if (!LoadScene())
+			return false;
+
+		_app.info.width = _config.width;
+		_app.info.height = _config.height;
+		_app.info.proj = { Math::QXmat4::CreateProjectionMatrix(_config.width, _config.height, 0.1f, 1000.f, 60.f) };
+		_app.info.currentTime = 0.0;
+		_app.info.prevTime = 0.0;
+
+		Render::RenderFramebuffer buffer;
+		_app.renderer.CreateRenderFramebuffer(_config.width, _config.height, buffer);
+
+		// Runs must be comparable: no resolution scaling and each frame draws the state it just updated
+		_app.renderer.GetDynamicResolution().enable = false;
+		_app.pipeline.SetDepth(1);
+
+		Start();
+
+		std::vector<Components::Mesh*>		meshes;
+		std::vector<Components::ICollider*>	colliders;
+		std::vector<Components::Light>		lights;
+
+		for (QXuint frame = 0; frame < _config.warmup + _config.frames; ++frame)
+		{
+			QXbool measured = frame >= _config.warmup;
+			QXuint measured_frame = measured ? frame - _config.warmup : 0;
+
+			_app.info.prevTime = _app.info.currentTime;
+			_app.info.currentTime += BENCHMARK_DELTA_TIME;
+			_app.info.deltaTime = BENCHMARK_DELTA_TIME;
+
+			_app.UpdateResources();
+			PlaceCamera(measured_frame);
+
+			std::chrono::steady_clock::time_point frame_begin = std::chrono::steady_clock::now();
+
+			_app.pipeline.Simulate([this, &meshes, &colliders, &lights, frame, measured](Render::RenderSnapshot& snapshot)
+				{
+					meshes.clear();
+					colliders.clear();
+					lights.clear();
+
+					QXbool playing = Step(frame, measured);
+					_app.Update(meshes, colliders, lights, playing);
+
+					snapshot.Build(meshes, colliders, lights, _app.info, false);
+					snapshot.BuildSprites(_app.scene->GetSprites());
+					snapshot.depthPrepass = _app.scene->GetDepthPrepass();
+					snapshot.AddView(&_camera);
+				});
+
+			std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+			_app.renderer.BeginFrame();
+			_app.renderer.Draw(_app.pipeline.GetRenderSnapshot(), 0, buffer, false);
+			_app.renderer.EndFrame();
+			QXdouble cpu_time = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - begin).count();
+
+			_app.pipeline.Sync();
+			_app.pipeline.Present();
+			QXdouble wall_time = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - frame_begin).count();
+
+			// Passes of the frame read by the gpu profiler, the gpu is never waited for so frames overlap as in the editor
+			QXbool resolved = _timer.Resolve();
+
+			if (!measured)
+				continue;
+
+			Record(cpu_time, wall_time, resolved);
+
+			if (!_config.captureDir.empty() && _config.captureInterval > 0 && measured_frame % _config.captureInterval == 0)
+				Capture(buffer, measured_frame);
+		}
+
+		Stop();
+
+		glDeleteFramebuffers(1, &buffer.FBO);
+		glDeleteTextures(2, buffer.texture);
+		glDeleteRenderbuffers(1, &buffer.depthBuffer);
+
+		return WriteReport();
+	}
+
+	QXbool RenderBenchmark::LoadPath(const QXstring& filePath, std::vector<BenchmarkKey>& path) noexcept
+	{
+		std::ifstream stream(filePath);
+		if (!stream)
+		{
+			LOG(ERROR, "benchmark path can not be read: " + filePath);
+			return false;
+		}
+
+		QXstring line;
+		while (std::getline(stream, line))
+		{
+			std::istringstream values(line);
+			BenchmarkKey key;
+
+			if (values >> key.position.x >> key.position.y >> key.position.z >> key.target.x >> key.target.y >> key.target.z)
+				path.push_back(key);
+		}
+
+		return true;
+	}
+
+#pragma endregion
+}
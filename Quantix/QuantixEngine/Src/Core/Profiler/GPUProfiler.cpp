@@ -0,0 +1,187 @@
+#include "Core/Profiler/GPUProfiler.h"
+
+#include <glad/glad.h>
+
+#include "Core/Profiler/Profiler.h"
+
+namespace Quantix::Core::Profiling
+{
+#pragma region Functions
+
+	void GPUProfiler::Resolve(Frame& frame) noexcept
+	{
+		// The end of the frame is written after every scope, the queries end in order
+		QXint available = 0;
+		glGetQueryObjectiv(frame.timestamps[1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		// The gpu is too far behind, the frame is reused without its results and the last timings are kept
+		if (!available)
+		{
+			frame.used = 0;
+			frame.pending = false;
+			return;
+		}
+
+		GLuint64 frame_begin = 0, frame_end = 0;
+		glGetQueryObjectui64v(frame.timestamps[0], GL_QUERY_RESULT, &frame_begin);
+		glGetQueryObjectui64v(frame.timestamps[1], GL_QUERY_RESULT, &frame_end);
+		_frameTime = (frame_end > frame_begin ? frame_end - frame_begin : 0) * 1e-9;
+
+		_timings.resize(frame.used);
+
+		for (QXsizei i = 0; i < frame.used; ++i)
+		{
+			const Scope& scope = frame.scopes[i];
+
+			GLuint64 begin = 0, end = 0, primitives = 0;
+			glGetQueryObjectui64v(scope.timestamps[0], GL_QUERY_RESULT, &begin);
+			glGetQueryObjectui64v(scope.timestamps[1], GL_QUERY_RESULT, &end);
+
+			if (scope.depth == 0)
+				glGetQueryObjectui64v(scope.primitives, GL_QUERY_RESULT, &primitives);
+
+			GPUTiming& timing = _timings[i];
+			timing.name = scope.name;
+			timing.view = scope.view;
+			timing.cpuTime = scope.cpuTime;
+			timing.gpuTime = (end > begin ? end - begin : 0) * 1e-9;
+			timing.primitives = (QXsizei)primitives;
+			timing.depth = scope.depth;
+		}
+
+		frame.used = 0;
+		frame.pending = false;
+		++_resolved;
+
+		if (Profiler::GetInstance()->GetActivate())
+			Publish();
+	}
+
+	void GPUProfiler::Publish() const noexcept
+	{
+		for (QXsizei i = 0; i < _timings.size(); ++i)
+		{
+			const GPUTiming& timing = _timings[i];
+
+			// Sent once, with the first scope of the name
+			QXbool first = true;
+			for (QXsizei j = 0; j < i && first; ++j)
+				first = _timings[j].name != timing.name;
+			if (!first)
+				continue;
+
+			QXdouble gpu_time = 0.0;
+			QXsizei primitives = 0;
+			for (QXsizei j = i; j < _timings.size(); ++j)
+			{
+				if (_timings[j].name != timing.name)
+					continue;
+
+				gpu_time += _timings[j].gpuTime;
+				primitives += _timings[j].primitives;
+			}
+
+			Profiler::GetInstance()->SetGPUProfiling(timing.name, gpu_time, primitives);
+		}
+	}
+
+	void GPUProfiler::BeginFrame() noexcept
+	{
+		_current = (_current + 1) % GPU_PROFILER_FRAMES;
+		_view = 0;
+		_stack.clear();
+
+		// Written GPU_PROFILER_FRAMES frames ago, the gpu is usually done with it
+		Frame& frame = _frames[_current];
+		if (frame.pending)
+			Resolve(frame);
+
+		frame.used = 0;
+
+		if (frame.timestamps[0] == 0)
+			glCreateQueries(GL_TIMESTAMP, 2, frame.timestamps);
+		glQueryCounter(frame.timestamps[0], GL_TIMESTAMP);
+	}
+
+	void GPUProfiler::EndFrame() noexcept
+	{
+		// Scopes left open are closed so every query of the frame has a result
+		while (!_stack.empty())
+			StopProfiling();
+
+		Frame& frame = _frames[_current];
+		glQueryCounter(frame.timestamps[1], GL_TIMESTAMP);
+		frame.pending = true;
+	}
+
+	void GPUProfiler::Release() noexcept
+	{
+		for (QXuint i = 0; i < GPU_PROFILER_FRAMES; ++i)
+		{
+			if (_frames[i].timestamps[0] != 0)
+				glDeleteQueries(2, _frames[i].timestamps);
+
+			for (QXsizei j = 0; j < _frames[i].scopes.size(); ++j)
+			{
+				glDeleteQueries(2, _frames[i].scopes[j].timestamps);
+				glDeleteQueries(1, &_frames[i].scopes[j].primitives);
+			}
+
+			_frames[i] = Frame();
+		}
+
+		_stack.clear();
+	}
+
+	void GPUProfiler::StartProfiling(const QXstring& name) noexcept
+	{
+		if (_clients == 0 && !Profiler::GetInstance()->GetActivate())
+			return;
+
+		Frame& frame = _frames[_current];
+
+		// Queries are kept between frames, new ones are only created when a frame has more scopes
+		if (frame.used == frame.scopes.size())
+		{
+			frame.scopes.emplace_back();
+			glCreateQueries(GL_TIMESTAMP, 2, frame.scopes.back().timestamps);
+			glCreateQueries(GL_PRIMITIVES_GENERATED, 1, &frame.scopes.back().primitives);
+		}
+
+		Scope& scope = frame.scopes[frame.used];
+		scope.name = name;
+		scope.view = _view;
+		scope.depth = (QXuint)_stack.size();
+		scope.begin = std::chrono::steady_clock::now();
+
+		// Primitive queries can not be nested, only the outermost scope counts them
+		glQueryCounter(scope.timestamps[0], GL_TIMESTAMP);
+		if (scope.depth == 0)
+			glBeginQuery(GL_PRIMITIVES_GENERATED, scope.primitives);
+
+		_stack.push_back(frame.used++);
+	}
+
+	void GPUProfiler::StopProfiling() noexcept
+	{
+		if (_stack.empty())
+			return;
+
+		Scope& scope = _frames[_current].scopes[_stack.back()];
+		_stack.pop_back();
+
+		if (scope.depth == 0)
+			glEndQuery(GL_PRIMITIVES_GENERATED);
+		glQueryCounter(scope.timestamps[1], GL_TIMESTAMP);
+		scope.cpuTime = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - scope.begin).count();
+	}
+
+	GPUProfiler* GPUProfiler::GetInstance() noexcept
+	{
+		static GPUProfiler profiler;
+
+		return &profiler;
+	}
+
+#pragma endregion
+}
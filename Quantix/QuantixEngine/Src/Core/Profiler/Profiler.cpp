@@ -19,6 +19,8 @@ namespace Quantix::Core::Profiling
 
 	void Profiler::StartProfiling(const QXstring& type)
 	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
 		if (_activate)
 		{
 			if (!_activateFirst)
@@ -35,12 +37,54 @@ namespace Quantix::Core::Profiling
 
 	void Profiler::SetMessage(const QXstring& type, const QXstring& msg)
 	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
 		if (_infoProfiling[type].activate)
 			_infoProfiling[type].msg += msg;
 	}
 
+	void Profiler::SetGPUProfiling(const QXstring& type, QXdouble gpuTime, QXsizei primitives)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Only shown next to a cpu scope of the same name
+		std::map<QXstring, Info>::iterator it = _infoProfiling.find(type);
+		if (!_activate || it == _infoProfiling.end())
+			return;
+
+		it->second.gpuTimer = gpuTime;
+		it->second.primitives = primitives;
+		it->second.hasGPU = true;
+	}
+
+	void Profiler::AddProfiling(const QXstring& type, QXdouble time, const QXstring& msg)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (!_activate)
+			return;
+
+		if (!_activateFirst)
+		{
+			_profiling = BEGIN_PROFILING;
+			_activateFirst = true;
+		}
+
+		// Not a running scope, it never gets the time of StopProfiling
+		std::map<QXstring, Info>::iterator it = _infoProfiling.find(type);
+		if (it == _infoProfiling.end())
+		{
+			_infoProfiling.insert(std::make_pair(type, Info{ type + "\n" + msg, 0.0, time, currId, false }));
+			currId++;
+		}
+		else
+			it->second.timer += time;
+	}
+
 	void Profiler::StopProfiling(const QXstring& type)
 	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
 		if (_activate)
 		{
 			_infoProfiling[type].activate = false;
@@ -98,8 +142,20 @@ namespace Quantix::Core::Profiling
 			QXdouble tmpTimer = pair.second.timer * 1000.f;
 			streamObj << tmpTimer;
 
-			QXstring time = "**** Time to process ****: " + streamObj.str() + " milliseconds\n\n";
-			_profiling += time;
+			QXstring time = "**** Time to process ****: " + streamObj.str() + " milliseconds\n";
+
+			if (pair.second.hasGPU)
+			{
+				streamObj.str("");
+				streamObj << pair.second.gpuTimer * 1000.0;
+				time += "**** GPU time ****: " + streamObj.str() + " milliseconds";
+
+				if (pair.second.primitives)
+					time += ", " + std::to_string(pair.second.primitives) + " primitives";
+				time += "\n";
+			}
+
+			_profiling += time + "\n";
 		}
 	}
 
@@ -0,0 +1,182 @@
+#include "Core/Render/DebugDraw.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "MathDefines.h"
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Transform a point by a column major matrix
+	 *
+	 * @param mat matrix to use
+	 * @param point point to transform
+	 * @return Math::QXvec3 transformed point
+	 */
+	static Math::QXvec3 TransformPoint(const Math::QXmat4& mat, const Math::QXvec3& point) noexcept
+	{
+		QXfloat out[3];
+		for (QXuint i = 0; i < 3; ++i)
+			out[i] = mat.array[i] * point.x + mat.array[4 + i] * point.y + mat.array[8 + i] * point.z + mat.array[12 + i];
+
+		return Math::QXvec3(out[0], out[1], out[2]);
+	}
+
+#pragma region Functions
+
+	void DebugDrawList::Line(const Math::QXvec3& from, const Math::QXvec3& to, QXuint color) noexcept
+	{
+		_vertices.push_back({ from, color });
+		_vertices.push_back({ to, color });
+	}
+
+	void DebugDrawList::Circle(const Math::QXmat4& trs, const Math::QXvec3& center, const Math::QXvec3& axisA, const Math::QXvec3& axisB,
+		QXuint color, QXuint segments) noexcept
+	{
+		QXfloat step = 2.f * Q_PI / DEBUG_DRAW_SEGMENTS;
+		Math::QXvec3 previous = TransformPoint(trs, center + axisA);
+
+		for (QXuint i = 1; i <= segments; ++i)
+		{
+			Math::QXvec3 current = TransformPoint(trs, center + axisA * cosf(step * i) + axisB * sinf(step * i));
+
+			Line(previous, current, color);
+			previous = current;
+		}
+	}
+
+	void DebugDrawList::Box(const Math::QXmat4& trs, QXuint color) noexcept
+	{
+		Math::QXvec3 corners[8];
+		for (QXuint i = 0; i < 8; ++i)
+			corners[i] = TransformPoint(trs, Math::QXvec3(i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f, i & 4 ? 0.5f : -0.5f));
+
+		// Corners linked by an edge differ by one bit
+		for (QXuint i = 0; i < 8; ++i)
+		{
+			for (QXuint bit = 1; bit < 8; bit <<= 1)
+			{
+				if (!(i & bit))
+					Line(corners[i], corners[i | bit], color);
+			}
+		}
+	}
+
+	void DebugDrawList::Sphere(const Math::QXmat4& trs, QXuint color) noexcept
+	{
+		Math::QXvec3 center(0.f, 0.f, 0.f);
+
+		Circle(trs, center, Math::QXvec3(1.f, 0.f, 0.f), Math::QXvec3(0.f, 1.f, 0.f), color);
+		Circle(trs, center, Math::QXvec3(0.f, 1.f, 0.f), Math::QXvec3(0.f, 0.f, 1.f), color);
+		Circle(trs, center, Math::QXvec3(0.f, 0.f, 1.f), Math::QXvec3(1.f, 0.f, 0.f), color);
+	}
+
+	void DebugDrawList::Capsule(const Math::QXmat4& trs, QXfloat radius, QXfloat halfHeight, QXuint color) noexcept
+	{
+		Math::QXvec3 x(radius, 0.f, 0.f), y(0.f, radius, 0.f), z(0.f, 0.f, radius);
+		Math::QXvec3 top(0.f, halfHeight, 0.f), bottom(0.f, -halfHeight, 0.f);
+
+		// Rings at both ends of the cylinder
+		Circle(trs, top, z, x, color);
+		Circle(trs, bottom, z, x, color);
+
+		// Hemispheres drawn as two arcs each
+		Circle(trs, top, x, y, color, DEBUG_DRAW_SEGMENTS / 2);
+		Circle(trs, top, z, y, color, DEBUG_DRAW_SEGMENTS / 2);
+		Circle(trs, bottom, x * -1.f, y * -1.f, color, DEBUG_DRAW_SEGMENTS / 2);
+		Circle(trs, bottom, z * -1.f, y * -1.f, color, DEBUG_DRAW_SEGMENTS / 2);
+
+		Line(TransformPoint(trs, top + x), TransformPoint(trs, bottom + x), color);
+		Line(TransformPoint(trs, top - x), TransformPoint(trs, bottom - x), color);
+		Line(TransformPoint(trs, top + z), TransformPoint(trs, bottom + z), color);
+		Line(TransformPoint(trs, top - z), TransformPoint(trs, bottom - z), color);
+	}
+
+	void DebugDrawList::Append(const DebugDrawList& list) noexcept
+	{
+		_vertices.insert(_vertices.end(), list._vertices.begin(), list._vertices.end());
+	}
+
+	DebugDraw::ThreadList& DebugDraw::GetThreadList() noexcept
+	{
+		// The lists live as long as the debug draw, the threads of the engine are never destroyed before it
+		static thread_local ThreadList* list = nullptr;
+
+		if (list == nullptr)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_lists.push_back(std::make_unique<ThreadList>());
+			list = _lists.back().get();
+		}
+
+		return *list;
+	}
+
+	void DebugDraw::Line(const Math::QXvec3& from, const Math::QXvec3& to, QXuint color) noexcept
+	{
+		ThreadList& thread_list = GetThreadList();
+		std::lock_guard<std::mutex> lock(thread_list.mutex);
+
+		thread_list.list.Line(from, to, color);
+	}
+
+	void DebugDraw::Box(const Math::QXmat4& trs, QXuint color) noexcept
+	{
+		ThreadList& thread_list = GetThreadList();
+		std::lock_guard<std::mutex> lock(thread_list.mutex);
+
+		thread_list.list.Box(trs, color);
+	}
+
+	void DebugDraw::Sphere(const Math::QXmat4& trs, QXuint color) noexcept
+	{
+		ThreadList& thread_list = GetThreadList();
+		std::lock_guard<std::mutex> lock(thread_list.mutex);
+
+		thread_list.list.Sphere(trs, color);
+	}
+
+	void DebugDraw::Capsule(const Math::QXmat4& trs, QXfloat radius, QXfloat halfHeight, QXuint color) noexcept
+	{
+		ThreadList& thread_list = GetThreadList();
+		std::lock_guard<std::mutex> lock(thread_list.mutex);
+
+		thread_list.list.Capsule(trs, radius, halfHeight, color);
+	}
+
+	void DebugDraw::Flush(DebugDrawList& out) noexcept
+	{
+		out.Clear();
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (QXsizei i = 0; i < _lists.size(); ++i)
+		{
+			// The owning thread can still be writing in its list
+			std::lock_guard<std::mutex> list_lock(_lists[i]->mutex);
+
+			out.Append(_lists[i]->list);
+			_lists[i]->list.Clear();
+		}
+	}
+
+	QXuint DebugDraw::Color(QXfloat r, QXfloat g, QXfloat b, QXfloat a) noexcept
+	{
+		QXfloat channels[4] = { r, g, b, a };
+		QXuint color = 0;
+
+		for (QXuint i = 0; i < 4; ++i)
+			color |= (QXuint)(std::min(std::max(channels[i], 0.f), 1.f) * 255.f + 0.5f) << (8 * i);
+
+		return color;
+	}
+
+	DebugDraw* DebugDraw::GetInstance() noexcept
+	{
+		static DebugDraw instance;
+		return &instance;
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,50 @@
+#include "Core/Render/DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Core/Profiler/GPUProfiler.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Functions
+
+	void DynamicResolution::Control(QXdouble gpuTime) noexcept
+	{
+		// Relative error, positive when the frame is under budget
+		QXfloat error = (QXfloat)std::clamp((targetTime - gpuTime) / targetTime, -1.0, 1.0);
+		QXfloat derivative = error - _previousError;
+		_previousError = error;
+
+		// The integral is frozen while the scale is saturated in the direction of the error
+		QXbool saturated = (_rawScale >= maxScale && error > 0.f) || (_rawScale <= minScale && error < 0.f);
+		if (!saturated)
+			_integral += error;
+
+		_rawScale = std::clamp(maxScale + kp * error + ki * _integral + kd * derivative, minScale, maxScale);
+
+		QXfloat scale = std::round(_rawScale / DYNAMIC_RESOLUTION_STEP) * DYNAMIC_RESOLUTION_STEP;
+		_scale = std::clamp(scale, minScale, maxScale);
+	}
+
+	void DynamicResolution::Update() noexcept
+	{
+		// Frames dropped by the profiler keep the last scale
+		Profiling::GPUProfiler* profiler = Profiling::GPUProfiler::GetInstance();
+		if (profiler->GetResolvedFrames() == _resolved)
+			return;
+
+		_resolved = profiler->GetResolvedFrames();
+		_gpuTime = profiler->GetFrameTime();
+
+		if (enable)
+			Control(_gpuTime);
+	}
+
+	QXuint DynamicResolution::Apply(QXuint size) const noexcept
+	{
+		return std::max(1u, (QXuint)(size * GetScale() + 0.5f));
+	}
+
+#pragma endregion
+}
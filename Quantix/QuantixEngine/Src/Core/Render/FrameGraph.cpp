@@ -0,0 +1,163 @@
+#include "Core/Render/FrameGraph.h"
+
+#include "Core/Profiler/Profiler.h"
+#include "Core/Profiler/GPUProfiler.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	FrameGraph::PassBuilder::PassBuilder(FrameGraph& graph, QXsizei pass) noexcept :
+		_graph { graph },
+		_pass { pass }
+	{}
+
+#pragma endregion
+
+#pragma region Functions
+
+	FrameGraphResource FrameGraph::PassBuilder::Create(const QXstring& name, const RenderTargetDesc& desc) noexcept
+	{
+		ResourceNode node;
+		node.name = name;
+		node.target.desc = desc;
+
+		_graph._resources.push_back(node);
+
+		FrameGraphResource resource = (FrameGraphResource)_graph._resources.size() - 1;
+		_graph._passes[_pass].creates.push_back(resource);
+
+		return resource;
+	}
+
+	FrameGraphResource FrameGraph::PassBuilder::Read(FrameGraphResource resource) noexcept
+	{
+		_graph._passes[_pass].reads.push_back(resource);
+
+		return resource;
+	}
+
+	FrameGraphResource FrameGraph::PassBuilder::Write(FrameGraphResource resource) noexcept
+	{
+		_graph._passes[_pass].writes.push_back(resource);
+
+		return resource;
+	}
+
+	void FrameGraph::PassBuilder::SetSideEffect() noexcept
+	{
+		_graph._passes[_pass].sideEffect = true;
+	}
+
+	FrameGraphResource FrameGraph::Import(const QXstring& name, const RenderTarget& target) noexcept
+	{
+		ResourceNode node;
+		node.name = name;
+		node.target = target;
+		node.imported = true;
+
+		_resources.push_back(node);
+
+		return (FrameGraphResource)_resources.size() - 1;
+	}
+
+	void FrameGraph::MarkOutput(FrameGraphResource resource) noexcept
+	{
+		_resources[resource].output = true;
+	}
+
+	void FrameGraph::AddPass(const QXstring& name, const SetupFunc& setup, const ExecuteFunc& execute) noexcept
+	{
+		PassNode pass;
+		pass.name = name;
+		pass.execute = execute;
+
+		_passes.push_back(pass);
+
+		PassBuilder builder(*this, _passes.size() - 1);
+		setup(builder);
+	}
+
+	void FrameGraph::Compile() noexcept
+	{
+		_culledPassCount = 0;
+
+		// Walk the passes backward, a pass is kept if it writes a target read by a later kept pass or an output
+		for (QXsizei i = _passes.size(); i-- > 0;)
+		{
+			PassNode& pass = _passes[i];
+			QXbool alive = pass.sideEffect;
+
+			for (QXsizei j = 0; j < pass.writes.size() && !alive; ++j)
+			{
+				const ResourceNode& resource = _resources[pass.writes[j]];
+				alive = resource.output || resource.needed;
+			}
+
+			pass.culled = !alive;
+			if (!alive)
+			{
+				_culledPassCount++;
+				continue;
+			}
+
+			for (QXsizei j = 0; j < pass.reads.size(); ++j)
+				_resources[pass.reads[j]].needed = true;
+		}
+
+		// Transient targets are taken from the pool by the pass creating them and given back after their last use
+		for (QXsizei i = 0; i < _passes.size(); ++i)
+		{
+			const PassNode& pass = _passes[i];
+			if (pass.culled)
+				continue;
+
+			for (const std::vector<FrameGraphResource>* list : { &pass.creates, &pass.reads, &pass.writes })
+			{
+				for (QXsizei j = 0; j < list->size(); ++j)
+					_resources[(*list)[j]].lastPass = i;
+			}
+		}
+	}
+
+	void FrameGraph::Execute() noexcept
+	{
+		for (QXsizei i = 0; i < _passes.size(); ++i)
+		{
+			PassNode& pass = _passes[i];
+			if (pass.culled)
+				continue;
+
+			for (QXsizei j = 0; j < pass.creates.size(); ++j)
+			{
+				ResourceNode& resource = _resources[pass.creates[j]];
+				resource.target = _pool.Acquire(resource.target.desc);
+			}
+
+			START_PROFILING(pass.name);
+			START_GPU_PROFILING(pass.name);
+			pass.execute(*this);
+			STOP_GPU_PROFILING();
+			STOP_PROFILING(pass.name);
+
+			// Give back targets at their last use so the next passes or views can alias them
+			for (QXsizei j = 0; j < _resources.size(); ++j)
+			{
+				ResourceNode& resource = _resources[j];
+				if (!resource.imported && resource.lastPass == i && resource.target.texture != 0)
+				{
+					_pool.Release(resource.target);
+					resource.target.texture = 0;
+					resource.target.FBO = 0;
+				}
+			}
+		}
+
+		_passes.clear();
+		_resources.clear();
+
+		_pool.Update();
+	}
+
+#pragma endregion
+}
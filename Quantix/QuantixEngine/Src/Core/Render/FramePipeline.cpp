@@ -0,0 +1,152 @@
+#include "Core/Render/FramePipeline.h"
+
+#include <algorithm>
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	FramePipeline::FramePipeline() noexcept
+	{
+		// Started once every attribute is constructed
+		_gameThread = std::thread(&FramePipeline::Run, this);
+	}
+
+	FramePipeline::~FramePipeline() noexcept
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this] { return !_hasJob; });
+			_quit = true;
+		}
+
+		_condition.notify_all();
+		_gameThread.join();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void FramePipeline::Run() noexcept
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		while (true)
+		{
+			_condition.wait(lock, [this] { return _hasJob || _quit; });
+
+			if (_quit)
+				return;
+
+			std::function<void(RenderSnapshot&)> job = std::move(_job);
+
+			lock.unlock();
+			Execute(job);
+			lock.lock();
+
+			_hasJob = false;
+			_condition.notify_all();
+		}
+	}
+
+	void FramePipeline::Execute(const std::function<void(RenderSnapshot&)>& job) noexcept
+	{
+		// The render thread only reads the other snapshot until the next Sync
+		RenderSnapshot& snapshot = _snapshots[(_renderIndex + 1) % RENDER_SNAPSHOT_COUNT];
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+		job(snapshot);
+
+		snapshot.frame = ++_frame;
+		snapshot.begin = begin;
+
+		_gameTime = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	void FramePipeline::Simulate(std::function<void(RenderSnapshot&)> job) noexcept
+	{
+		if (_depth == 1)
+		{
+			Execute(job);
+			_renderIndex = (_renderIndex + 1) % RENDER_SNAPSHOT_COUNT;
+		}
+		else
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_job = std::move(job);
+				_hasJob = true;
+				_pending = true;
+			}
+
+			_condition.notify_all();
+		}
+
+		_renderBegin = std::chrono::steady_clock::now();
+	}
+
+	void FramePipeline::Sync() noexcept
+	{
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		_metrics.renderTime = std::chrono::duration<QXdouble>(now - _renderBegin).count();
+
+		// Snapshot drawn during this frame, presented at the end of it
+		_renderedFrame = _snapshots[_renderIndex].frame;
+		_renderedBegin = _snapshots[_renderIndex].begin;
+
+		_metrics.waitTime = 0.0;
+
+		if (_pending)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_condition.wait(lock, [this] { return !_hasJob; });
+			}
+
+			_metrics.waitTime = std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - now).count();
+
+			_renderIndex = (_renderIndex + 1) % RENDER_SNAPSHOT_COUNT;
+			_pending = false;
+		}
+
+		// The game thread is idle, the time of its update is published with its snapshot
+		_metrics.gameTime = _gameTime;
+	}
+
+	void FramePipeline::Present() noexcept
+	{
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+		// First frame and frames without a new snapshot are not sampled
+		if (_lastFrame.time_since_epoch().count() == 0 || _renderedFrame == 0 || _renderedFrame == _presentedFrame)
+		{
+			_lastFrame = now;
+			return;
+		}
+
+		_metrics.frameTime = std::chrono::duration<QXdouble>(now - _lastFrame).count();
+		_metrics.latency = std::chrono::duration<QXdouble>(now - _renderedBegin).count();
+		_lastFrame = now;
+		_presentedFrame = _renderedFrame;
+
+		_frameTimes[_sampleIndex] = _metrics.frameTime;
+		_latencies[_sampleIndex] = _metrics.latency;
+		_sampleIndex = (_sampleIndex + 1) % FRAME_METRICS_WINDOW;
+		_sampleCount = std::min(_sampleCount + 1, (QXuint)FRAME_METRICS_WINDOW);
+
+		QXdouble frame_sum = 0.0, latency_sum = 0.0, latency_max = 0.0;
+		for (QXuint i = 0; i < _sampleCount; ++i)
+		{
+			frame_sum += _frameTimes[i];
+			latency_sum += _latencies[i];
+			latency_max = std::max(latency_max, _latencies[i]);
+		}
+
+		_metrics.averageFrameTime = frame_sum / _sampleCount;
+		_metrics.averageLatency = latency_sum / _sampleCount;
+		_metrics.maxLatency = latency_max;
+	}
+
+#pragma endregion
+}
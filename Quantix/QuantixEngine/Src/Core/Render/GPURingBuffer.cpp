@@ -0,0 +1,155 @@
+#include "Core/Render/GPURingBuffer.h"
+
+#include <glad/glad.h>
+#include <cstring>
+#include <algorithm>
+
+#include "Core/Debugger/Logger.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	GPURingBuffer::GPURingBuffer(QXsizei regionSize) noexcept :
+		_regionSize { regionSize }
+	{
+		QXint uniform_alignment, storage_alignment;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform_alignment);
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storage_alignment);
+
+		// Both are powers of two, the largest one suits both kinds of ranges
+		QXint alignment = std::max(uniform_alignment, storage_alignment);
+		_alignment = alignment > 0 ? (QXsizei)alignment : 256;
+
+		Create();
+	}
+
+	GPURingBuffer::~GPURingBuffer() noexcept
+	{
+		Release();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void GPURingBuffer::Create() noexcept
+	{
+		QXsizei size = _regionSize * RING_BUFFER_FRAMES;
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glCreateBuffers(1, &_id);
+		glNamedBufferStorage(_id, size, nullptr, flags);
+		_data = (QXbyte*)glMapNamedBufferRange(_id, 0, size, flags);
+
+		if (_data == nullptr)
+			LOG(ERROR, "failed to map the ring buffer");
+
+		_offset = 0;
+	}
+
+	void GPURingBuffer::Release() noexcept
+	{
+		for (QXuint i = 0; i < RING_BUFFER_FRAMES; ++i)
+		{
+			Wait(i);
+		}
+
+		if (_id)
+		{
+			glUnmapNamedBuffer(_id);
+			glDeleteBuffers(1, &_id);
+		}
+
+		_id = 0;
+		_data = nullptr;
+	}
+
+	void GPURingBuffer::Wait(QXuint region) noexcept
+	{
+		GLsync fence = (GLsync)_fences[region];
+		if (fence == nullptr)
+			return;
+
+		// The first wait flushes the commands that signal the fence
+		GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		while (true)
+		{
+			GLenum result = glClientWaitSync(fence, flags, 1000000);
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+				break;
+
+			flags = 0;
+		}
+
+		glDeleteSync(fence);
+		_fences[region] = nullptr;
+	}
+
+	void GPURingBuffer::BeginFrame() noexcept
+	{
+		// The frame did not fit, the ring is recreated before anything is written in it
+		if (_overflow)
+		{
+			Release();
+			_regionSize *= 2;
+			Create();
+			_overflow = false;
+		}
+
+		_region = (_region + 1) % RING_BUFFER_FRAMES;
+		Wait(_region);
+
+		_offset = 0;
+	}
+
+	void GPURingBuffer::EndFrame() noexcept
+	{
+		_fences[_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	void* GPURingBuffer::Allocate(QXsizei size, QXuint& offset) noexcept
+	{
+		QXsizei aligned = (_offset + _alignment - 1) / _alignment * _alignment;
+
+		if (_data == nullptr || aligned + size > _regionSize)
+		{
+			if (!_overflow)
+				LOG(ERROR, "ring buffer region is full, it grows on the next frame");
+			_overflow = true;
+
+			return nullptr;
+		}
+
+		_offset = aligned + size;
+		offset = (QXuint)(_region * _regionSize + aligned);
+
+		return _data + offset;
+	}
+
+	QXbool GPURingBuffer::BindUniform(QXuint index, const void* data, QXsizei size) noexcept
+	{
+		QXuint offset;
+		void* memory = Allocate(size, offset);
+
+		if (memory == nullptr)
+			return false;
+
+		memcpy(memory, data, size);
+		BindRange(index, offset, size);
+
+		return true;
+	}
+
+	void GPURingBuffer::BindRange(QXuint index, QXuint offset, QXsizei size) noexcept
+	{
+		glBindBufferRange(GL_UNIFORM_BUFFER, index, _id, offset, size);
+	}
+
+	void GPURingBuffer::BindStorage(QXuint index, QXuint offset, QXsizei size) noexcept
+	{
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, index, _id, offset, size);
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,99 @@
+#include "Core/Render/LODSelector.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Quantix::Core::Render
+{
+	// Screen size under which a mesh goes from a level to the next one
+	static const QXfloat LOD_SCREEN_SIZES[MODEL_MAX_LOD - 1] = { 0.3f, 0.15f, 0.07f };
+
+#pragma region Functions
+
+	QXfloat LODSelector::ComputeScreenSize(const RenderMesh& mesh, const Math::QXvec3& eye, QXfloat projScale) noexcept
+	{
+		Resources::Model* model = mesh.model;
+		const Math::QXmat4& trs = mesh.trs;
+
+		const Math::QXvec3& bounds_min = model->GetBoundsMin();
+		const Math::QXvec3& bounds_max = model->GetBoundsMax();
+
+		QXfloat local_center[3] = { (bounds_min.x + bounds_max.x) * 0.5f, (bounds_min.y + bounds_max.y) * 0.5f, (bounds_min.z + bounds_max.z) * 0.5f };
+		QXfloat half_size[3] = { (bounds_max.x - bounds_min.x) * 0.5f, (bounds_max.y - bounds_min.y) * 0.5f, (bounds_max.z - bounds_min.z) * 0.5f };
+
+		QXfloat center[3];
+		QXfloat scale = 0.f;
+		for (QXuint i = 0; i < 3; ++i)
+		{
+			center[i] = trs.array[i] * local_center[0] + trs.array[4 + i] * local_center[1] + trs.array[8 + i] * local_center[2] + trs.array[12 + i];
+
+			// Biggest scale of the axes keeps the sphere around the scaled box
+			QXfloat axis = trs.array[i * 4] * trs.array[i * 4] + trs.array[i * 4 + 1] * trs.array[i * 4 + 1] + trs.array[i * 4 + 2] * trs.array[i * 4 + 2];
+			scale = std::max(scale, axis);
+		}
+
+		QXfloat radius = std::sqrt(half_size[0] * half_size[0] + half_size[1] * half_size[1] + half_size[2] * half_size[2]) * std::sqrt(scale);
+
+		QXfloat dx = center[0] - eye.x, dy = center[1] - eye.y, dz = center[2] - eye.z;
+		QXfloat distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+		// Inside the sphere, the mesh fills the view
+		if (distance <= radius)
+			return 1.f;
+
+		return radius * projScale / distance;
+	}
+
+	QXuint LODSelector::ComputeLOD(QXfloat screenSize, QXuint lodCount) noexcept
+	{
+		QXuint lod = 0;
+		while (lod + 1 < lodCount && screenSize < LOD_SCREEN_SIZES[lod])
+			lod++;
+
+		return lod;
+	}
+
+	QXuint LODSelector::Select(const RenderMesh& mesh, const Math::QXvec3& eye, QXfloat projScale) noexcept
+	{
+		QXuint lod_count = mesh.model->GetLODCount();
+		QXfloat screen_size = ComputeScreenSize(mesh, eye, projScale);
+
+		auto it = _currentLODs.find(mesh.id);
+		if (it == _currentLODs.end())
+		{
+			QXuint lod = ComputeLOD(screen_size, lod_count);
+			_currentLODs[mesh.id] = { lod, _view };
+
+			return lod;
+		}
+
+		// The size has to go past the threshold by the hysteresis to change of level
+		QXuint lod = std::min(it->second.lod, lod_count - 1);
+		while (lod + 1 < lod_count && screen_size < LOD_SCREEN_SIZES[lod] * (1.f - LOD_HYSTERESIS))
+			lod++;
+		while (lod > 0 && screen_size > LOD_SCREEN_SIZES[lod - 1] * (1.f + LOD_HYSTERESIS))
+			lod--;
+
+		it->second.lod = lod;
+		it->second.view = _view;
+
+		return lod;
+	}
+
+	void LODSelector::Prune() noexcept
+	{
+		_view++;
+		if (_view % LOD_PRUNE_PERIOD != 0)
+			return;
+
+		for (auto it = _currentLODs.begin(); it != _currentLODs.end();)
+		{
+			if (_view - it->second.view > LOD_PRUNE_PERIOD)
+				it = _currentLODs.erase(it);
+			else
+				++it;
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,382 @@
+#include "Core/Render/OcclusionCulling.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Core/Threading/JobSystem.h"
+
+#if defined(_M_X64) || defined(__AVX2__)
+#define QX_OCCLUSION_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// Clip space w under which a vertex is considered behind the camera
+#define OCCLUSION_NEAR_W 0.0001f
+
+namespace Quantix::Core::Render
+{
+	/**
+	 * @brief Check if the cpu and the os support AVX2
+	 *
+	 * @return QXbool true if AVX2 can be used
+	 */
+	static QXbool HasAVX2() noexcept
+	{
+#if defined(__AVX2__)
+		return true;
+#elif defined(_MSC_VER) && defined(_M_X64)
+		QXint info[4];
+		__cpuid(info, 1);
+
+		// OSXSAVE and AVX, then check the os saves the ymm registers
+		if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		__cpuidex(info, 7, 0);
+
+		return (info[1] & (1 << 5)) != 0;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Transform a point by a column major matrix
+	 *
+	 * @param mat matrix to use
+	 * @param point point to transform
+	 * @param out clip space position
+	 */
+	static void TransformPoint(const Math::QXmat4& mat, const Math::QXvec3& point, QXfloat out[4]) noexcept
+	{
+		for (QXuint i = 0; i < 4; ++i)
+			out[i] = mat.array[i] * point.x + mat.array[4 + i] * point.y + mat.array[8 + i] * point.z + mat.array[12 + i];
+	}
+
+	/**
+	 * @brief Check if a bounding box can be in the view, the box is out when its corners are all outside
+	 * of the same clip plane
+	 *
+	 * @param mvp projection * view * model matrix
+	 * @param boundsMin minimum of the box in model space
+	 * @param boundsMax maximum of the box in model space
+	 * @return QXbool false if the box is out of the view
+	 */
+	static QXbool InFrustum(const Math::QXmat4& mvp, const Math::QXvec3& boundsMin, const Math::QXvec3& boundsMax) noexcept
+	{
+		// One bit per plane, set while every corner is outside of it
+		QXuint outside = 0x3F;
+
+		for (QXuint i = 0; i < 8 && outside; ++i)
+		{
+			Math::QXvec3 corner { (i & 1) ? boundsMax.x : boundsMin.x, (i & 2) ? boundsMax.y : boundsMin.y, (i & 4) ? boundsMax.z : boundsMin.z };
+			QXfloat clip[4];
+
+			TransformPoint(mvp, corner, clip);
+
+			QXuint planes = 0;
+			planes |= (clip[0] < -clip[3]) << 0;
+			planes |= (clip[0] > clip[3]) << 1;
+			planes |= (clip[1] < -clip[3]) << 2;
+			planes |= (clip[1] > clip[3]) << 3;
+			planes |= (clip[3] < OCCLUSION_NEAR_W) << 4;
+			planes |= (clip[2] > clip[3]) << 5;
+
+			outside &= planes;
+		}
+
+		return outside == 0;
+	}
+
+#pragma region Constructors
+
+	OcclusionCulling::OcclusionCulling() noexcept :
+		_depth(OCCLUSION_WIDTH * OCCLUSION_HEIGHT, 1.f),
+		_hiZ((OCCLUSION_WIDTH / OCCLUSION_TILE_SIZE) * (OCCLUSION_HEIGHT / OCCLUSION_TILE_SIZE), 1.f),
+		_useAVX2 { HasAVX2() }
+	{}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void OcclusionCulling::AddOccluder(const RenderMesh& mesh) noexcept
+	{
+		Resources::Model* model = mesh.model;
+		Math::QXmat4 mvp = _viewProj * mesh.trs;
+
+		if (!InFrustum(mvp, model->GetBoundsMin(), model->GetBoundsMax()))
+			return;
+
+		// The simplified levels keep the silhouette, a few triangles are enough to hide the meshes behind
+		const std::vector<Resources::Vertex>& vertices = model->GetVertices();
+		const std::vector<QXuint>& indices = model->GetLODIndices(model->GetLODCount() - 1);
+
+		if (_stamps.size() < vertices.size())
+		{
+			_stamps.resize(vertices.size(), 0);
+			_clip.resize(vertices.size() * 4);
+		}
+
+		// A new stamp marks every vertex as not transformed yet for this occluder
+		if (++_stamp == 0)
+		{
+			std::fill(_stamps.begin(), _stamps.end(), 0);
+			_stamp = 1;
+		}
+
+		for (QXsizei i = 0; i < indices.size(); ++i)
+		{
+			QXuint index = indices[i];
+			if (_stamps[index] == _stamp)
+				continue;
+
+			TransformPoint(mvp, vertices[index].position, &_clip[index * 4]);
+			_stamps[index] = _stamp;
+		}
+
+		for (QXsizei i = 0; i + 2 < indices.size(); i += 3)
+		{
+			ScreenTriangle triangle;
+			QXbool behind = false;
+
+			for (QXuint j = 0; j < 3 && !behind; ++j)
+			{
+				const QXfloat* vertex = &_clip[indices[i + j] * 4];
+
+				// Triangles crossing the near plane are dropped, an occluder can only hide less
+				if (vertex[3] < OCCLUSION_NEAR_W)
+				{
+					behind = true;
+					break;
+				}
+
+				QXfloat inv_w = 1.f / vertex[3];
+				triangle.x[j] = (vertex[0] * inv_w * 0.5f + 0.5f) * OCCLUSION_WIDTH;
+				triangle.y[j] = (vertex[1] * inv_w * 0.5f + 0.5f) * OCCLUSION_HEIGHT;
+				triangle.z[j] = vertex[2] * inv_w * 0.5f + 0.5f;
+			}
+
+			if (behind)
+				continue;
+
+			// Back faces and degenerated triangles are skipped, occluders are closed meshes
+			QXfloat area = (triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) - (triangle.y[1] - triangle.y[0]) * (triangle.x[2] - triangle.x[0]);
+			if (area <= 0.f)
+				continue;
+
+			_triangles.push_back(triangle);
+		}
+	}
+
+	void OcclusionCulling::RasterizeBand(QXuint firstRow, QXuint lastRow) noexcept
+	{
+		for (QXsizei t = 0; t < _triangles.size(); ++t)
+		{
+			const ScreenTriangle& tri = _triangles[t];
+
+			QXint min_x = (QXint)std::floor(std::min({ tri.x[0], tri.x[1], tri.x[2] }));
+			QXint max_x = (QXint)std::ceil(std::max({ tri.x[0], tri.x[1], tri.x[2] }));
+			QXint min_y = (QXint)std::floor(std::min({ tri.y[0], tri.y[1], tri.y[2] }));
+			QXint max_y = (QXint)std::ceil(std::max({ tri.y[0], tri.y[1], tri.y[2] }));
+
+			min_x = std::max(min_x, 0) & ~7;
+			max_x = std::min(max_x, OCCLUSION_WIDTH);
+			min_y = std::max(min_y, (QXint)firstRow);
+			max_y = std::min(max_y, (QXint)lastRow);
+
+			if (min_x >= max_x || min_y >= max_y)
+				continue;
+
+			// Edge equations E(p) = a * x + b * y + c, positive inside a counter clockwise triangle
+			QXfloat a[3], b[3], c[3];
+			for (QXuint i = 0; i < 3; ++i)
+			{
+				QXuint j = (i + 1) % 3;
+				a[i] = tri.y[i] - tri.y[j];
+				b[i] = tri.x[j] - tri.x[i];
+				c[i] = -(a[i] * tri.x[i] + b[i] * tri.y[i]);
+			}
+
+			// Depth plane from the barycentric weights of the edges facing each vertex
+			QXfloat inv_area = 1.f / (c[0] + c[1] + c[2]);
+			QXfloat dz_dx = (a[1] * tri.z[0] + a[2] * tri.z[1] + a[0] * tri.z[2]) * inv_area;
+			QXfloat dz_dy = (b[1] * tri.z[0] + b[2] * tri.z[1] + b[0] * tri.z[2]) * inv_area;
+			QXfloat z_0 = (c[1] * tri.z[0] + c[2] * tri.z[1] + c[0] * tri.z[2]) * inv_area;
+
+			for (QXint y = min_y; y < max_y; ++y)
+			{
+				QXfloat py = (QXfloat)y + 0.5f;
+				QXfloat* row = &_depth[(QXsizei)y * OCCLUSION_WIDTH];
+				QXint x = min_x;
+
+#ifdef QX_OCCLUSION_AVX2
+				if (_useAVX2)
+				{
+					const __m256 offsets = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+					const __m256 zero = _mm256_setzero_ps();
+
+					for (; x < max_x; x += 8)
+					{
+						__m256 px = _mm256_add_ps(_mm256_set1_ps((QXfloat)x), offsets);
+
+						__m256 e0 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(a[0]), px), _mm256_set1_ps(b[0] * py + c[0]));
+						__m256 e1 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(a[1]), px), _mm256_set1_ps(b[1] * py + c[1]));
+						__m256 e2 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(a[2]), px), _mm256_set1_ps(b[2] * py + c[2]));
+
+						__m256 inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(e0, zero, _CMP_GE_OQ), _mm256_cmp_ps(e1, zero, _CMP_GE_OQ)),
+											_mm256_cmp_ps(e2, zero, _CMP_GE_OQ));
+
+						if (_mm256_movemask_ps(inside) == 0)
+							continue;
+
+						__m256 z = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(dz_dx), px), _mm256_set1_ps(dz_dy * py + z_0));
+						__m256 depth = _mm256_loadu_ps(row + x);
+
+						_mm256_storeu_ps(row + x, _mm256_blendv_ps(depth, _mm256_min_ps(depth, z), inside));
+					}
+
+					continue;
+				}
+#endif
+
+				for (; x < max_x; ++x)
+				{
+					QXfloat px = (QXfloat)x + 0.5f;
+
+					if (a[0] * px + b[0] * py + c[0] < 0.f || a[1] * px + b[1] * py + c[1] < 0.f || a[2] * px + b[2] * py + c[2] < 0.f)
+						continue;
+
+					row[x] = std::min(row[x], dz_dx * px + dz_dy * py + z_0);
+				}
+			}
+		}
+	}
+
+	void OcclusionCulling::BuildHiZ(QXuint firstRow, QXuint lastRow) noexcept
+	{
+		const QXuint tile_columns = OCCLUSION_WIDTH / OCCLUSION_TILE_SIZE;
+
+		for (QXuint tile_y = firstRow / OCCLUSION_TILE_SIZE; tile_y < lastRow / OCCLUSION_TILE_SIZE; ++tile_y)
+		{
+			for (QXuint tile_x = 0; tile_x < tile_columns; ++tile_x)
+			{
+				QXfloat farthest = 0.f;
+
+				for (QXuint y = 0; y < OCCLUSION_TILE_SIZE; ++y)
+				{
+					const QXfloat* row = &_depth[(tile_y * OCCLUSION_TILE_SIZE + y) * OCCLUSION_WIDTH + tile_x * OCCLUSION_TILE_SIZE];
+
+					for (QXuint x = 0; x < OCCLUSION_TILE_SIZE; ++x)
+						farthest = std::max(farthest, row[x]);
+				}
+
+				_hiZ[tile_y * tile_columns + tile_x] = farthest;
+			}
+		}
+	}
+
+	void OcclusionCulling::Update(const Math::QXmat4& viewProj, const std::vector<RenderMesh>& meshes) noexcept
+	{
+		_viewProj = viewProj;
+		_triangles.clear();
+
+		std::fill(_depth.begin(), _depth.end(), 1.f);
+
+		for (QXsizei i = 0; i < meshes.size(); ++i)
+		{
+			const RenderMesh& mesh = meshes[i];
+
+			if (!mesh.isStatic || !mesh.model || !mesh.model->IsReady())
+				continue;
+
+			AddOccluder(mesh);
+		}
+
+		// Each job owns a band of rows, no synchronisation is needed on the depth buffer
+		Threading::JobSystem::GetInstance()->ParallelFor(OCCLUSION_HEIGHT / OCCLUSION_BAND_HEIGHT, 1, [this](QXsizei begin, QXsizei end)
+			{
+				for (QXsizei band = begin; band < end; ++band)
+				{
+					QXuint row = (QXuint)band * OCCLUSION_BAND_HEIGHT;
+
+					RasterizeBand(row, row + OCCLUSION_BAND_HEIGHT);
+					BuildHiZ(row, row + OCCLUSION_BAND_HEIGHT);
+				}
+			});
+	}
+
+	QXbool OcclusionCulling::IsVisible(const RenderMesh& mesh) const noexcept
+	{
+		Resources::Model* model = mesh.model;
+		if (!model || !model->IsReady())
+			return true;
+
+		Math::QXmat4 mvp = _viewProj * mesh.trs;
+
+		const Math::QXvec3& bounds_min = model->GetBoundsMin();
+		const Math::QXvec3& bounds_max = model->GetBoundsMax();
+
+		QXfloat min_x = 1.f, min_y = 1.f, max_x = -1.f, max_y = -1.f;
+		QXfloat nearest = 1.f;
+
+		for (QXuint i = 0; i < 8; ++i)
+		{
+			Math::QXvec3 corner { (i & 1) ? bounds_max.x : bounds_min.x, (i & 2) ? bounds_max.y : bounds_min.y, (i & 4) ? bounds_max.z : bounds_min.z };
+			QXfloat clip[4];
+
+			TransformPoint(mvp, corner, clip);
+
+			// Box crossing the near plane, always drawn
+			if (clip[3] < OCCLUSION_NEAR_W)
+				return true;
+
+			QXfloat inv_w = 1.f / clip[3];
+			min_x = std::min(min_x, clip[0] * inv_w);
+			max_x = std::max(max_x, clip[0] * inv_w);
+			min_y = std::min(min_y, clip[1] * inv_w);
+			max_y = std::max(max_y, clip[1] * inv_w);
+			nearest = std::min(nearest, clip[2] * inv_w * 0.5f + 0.5f);
+		}
+
+		// Out of the view
+		if (max_x < -1.f || min_x > 1.f || max_y < -1.f || min_y > 1.f || nearest > 1.f)
+			return false;
+
+		const QXint tile_columns = OCCLUSION_WIDTH / OCCLUSION_TILE_SIZE;
+		const QXint tile_rows = OCCLUSION_HEIGHT / OCCLUSION_TILE_SIZE;
+
+		QXint first_x = std::clamp((QXint)((min_x * 0.5f + 0.5f) * tile_columns), 0, tile_columns - 1);
+		QXint last_x = std::clamp((QXint)((max_x * 0.5f + 0.5f) * tile_columns), 0, tile_columns - 1);
+		QXint first_y = std::clamp((QXint)((min_y * 0.5f + 0.5f) * tile_rows), 0, tile_rows - 1);
+		QXint last_y = std::clamp((QXint)((max_y * 0.5f + 0.5f) * tile_rows), 0, tile_rows - 1);
+
+		for (QXint y = first_y; y <= last_y; ++y)
+		{
+			for (QXint x = first_x; x <= last_x; ++x)
+			{
+				if (nearest <= _hiZ[y * tile_columns + x])
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	void OcclusionCulling::Cull(const std::vector<RenderMesh>& meshes, std::vector<const RenderMesh*>& visible) const noexcept
+	{
+		visible.clear();
+
+		for (QXsizei i = 0; i < meshes.size(); ++i)
+		{
+			if (IsVisible(meshes[i]))
+				visible.push_back(&meshes[i]);
+		}
+	}
+
+#pragma endregion
+}
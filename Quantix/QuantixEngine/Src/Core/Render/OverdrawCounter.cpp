@@ -0,0 +1,78 @@
+#include "Core/Render/OverdrawCounter.h"
+
+#include <glad/glad.h>
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	OverdrawCounter::~OverdrawCounter() noexcept
+	{
+		for (QXuint i = 0; i < OVERDRAW_QUERIES; ++i)
+		{
+			if (!_frames[i].queries.empty())
+				glDeleteQueries((GLsizei)_frames[i].queries.size(), _frames[i].queries.data());
+		}
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void OverdrawCounter::Begin(QXsizei pixels) noexcept
+	{
+		FrameQueries& frame = _frames[_current];
+
+		// Each view of the frame uses its own query
+		if (frame.used == frame.queries.size())
+		{
+			frame.queries.push_back(0);
+			glGenQueries(1, &frame.queries.back());
+		}
+
+		frame.pixels += pixels;
+		glBeginQuery(GL_SAMPLES_PASSED, frame.queries[frame.used]);
+	}
+
+	void OverdrawCounter::End() noexcept
+	{
+		glEndQuery(GL_SAMPLES_PASSED);
+		_frames[_current].used++;
+	}
+
+	void OverdrawCounter::EndFrame() noexcept
+	{
+		_frames[_current].pending = _frames[_current].used > 0;
+		_current = (_current + 1) % OVERDRAW_QUERIES;
+
+		// Oldest frame in flight, read without stalling once its last query is available
+		FrameQueries& oldest = _frames[_current];
+		if (oldest.pending)
+		{
+			QXint available = 0;
+			glGetQueryObjectiv(oldest.queries[oldest.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+			if (available)
+			{
+				GLuint64 samples = 0;
+				for (QXsizei i = 0; i < oldest.used; ++i)
+				{
+					GLuint64 result;
+					glGetQueryObjectui64v(oldest.queries[i], GL_QUERY_RESULT, &result);
+					samples += result;
+				}
+
+				_overdraw = oldest.pixels ? (QXfloat)((QXdouble)samples / (QXdouble)oldest.pixels) : 0.f;
+			}
+		}
+		else
+			_overdraw = 0.f;
+
+		// The gpu is too far behind or nothing was drawn, the frame is reused without its result
+		oldest.used = 0;
+		oldest.pixels = 0;
+		oldest.pending = false;
+	}
+
+#pragma endregion
+}
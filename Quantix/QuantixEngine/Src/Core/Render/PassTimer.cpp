@@ -0,0 +1,51 @@
+#include "Core/Render/PassTimer.h"
+
+#include "Core/Profiler/GPUProfiler.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	PassTimer::PassTimer() noexcept
+	{
+		Profiling::GPUProfiler::GetInstance()->AddClient();
+	}
+
+	PassTimer::~PassTimer() noexcept
+	{
+		Profiling::GPUProfiler::GetInstance()->RemoveClient();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXbool PassTimer::Resolve() noexcept
+	{
+		Profiling::GPUProfiler* profiler = Profiling::GPUProfiler::GetInstance();
+		if (profiler->GetResolvedFrames() == _resolved)
+			return false;
+
+		_resolved = profiler->GetResolvedFrames();
+		_timings.clear();
+
+		// Nested scopes are the effects inside a pass
+		const std::vector<Profiling::GPUTiming>& timings = profiler->GetTimings();
+		for (QXsizei i = 0; i < timings.size(); ++i)
+		{
+			if (timings[i].depth != 0)
+				continue;
+
+			PassTiming timing;
+			timing.name = timings[i].name;
+			timing.view = timings[i].view;
+			timing.cpuTime = timings[i].cpuTime;
+			timing.gpuTime = timings[i].gpuTime;
+			_timings.push_back(timing);
+		}
+
+		return true;
+	}
+
+#pragma endregion
+}
@@ -64,4 +64,12 @@ namespace Quantix::Core::Render::PostProcess
 
         glEnable(GL_DEPTH_TEST);
 	}
+
+	void Crosshair::SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept
+	{
+        glUniform1i(program->GetLocation("crosshairTex"), 1);
+
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, _crosshairTex->GetId());
+	}
 }
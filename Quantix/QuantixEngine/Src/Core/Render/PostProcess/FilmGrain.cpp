@@ -63,4 +63,14 @@ namespace Quantix::Core::Render::PostProcess
         glBindVertexArray(_VAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
     }
+
+    void FilmGrain::SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept
+    {
+        _counterFilmGrain += 0.01;
+        if (_counterFilmGrain > 100.f)
+            _counterFilmGrain = 0.f;
+
+        glUniform1f(program->GetLocation("uAmount"), _counterFilmGrain);
+        glUniform1f(program->GetLocation("uCoef"), _percentFilmGrain);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "Core/Render/PostProcess/PostProcessComposer.h"
+
+#include <glad/glad.h>
+
+#include "Core/DataStructure/ResourcesManager.h"
+#include "Core/Profiler/Profiler.h"
+#include "Core/Profiler/GPUProfiler.h"
+
+#define UBERPOSTPROCESSVERTEX "../QuantixEngine/Media/Shader/UberPostProcess.vert"
+#define UBERPOSTPROCESSFRAGMENT "../QuantixEngine/Media/Shader/UberPostProcess.frag"
+
+namespace Quantix::Core::Render::PostProcess
+{
+#pragma region Constructors
+
+	PostProcessComposer::PostProcessComposer(DataStructure::ResourcesManager& manager) noexcept :
+		_manager { &manager }
+	{
+		QXuint VBO;
+		// Gen unit quad
+		{
+			quad_vertex Quad[6] =
+			{
+				{ {-1.f,-1.f }, { 0.f, 0.f } }, // bl
+				{ { 1.f,-1.f }, { 1.f, 0.f } }, // br
+				{ { 1.f, 1.f }, { 1.f, 1.f } }, // tr
+
+				{ {-1.f, 1.f }, { 0.f, 1.f } }, // tl
+				{ {-1.f,-1.f }, { 0.f, 0.f } }, // bl
+				{ { 1.f, 1.f }, { 1.f, 1.f } }, // tr
+			};
+
+			// Upload mesh to gpu
+			glGenBuffers(1, &VBO);
+			glBindBuffer(GL_ARRAY_BUFFER, VBO);
+			glBufferData(GL_ARRAY_BUFFER, 6 * sizeof(quad_vertex), Quad, GL_STATIC_DRAW);
+		}
+
+		// Create a vertex array and bind it
+		glGenVertexArrays(1, &_VAO);
+
+		glBindVertexArray(_VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glEnableVertexAttribArray(0);
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(quad_vertex), (void*)OFFSETOF(quad_vertex, Position));
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(quad_vertex), (void*)OFFSETOF(quad_vertex, UV));
+		glBindVertexArray(0);
+	}
+
+	PostProcessComposer::~PostProcessComposer() noexcept
+	{
+		glDeleteVertexArrays(1, &_VAO);
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void PostProcessComposer::Flush(Platform::AppInfo& info, QXuint sceneTexture, QXuint FBO) noexcept
+	{
+		if (_fusedEffects.empty())
+			return;
+
+		QXstring defines;
+		for (QXsizei i = 0; i < _fusedEffects.size(); ++i)
+			defines += QXstring("#define ") + _fusedEffects[i]->GetFusedDefine() + "\n";
+
+		// Each set of defines is compiled once and kept by the resources manager
+		Resources::ShaderProgram* program = _manager->CreateShaderProgram(UBERPOSTPROCESSVERTEX, UBERPOSTPROCESSFRAGMENT, "", defines);
+
+		START_PROFILING("FusedEffects");
+		START_GPU_PROFILING("FusedEffects");
+
+		glDisable(GL_DEPTH_TEST);
+		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+
+		program->Use();
+		glUniform1i(program->GetLocation("scene"), 0);
+
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, sceneTexture);
+
+		for (QXsizei i = 0; i < _fusedEffects.size(); ++i)
+			_fusedEffects[i]->SendFusedData(info, program);
+
+		glBindVertexArray(_VAO);
+		glDrawArrays(GL_TRIANGLES, 0, 6);
+		glBindVertexArray(0);
+
+		glActiveTexture(GL_TEXTURE0);
+		glEnable(GL_DEPTH_TEST);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		STOP_GPU_PROFILING();
+		STOP_PROFILING("FusedEffects");
+
+		_fusedEffects.clear();
+	}
+
+	void PostProcessComposer::Render(std::vector<PostProcessEffect*>& effects, Platform::AppInfo& info, RenderFramebuffer& buffer) noexcept
+	{
+		for (QXsizei i = 0; i < effects.size(); ++i)
+		{
+			if (!effects[i]->enable)
+				continue;
+
+			if (effects[i]->IsFusable())
+			{
+				_fusedEffects.push_back(effects[i]);
+				continue;
+			}
+
+			// Effects sampling neighbouring pixels stay separate nodes and close the current fused pass
+			Flush(info, buffer.texture[0], buffer.FBO);
+
+			START_PROFILING(effects[i]->name);
+			START_GPU_PROFILING(effects[i]->name);
+			effects[i]->Render(info, buffer.texture[0], buffer.texture[1], buffer.FBO);
+			STOP_GPU_PROFILING();
+			STOP_PROFILING(effects[i]->name);
+
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		}
+
+		Flush(info, buffer.texture[0], buffer.FBO);
+	}
+
+#pragma endregion
+}
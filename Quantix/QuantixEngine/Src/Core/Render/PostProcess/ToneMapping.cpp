@@ -67,4 +67,9 @@ namespace Quantix::Core::Render::PostProcess
         glBindVertexArray(_VAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
     }
+
+    void ToneMapping::SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept
+    {
+        glUniformMatrix4fv(program->GetLocation("uColorTransform"), 1, GL_FALSE, _correctionMatrix.array);
+    }
 }
\ No newline at end of file
@@ -63,4 +63,12 @@ namespace Quantix::Core::Render::PostProcess
         glBindVertexArray(_VAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
     }
+
+    void Vignette::SendFusedData(Platform::AppInfo& info, Resources::ShaderProgram* program) noexcept
+    {
+        glUniform2f(program->GetLocation("uResolution"), info.width, info.height);
+
+        glUniform1f(program->GetLocation("uOuterRadius"), _outerRadius);
+        glUniform1f(program->GetLocation("uInnerRadius"), _innerRadius);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "Core/Render/RenderSnapshot.h"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "Core/DataStructure/GameObject2D.h"
+#include "Core/DataStructure/GameObject3D.h"
+#include "Core/Components/FractureMesh.h"
+#include "Core/Threading/JobSystem.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Functions
+
+	void RenderSnapshot::Build(const std::vector<Components::Mesh*>& sceneMeshes, const std::vector<Components::ICollider*>& sceneColliders,
+		const std::vector<Components::Light>& sceneLights, const Platform::AppInfo& appInfo, QXbool displayColliders) noexcept
+	{
+		info = appInfo;
+		lights = sceneLights;
+
+		materials.clear();
+		meshes.clear();
+		batches.clear();
+		instances.clear();
+		colliders.Clear();
+		sprites.clear();
+		views.clear();
+
+		DataStructure::GameObject3D* obj;
+		std::unordered_map<Resources::Material*, QXuint> lookup;
+
+		// Index of the copy of a material, copied the first time a mesh uses it
+		auto copy_material = [this, &lookup](Resources::Material* material)
+		{
+			std::unordered_map<Resources::Material*, QXuint>::iterator it = lookup.find(material);
+			if (it != lookup.end())
+				return it->second;
+
+			RenderMaterial copy;
+			copy.shader = material;
+			material->FillData(copy.data);
+			copy.diffuse = material->GetDiffuseTexture();
+			copy.emissive = material->GetEmissiveTexture();
+
+			QXuint index = (QXuint)materials.size();
+			materials.push_back(copy);
+			lookup[material] = index;
+
+			return index;
+		};
+
+		for (QXsizei i = 0; i < sceneMeshes.size(); ++i)
+		{
+			Components::Mesh* mesh = sceneMeshes[i];
+
+			// Also binds the texture of the material the first time the mesh is ready
+			if (!mesh->IsEnable())
+				continue;
+
+			obj = (DataStructure::GameObject3D*)mesh->GetObject();
+
+			// The cubes of a fractured block are placed from its pieces, drawn in one call
+			if (obj->GetLayer() == DataStructure::Layer::DESTRUCTIBLEMESH)
+			{
+				Components::FractureMesh* fracture = obj->GetComponent<Components::FractureMesh>();
+				if (fracture && fracture->fracture)
+				{
+					RenderBatch batch;
+					batch.id = mesh;
+					batch.model = mesh->GetModel();
+					batch.material = copy_material(mesh->GetMaterial());
+					batch.key = mesh->key;
+					batch.shaderID = mesh->shaderID;
+					batch.textureID = mesh->textureID;
+					batch.first = (QXuint)instances.size();
+					batch.count = (QXuint)fracture->fracture->GetVoxelCount();
+
+					instances.resize(instances.size() + batch.count);
+					fracture->fracture->FillInstances(instances.data() + batch.first);
+
+					batches.push_back(batch);
+					continue;
+				}
+			}
+
+			RenderMesh item;
+			item.id = mesh;
+			item.model = mesh->GetModel();
+			item.material = copy_material(mesh->GetMaterial());
+			item.trs = obj->GetTransform()->GetTRS();
+			item.key = mesh->key;
+			item.shaderID = mesh->shaderID;
+			item.textureID = mesh->textureID;
+			item.isStatic = obj->GetIsStatic();
+
+			meshes.push_back(item);
+		}
+
+		std::sort(meshes.begin(), meshes.end(), [](const RenderMesh& a, const RenderMesh& b) {
+			return a.key < b.key;
+			});
+
+		// Colliders are drawn as lines, the same unit shapes as the collider meshes
+		for (QXsizei i = 0; displayColliders && i < sceneColliders.size(); ++i)
+		{
+			Components::ICollider* collider = sceneColliders[i];
+			obj = (DataStructure::GameObject3D*)collider->GetObject();
+
+			Math::QXmat4 trs = Math::QXmat4::CreateTRSMatrix(obj->GetGlobalPosition() + collider->GetPosition(), obj->GetGlobalRotation().ConjugateQuaternion() * collider->GetRotation(),
+				collider->scale);
+
+			if (collider->typeShape == Components::ETypeShape::CUBE)
+				colliders.Box(trs);
+			else if (collider->typeShape == Components::ETypeShape::SPHERE)
+				colliders.Sphere(trs);
+			else if (collider->typeShape == Components::ETypeShape::CAPSULE)
+				colliders.Capsule(trs, 0.5f, 0.5f);
+		}
+
+		DebugDraw::GetInstance()->Flush(debug);
+	}
+
+	void RenderSnapshot::BuildSprites(const std::vector<Components::Sprite*>& sceneSprites) noexcept
+	{
+		sprites.resize(sceneSprites.size());
+
+		Threading::JobSystem::GetInstance()->ParallelFor(sceneSprites.size(), SNAPSHOT_SPRITE_GRAIN, [this, &sceneSprites](QXsizei begin, QXsizei end)
+			{
+				static const QXfloat quad[4][2] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+
+				for (QXsizei i = begin; i < end; ++i)
+				{
+					Components::Sprite* sprite = sceneSprites[i];
+					DataStructure::GameObject2D* obj = (DataStructure::GameObject2D*)sprite->GetObject();
+
+					const QXfloat* trs = obj->GetTransform()->GetTRS().array;
+					const Math::QXvec2& size = sprite->GetSize();
+					const Math::QXvec4& color = sprite->GetColor();
+
+					RenderSprite& item = sprites[i];
+					for (QXuint c = 0; c < 4; ++c)
+					{
+						QXfloat x = quad[c][0] * size.x;
+						QXfloat y = quad[c][1] * size.y;
+
+						item.corners[c][0] = trs[0] * x + trs[4] * y + trs[12];
+						item.corners[c][1] = trs[1] * x + trs[5] * y + trs[13];
+					}
+
+					item.texture = sprite->GetTexture();
+					item.color = DebugDraw::Color(color.x, color.y, color.z, color.w);
+					item.layer = sprite->GetLayer();
+				}
+			});
+
+		// Sprites of a layer sharing a texture keep the order of the hierarchy
+		std::stable_sort(sprites.begin(), sprites.end(), [](const RenderSprite& a, const RenderSprite& b) {
+			if (a.layer != b.layer)
+				return a.layer < b.layer;
+			return std::less<Resources::Texture*>()(a.texture, b.texture);
+			});
+	}
+
+	QXuint RenderSnapshot::AddView(Components::Camera* cam) noexcept
+	{
+		views.push_back({ cam->GetLookAt(), cam->GetPos() });
+
+		return (QXuint)views.size() - 1;
+	}
+
+#pragma endregion
+}
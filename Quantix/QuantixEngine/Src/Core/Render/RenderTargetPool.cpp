@@ -0,0 +1,171 @@
+#include "Core/Render/RenderTargetPool.h"
+
+#include <glad/glad.h>
+
+#include "Core/Debugger/Logger.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	RenderTargetPool::~RenderTargetPool() noexcept
+	{
+		Clear();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	RenderTarget RenderTargetPool::CreateTarget(const RenderTargetDesc& desc) noexcept
+	{
+		QXint previous_framebuffer;
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous_framebuffer);
+
+		RenderTarget target;
+		target.desc = desc;
+
+		QXbool is_depth = desc.format == GL_DEPTH_COMPONENT || desc.format == GL_DEPTH_COMPONENT24 || desc.format == GL_DEPTH_COMPONENT32F;
+
+		glGenFramebuffers(1, &target.FBO);
+		glBindFramebuffer(GL_FRAMEBUFFER, target.FBO);
+
+		glGenTextures(1, &target.texture);
+		glBindTexture(GL_TEXTURE_2D, target.texture);
+		if (is_depth)
+			glTexImage2D(GL_TEXTURE_2D, 0, desc.format, desc.width, desc.height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+		else
+			glTexImage2D(GL_TEXTURE_2D, 0, desc.format, desc.width, desc.height, 0, GL_RGBA, GL_FLOAT, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		if (is_depth)
+		{
+			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, target.texture, 0);
+			glDrawBuffer(GL_NONE);
+			glReadBuffer(GL_NONE);
+		}
+		else
+		{
+			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.texture, 0);
+
+			QXuint draw_attachments { GL_COLOR_ATTACHMENT0 };
+			glDrawBuffers(1, &draw_attachments);
+		}
+
+		GLenum framebuffer_status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		if (framebuffer_status != GL_FRAMEBUFFER_COMPLETE)
+		{
+			LOG(ERROR, QXstring("render target framebuffer failed to complete (") + std::to_string(framebuffer_status) + ")\n");
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, previous_framebuffer);
+
+		return target;
+	}
+
+	void RenderTargetPool::DestroyTarget(RenderTarget& target) noexcept
+	{
+		glDeleteFramebuffers(1, &target.FBO);
+		glDeleteTextures(1, &target.texture);
+
+		target.FBO = 0;
+		target.texture = 0;
+	}
+
+	RenderTarget RenderTargetPool::Acquire(const RenderTargetDesc& desc) noexcept
+	{
+		for (QXsizei i = 0; i < _entries.size(); ++i)
+		{
+			if (!_entries[i].inUse && _entries[i].target.desc == desc)
+			{
+				_entries[i].inUse = true;
+				_entries[i].idleCount = 0;
+				return _entries[i].target;
+			}
+		}
+
+		PoolEntry entry;
+		entry.target = CreateTarget(desc);
+		entry.inUse = true;
+
+		_entries.push_back(entry);
+
+		return entry.target;
+	}
+
+	void RenderTargetPool::Release(const RenderTarget& target) noexcept
+	{
+		for (QXsizei i = 0; i < _entries.size(); ++i)
+		{
+			if (_entries[i].target.texture == target.texture)
+			{
+				_entries[i].inUse = false;
+				return;
+			}
+		}
+	}
+
+	void RenderTargetPool::Update() noexcept
+	{
+		for (auto it = _entries.begin(); it != _entries.end();)
+		{
+			if (!it->inUse && ++it->idleCount > RENDER_TARGET_MAX_IDLE)
+			{
+				DestroyTarget(it->target);
+				it = _entries.erase(it);
+			}
+			else
+				++it;
+		}
+	}
+
+	void RenderTargetPool::Trim() noexcept
+	{
+		for (auto it = _entries.begin(); it != _entries.end();)
+		{
+			if (!it->inUse)
+			{
+				DestroyTarget(it->target);
+				it = _entries.erase(it);
+			}
+			else
+				++it;
+		}
+	}
+
+	void RenderTargetPool::Clear() noexcept
+	{
+		for (QXsizei i = 0; i < _entries.size(); ++i)
+			DestroyTarget(_entries[i].target);
+
+		_entries.clear();
+	}
+
+	QXsizei RenderTargetPool::GetMemoryUsage() const noexcept
+	{
+		QXsizei size = 0;
+
+		for (QXsizei i = 0; i < _entries.size(); ++i)
+		{
+			const RenderTargetDesc& desc = _entries[i].target.desc;
+			QXsizei pixel_size;
+
+			switch (desc.format)
+			{
+			case GL_RGBA16F:	pixel_size = 8; break;
+			case GL_RGB16F:		pixel_size = 6; break;
+			case GL_RGBA32F:	pixel_size = 16; break;
+			default:			pixel_size = 4; break;
+			}
+
+			size += (QXsizei)desc.width * desc.height * pixel_size;
+		}
+
+		return size;
+	}
+
+#pragma endregion
+}
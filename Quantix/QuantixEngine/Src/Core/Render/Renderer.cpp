@@ -3,8 +3,14 @@
 #include <glad/glad.h>
 #include <stdexcept>
 #include <array>
+#include <cstring>
+#include <cstddef>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
 
 #include "Core/Profiler/Profiler.h"
+#include "Core/Profiler/GPUProfiler.h"
 #include "Core/Render/PostProcess/Skybox.h"
 #include "Core/DataStructure/ResourcesManager.h"
 #include "Core/DataStructure/GameObject3D.h"
@@ -12,45 +18,57 @@
 #include "Core/Render/PostProcess/FilmGrain.h"
 #include "Core/Render/PostProcess/Vignette.h"
 #include "Core/Render/PostProcess/Crosshair.h"
+#include "Core/Threading/JobSystem.h"
 
 namespace Quantix::Core::Render
 {
 #pragma region Constructors
 
 	Renderer::Renderer(Platform::AppInfo& info, DataStructure::ResourcesManager& manager) noexcept :
-		_projLight { Math::QXmat4::CreateOrthographicProjectionMatrix(20, 20, 1.0f, 7.5f) }
+		_projLight { Math::QXmat4::CreateOrthographicProjectionMatrix(20, 20, 1.0f, 7.5f) },
+		_frameData { RING_BUFFER_SIZE }
 	{
 		InitUnidirectionnalShadowBuffer();
 		InitOmnidirectionnalShadowBuffer();
 
-		_cube = manager.CreateModel("media/Mesh/cube.obj");
-		_sphere = manager.CreateModel("media/Mesh/sphere.obj");
-		_caps = manager.CreateModel("media/Mesh/capsule.obj");
 		_wireFrameProgram = manager.CreateShaderProgram("../QuantixEngine/Media/Shader/Wireframe.vert", "../QuantixEngine/Media/Shader/Wireframe.frag");
 		_uniShadowProgram = manager.CreateShaderProgram("../QuantixEngine/Media/Shader/Shadow.vert", "../QuantixEngine/Media/Shader/Shadow.frag");
 		_omniShadowProgram = manager.CreateShaderProgram("../QuantixEngine/Media/Shader/PointShadow.vert", "../QuantixEngine/Media/Shader/PointShadow.frag",
 						"../QuantixEngine/Media/Shader/PointShadow.geom");
+		_depthProgram = manager.CreateShaderProgram("../QuantixEngine/Media/Shader/Depth.vert", "../QuantixEngine/Media/Shader/Depth.frag");
+		_spriteProgram = manager.CreateShaderProgram("../QuantixEngine/Media/Shader/Sprite.vert", "../QuantixEngine/Media/Shader/Sprite.frag");
 
-		// Create uniform buffers
-		glGenBuffers(1, &_viewProjMatrixUBO);
-		glBindBuffer(GL_UNIFORM_BUFFER, _viewProjMatrixUBO);
-		glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(Math::QXmat4), nullptr, GL_STATIC_DRAW);
-		glBindBuffer(GL_UNIFORM_BUFFER, 0);
-
-		glGenBuffers(1, &_viewProjShadowMatrixUBO);
-		glBindBuffer(GL_UNIFORM_BUFFER, _viewProjShadowMatrixUBO);
-		glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(Math::QXmat4), nullptr, GL_STATIC_DRAW);
-		glBindBuffer(GL_UNIFORM_BUFFER, 0);
-		
-		glGenBuffers(1, &_lightUBO);
-		glBindBuffer(GL_UNIFORM_BUFFER, _lightUBO);
-		glBufferData(GL_UNIFORM_BUFFER, 10 * sizeof(Core::Components::Light) + sizeof(QXuint), nullptr, GL_STATIC_DRAW);
-		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		// The light space matrices are never written by the directional shadow pass, cleared once
+		float val = 0.0f;
+		glCreateBuffers(1, &_viewProjShadowMatrixUBO);
+		glNamedBufferStorage(_viewProjShadowMatrixUBO, 2 * sizeof(Math::QXmat4), nullptr, GL_DYNAMIC_STORAGE_BIT);
+		glClearNamedBufferData(_viewProjShadowMatrixUBO, GL_R32F, GL_RED, GL_FLOAT, &val);
 
-		// Set buffers binding
-		glBindBufferBase(GL_UNIFORM_BUFFER, 0, _viewProjMatrixUBO);
+		// Set buffers binding, the others are ranges of the frame ring buffer
 		glBindBufferBase(GL_UNIFORM_BUFFER, 1, _viewProjShadowMatrixUBO);
-		glBindBufferBase(GL_UNIFORM_BUFFER, 2, _lightUBO);
+
+		glCreateBuffers(1, &_instanceFallback);
+		glNamedBufferStorage(_instanceFallback, sizeof(InstanceData), nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+		// Debug lines are read from the frame ring buffer, the range is set before each draw
+		glCreateVertexArrays(1, &_debugVAO);
+		glEnableVertexArrayAttrib(_debugVAO, 0);
+		glVertexArrayAttribFormat(_debugVAO, 0, 3, GL_FLOAT, GL_FALSE, offsetof(DebugVertex, position));
+		glVertexArrayAttribBinding(_debugVAO, 0, 0);
+		glEnableVertexArrayAttrib(_debugVAO, 1);
+		glVertexArrayAttribFormat(_debugVAO, 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(DebugVertex, color));
+		glVertexArrayAttribBinding(_debugVAO, 1, 0);
+
+		glCreateVertexArrays(1, &_spriteVAO);
+		glEnableVertexArrayAttrib(_spriteVAO, 0);
+		glVertexArrayAttribFormat(_spriteVAO, 0, 2, GL_FLOAT, GL_FALSE, offsetof(SpriteVertex, position));
+		glVertexArrayAttribBinding(_spriteVAO, 0, 0);
+		glEnableVertexArrayAttrib(_spriteVAO, 1);
+		glVertexArrayAttribFormat(_spriteVAO, 1, 3, GL_FLOAT, GL_FALSE, offsetof(SpriteVertex, uv));
+		glVertexArrayAttribBinding(_spriteVAO, 1, 0);
+		glEnableVertexArrayAttrib(_spriteVAO, 2);
+		glVertexArrayAttribFormat(_spriteVAO, 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(SpriteVertex, color));
+		glVertexArrayAttribBinding(_spriteVAO, 2, 0);
 
 		InitPostProcessEffects(manager, info);
 	}
@@ -59,14 +77,26 @@ namespace Quantix::Core::Render
 	{
 		glDeleteFramebuffers(1, &_uniShadowBuffer.FBO);
 		glDeleteFramebuffers(1, &_omniShadowBuffer.FBO);
-		glDeleteBuffers(1, &_viewProjMatrixUBO);
 		glDeleteBuffers(1, &_viewProjShadowMatrixUBO);
-		glDeleteBuffers(1, &_lightUBO);
+		glDeleteBuffers(1, &_instanceFallback);
+		glDeleteVertexArrays(1, &_debugVAO);
+		glDeleteVertexArrays(1, &_spriteVAO);
+		Profiling::GPUProfiler::GetInstance()->Release();
+		glDeleteBuffers(1, &_spriteIBO);
+
+		for (std::pair<const QXuint, RenderFramebuffer>& scaled : _scaledBuffers)
+		{
+			glDeleteFramebuffers(1, &scaled.second.FBO);
+			glDeleteTextures(2, scaled.second.texture);
+			glDeleteRenderbuffers(1, &scaled.second.depthBuffer);
+		}
 
 		for (QXsizei i = 0; i < _effects.size(); ++i)
 		{
 			delete _effects[i];
 		}
+
+		delete _composer;
 	}
 
 #pragma endregion
@@ -122,53 +152,8 @@ namespace Quantix::Core::Render
 		fbo.texture[0] = texture[0];
 		fbo.texture[1] = texture[1];
 		fbo.depthBuffer = depth_stencil_renderbuffer;
-	}
-
-	void Renderer::CreateFramebuffer(QXuint width, QXuint height, Framebuffer& fbo) noexcept
-	{
-		QXint previous_framebuffer;
-		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous_framebuffer);
-
-		// Create Framebuffer that will hold 1 color attachement
-		QXuint FBO;
-		glGenFramebuffers(1, &FBO);
-		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
-
-		// Create texture that will be used as color attachment
-		QXuint texture;
-		glGenTextures(1, &texture);
-
-		glBindTexture(GL_TEXTURE_2D, texture);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
-
-		GLuint depth_stencil_renderbuffer;
-		glGenRenderbuffers(1, &depth_stencil_renderbuffer);
-		glBindRenderbuffer(GL_RENDERBUFFER, depth_stencil_renderbuffer);
-		glObjectLabel(GL_RENDERBUFFER, depth_stencil_renderbuffer, -1, "DepthStencilRenderbuffer");
-		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-
-		// Setup attachements
-		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_stencil_renderbuffer);
-
-		QXuint draw_attachments { GL_COLOR_ATTACHMENT0 };
-		glDrawBuffers(1, &draw_attachments);
-
-		GLenum framebuffer_status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-		if (framebuffer_status != GL_FRAMEBUFFER_COMPLETE)
-		{
-			LOG(ERROR, std::string("framebuffer failed to complete (0x%x)\n", framebuffer_status));
-		}
-
-		glBindFramebuffer(GL_FRAMEBUFFER, previous_framebuffer);
-
-		fbo.FBO = FBO;
-		fbo.texture = texture;
-		fbo.depthBuffer = depth_stencil_renderbuffer;
+		fbo.width = width;
+		fbo.height = height;
 	}
 
 	void Renderer::InitUnidirectionnalShadowBuffer() noexcept
@@ -232,14 +217,16 @@ namespace Quantix::Core::Render
 
 	void Renderer::InitPostProcessEffects(DataStructure::ResourcesManager& manager, Platform::AppInfo& info) noexcept
 	{
+		// Sky and image based lighting are baked once, then loaded from the cache
+		_environment = manager.CreateEnvironment("media/Textures/Newport_Loft_Ref.hdr");
+
 		// create Skybox effect
 		PostProcess::PostProcessEffect* skybox = new PostProcess::Skybox(manager.CreateShaderProgram("../QuantixEngine/Media/Shader/SkyboxShader.vert", "../QuantixEngine/Media/Shader/SkyboxShader.frag"),
-			manager.CreateShaderProgram("../QuantixEngine/Media/Shader/CubemapShader.vert", "../QuantixEngine/Media/Shader/CubemapShader.frag"),
-			manager.CreateModel("media/Mesh/cube.obj"), manager.CreateHDRTexture("media/Textures/Newport_Loft_Ref.hdr"));
+			manager.CreateModel("media/Mesh/cube.obj"), _environment);
 
-		PostProcess::PostProcessEffect* bloom = new PostProcess::Bloom(manager.CreateShaderProgram("../QuantixEngine/Media/Shader/bloomBlur.vert", "../QuantixEngine/Media/Shader/Blur.frag"),
+		_bloom = new PostProcess::Bloom(manager.CreateShaderProgram("../QuantixEngine/Media/Shader/bloomBlur.vert", "../QuantixEngine/Media/Shader/Blur.frag"),
 			manager.CreateShaderProgram("../QuantixEngine/Media/Shader/bloomBlur.vert", "../QuantixEngine/Media/Shader/Bloom.frag"),
-			manager.CreateModel("media/Mesh/quad.obj"), info);
+			manager.CreateModel("media/Mesh/quad.obj"));
 
 		PostProcess::PostProcessEffect* toneMapping = new PostProcess::ToneMapping(manager.CreateShaderProgram("../QuantixEngine/Media/Shader/ToneMapping.vert", "../QuantixEngine/Media/Shader/ToneMapping.frag"),
 			manager.CreateModel("media/Mesh/quad.obj"), info);
@@ -254,36 +241,46 @@ namespace Quantix::Core::Render
 			info, manager.CreateTexture("media/Textures/Crosshair.png"));
 
 		_effects.push_back(skybox);
-		_effects.push_back(bloom);
+		_effects.push_back(_bloom);
 		_effects.push_back(toneMapping);
 		_effects.push_back(filmGrain);
 		_effects.push_back(vignette);
 		_effects.push_back(crosshair);
+
+		_composer = new PostProcess::PostProcessComposer(manager);
 	}
 
-	QXuint Renderer::Draw(std::vector<Components::Mesh*>& mesh, std::vector<Components::ICollider*>& colliders, std::vector<Core::Components::Light>& lights,
-		Core::Platform::AppInfo& info, Components::Camera* cam, RenderFramebuffer& buffer, bool displayColliders) noexcept
+	QXuint Renderer::Draw(const RenderSnapshot& snapshot, QXuint view, RenderFramebuffer& buffer, bool displayColliders) noexcept
 	{
+		// Nothing was simulated yet
+		if (!snapshot.IsValid() || view >= snapshot.views.size() || snapshot.lights.empty())
+			return buffer.texture[0];
+
 		START_PROFILING("draw");
+		Profiling::GPUProfiler::GetInstance()->SetView(view);
 
-		static QXuint count = 0;
+		Platform::AppInfo info = snapshot.info;
+		const std::vector<Components::Light>& lights = snapshot.lights;
+		const RenderView& camera = snapshot.views[view];
 
-		if (_needResize)
-		{
-			count++;
+		if (buffer.width != info.width || buffer.height != info.height)
 			ResizeFrameBuffer(info.width, info.height, buffer);
-			if (count > 1)
-			{
-				_needResize = false;
-			}
-		}
 
-		std::sort(mesh.begin(), mesh.end(), [](const Components::Mesh* a, const Components::Mesh* b) {
-			return a->key < b->key;
-			});
+		// The scene and the post process run at the scaled resolution, the result is upscaled in the buffer
+		RenderFramebuffer* target = &buffer;
+		if (_dynamicResolution.GetScale() < 1.f)
+		{
+			target = &_scaledBuffers[buffer.FBO];
+			info.width = _dynamicResolution.Apply(info.width);
+			info.height = _dynamicResolution.Apply(info.height);
+
+			if (target->FBO == 0)
+				CreateRenderFramebuffer(info.width, info.height, *target);
+			else if (target->width != info.width || target->height != info.height)
+				ResizeFrameBuffer(info.width, info.height, *target);
+		}
 
-		QXbyte last_shader_id = -1;
-		QXbyte last_texture_id = -1;
+		glViewport(0, 0, info.width, info.height);
 
 		switch (lights[0].type)
 		{
@@ -301,91 +298,448 @@ namespace Quantix::Core::Render
 		}
 
 		// Bind uniform buffer
-		SendUniformBuffer(lights, info, cam);
+		SendUniformBuffer(lights, info, camera);
 
-		RenderShadows(mesh, info, lights);
+		// Meshes hidden behind static meshes are not submitted
+		START_PROFILING("OcclusionCulling");
+		std::chrono::steady_clock::time_point occlusion_begin = std::chrono::steady_clock::now();
+		_occlusion.Update(info.proj * camera.lookAt, snapshot.meshes);
+		_occlusion.Cull(snapshot.meshes, _visibleMeshes);
+		_occlusionTime += std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - occlusion_begin).count();
+		STOP_PROFILING("OcclusionCulling");
 
-		glBindFramebuffer(GL_FRAMEBUFFER, buffer.FBO);
+		// Each view keeps the level of its meshes for the hysteresis
+		LODSelector& lod_selector = _lodSelectors[buffer.FBO];
 
-		// Clear
-		glClearColor(0.0f, 0.0f, 0.0f, 1.f);
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-		glEnable(GL_CULL_FACE);
-		glEnable(GL_DEPTH_TEST);
+		_visibleLODs.resize(_visibleMeshes.size());
+		for (QXsizei i = 0; i < _visibleMeshes.size(); ++i)
+			_visibleLODs[i] = lod_selector.Select(*_visibleMeshes[i], camera.position, info.proj.array[5]);
+		lod_selector.Prune();
 
-		Resources::Material* material;
-		Resources::Material* last_material = nullptr;
-		DataStructure::GameObject3D* obj;
+		// Nearer meshes first so the depth test rejects the fragments behind them
+		SortFrontToBack(camera.position);
 
-		for (QXuint i = 0; i < mesh.size(); i++)
+		// The batches are not culled, their cubes move apart from the bounds of the mesh
+		static const std::vector<RenderBatch> no_batches;
+		QXbool batches = !snapshot.batches.empty() && UploadBatches(snapshot.instances);
+		const std::vector<RenderBatch>& visible_batches = batches ? snapshot.batches : no_batches;
+
+		QXbool depth_prepass = snapshot.depthPrepass && (!_visibleMeshes.empty() || batches);
+		QXsizei pixels = (QXsizei)info.width * info.height;
+
+		FrameGraphResource scene = _frameGraph.Import("Scene", { target->FBO, target->texture[0], { target->width, target->height, GL_RGBA16F } });
+		FrameGraphResource point_shadow = _frameGraph.Import("PointShadow", { _omniShadowBuffer.FBO, _omniShadowBuffer.texture, { 1024, 1024, GL_DEPTH_COMPONENT } });
+
+		_frameGraph.MarkOutput(scene);
+
+		// Culled when no point light reads the shadow map
+		_frameGraph.AddPass("PointShadows",
+			[&](FrameGraph::PassBuilder& builder) { builder.Write(point_shadow); },
+			[&](const FrameGraph& graph) { RenderShadows(snapshot.meshes, info, lights); });
+
+		// Cleared by a prepass which could not draw every mesh, the opaque pass then writes the depth too
+		QXbool depth_complete = true;
+		if (depth_prepass)
 		{
-			if (!mesh[i]->IsEnable())
-				continue;
-			material = mesh[i]->GetMaterial();
+			_frameGraph.AddPass("DepthPrepass",
+				[&](FrameGraph::PassBuilder& builder) { builder.Write(scene); },
+				[&](const FrameGraph& graph)
+				{
+					_depthOverdraw.Begin(pixels);
+					depth_complete = RenderDepth(_visibleMeshes, _visibleLODs, visible_batches, graph.GetTarget(scene).FBO);
+					_depthOverdraw.End();
+				});
+		}
 
-			// Compare Meshes key for binding each shader one time
-			if (mesh[i]->shaderID != last_shader_id)
+		_frameGraph.AddPass("Opaque",
+			[&](FrameGraph::PassBuilder& builder)
 			{
-				material->UseShader();
-				material->SetFloat3("viewPos", cam->GetPos().e);
-				last_shader_id = mesh[i]->shaderID;
-			}
-
-			// Compare Meshes key for binding each texture once per shader
-			if (mesh[i]->textureID != last_texture_id)
+				if (lights.size() >= 2)
+					builder.Read(point_shadow);
+				if (depth_prepass)
+					builder.Read(scene);
+				builder.Write(scene);
+			},
+			[&](const FrameGraph& graph)
 			{
-				material->SendTextures();
-				last_texture_id = mesh[i]->textureID;
-			}
+				_shadedOverdraw.Begin(pixels);
+				RenderMeshes(_visibleMeshes, _visibleLODs, visible_batches, snapshot.materials, lights, camera, graph.GetTarget(scene).FBO, depth_prepass, depth_complete);
+				_shadedOverdraw.End();
+			});
+
+		if (displayColliders || !snapshot.debug.IsEmpty())
+		{
+			_frameGraph.AddPass("DebugDraw",
+				[&](FrameGraph::PassBuilder& builder) { builder.Read(scene); builder.Write(scene); },
+				[&](const FrameGraph& graph) { RenderDebug(snapshot.debug, displayColliders ? &snapshot.colliders : nullptr); });
+		}
 
-			if (material != last_material)
+		// Per-pixel effects are merged by the composer, bloom and skybox stay separate passes
+		FrameGraphResource bloom_ping = 0, bloom_pong = 0;
+		_frameGraph.AddPass("PostProcess",
+			[&](FrameGraph::PassBuilder& builder)
 			{
-				if (lights.size() >= 2)
+				builder.Read(scene);
+				builder.Write(scene);
+
+				if (_bloom->enable)
 				{
-					material->SendData(_omniShadowBuffer.texture, true);
-					material->SetFloat3("lightPos", lights[1].position.e);
-					material->SendData(_uniShadowBuffer.texture);
+					bloom_ping = builder.Create("BloomPing", { info.width, info.height, GL_RGB16F });
+					bloom_pong = builder.Create("BloomPong", { info.width, info.height, GL_RGB16F });
 				}
-				else
-					material->SendData(_uniShadowBuffer.texture);
-				last_material = material;
+			},
+			[&](const FrameGraph& graph)
+			{
+				if (_bloom->enable)
+					_bloom->SetBlurTargets(graph.GetTarget(bloom_ping), graph.GetTarget(bloom_pong));
+
+				_composer->Render(_effects, info, *target);
+			});
+
+		// Sprites are drawn at the resolution of the buffer, over the upscaled scene
+		FrameGraphResource output = scene;
+		if (target != &buffer)
+		{
+			output = _frameGraph.Import("Output", { buffer.FBO, buffer.texture[0], { buffer.width, buffer.height, GL_RGBA16F } });
+			_frameGraph.MarkOutput(output);
+
+			_frameGraph.AddPass("Upscale",
+				[&](FrameGraph::PassBuilder& builder) { builder.Read(scene); builder.Write(output); },
+				[&](const FrameGraph& graph) { Upscale(*target, buffer); });
+		}
+
+		if (camera.drawSprites && !snapshot.sprites.empty())
+		{
+			_frameGraph.AddPass("Sprites",
+				[&](FrameGraph::PassBuilder& builder) { builder.Read(output); builder.Write(output); },
+				[&](const FrameGraph& graph) { RenderSprites(snapshot.sprites, buffer.width, buffer.height, graph.GetTarget(output).FBO); });
+		}
+
+		_frameGraph.Compile();
+		_frameGraph.Execute();
+
+		STOP_PROFILING("draw");
+
+		return buffer.texture[0];
+	}
+
+	void Renderer::BeginFrame() noexcept
+	{
+		_frameData.BeginFrame();
+		Profiling::GPUProfiler::GetInstance()->BeginFrame();
+		_dynamicResolution.Update();
+		_occlusionTime = 0.0;
+	}
+
+	void Renderer::EndFrame() noexcept
+	{
+		Profiling::GPUProfiler::GetInstance()->EndFrame();
+		_depthOverdraw.EndFrame();
+		_shadedOverdraw.EndFrame();
+		_frameData.EndFrame();
+	}
+
+	void Renderer::SortFrontToBack(const Math::QXvec3& position) noexcept
+	{
+		QXsizei count = _visibleMeshes.size();
+
+		std::vector<QXfloat> depths(count);
+		for (QXsizei i = 0; i < count; ++i)
+		{
+			const QXfloat* translation = &_visibleMeshes[i]->trs.array[12];
+			QXfloat x = translation[0] - position.x;
+			QXfloat y = translation[1] - position.y;
+			QXfloat z = translation[2] - position.z;
+			depths[i] = x * x + y * y + z * z;
+		}
+
+		// The meshes are already sorted by key, the buckets keep their order
+		_drawOrder.resize(count);
+		std::iota(_drawOrder.begin(), _drawOrder.end(), 0);
+		std::sort(_drawOrder.begin(), _drawOrder.end(), [this, &depths](QXuint a, QXuint b)
+			{
+				if (_visibleMeshes[a]->key != _visibleMeshes[b]->key)
+					return _visibleMeshes[a]->key < _visibleMeshes[b]->key;
+				return depths[a] < depths[b];
+			});
+
+		std::vector<const RenderMesh*> meshes(count);
+		std::vector<QXuint> lods(count);
+		_visibleDepths.resize(count);
+		for (QXsizei i = 0; i < count; ++i)
+		{
+			meshes[i] = _visibleMeshes[_drawOrder[i]];
+			lods[i] = _visibleLODs[_drawOrder[i]];
+			_visibleDepths[i] = depths[_drawOrder[i]];
+		}
+
+		_visibleMeshes.swap(meshes);
+		_visibleLODs.swap(lods);
+	}
+
+	QXbool Renderer::UploadBatches(const std::vector<Math::QXmat4>& instances) noexcept
+	{
+		_batchSize = instances.size() * sizeof(Math::QXmat4);
+
+		void* data = _frameData.Allocate(_batchSize, _batchOffset);
+		if (data == nullptr)
+			return false;
+
+		memcpy(data, instances.data(), _batchSize);
+
+		return true;
+	}
+
+	QXbool Renderer::RenderDepth(const std::vector<const RenderMesh*>& meshes, const std::vector<QXuint>& lods, const std::vector<RenderBatch>& batches, QXuint FBO) noexcept
+	{
+		QXsizei count = meshes.size();
+
+		// Draws of the same model and level are consecutive so each group is one instanced draw, front to back inside it
+		_drawOrder.resize(count);
+		std::iota(_drawOrder.begin(), _drawOrder.end(), 0);
+		std::sort(_drawOrder.begin(), _drawOrder.end(), [&](QXuint a, QXuint b)
+			{
+				if (meshes[a]->model != meshes[b]->model)
+					return meshes[a]->model < meshes[b]->model;
+				if (lods[a] != lods[b])
+					return lods[a] < lods[b];
+				return _visibleDepths[a] < _visibleDepths[b];
+			});
+
+		QXuint offset;
+		Math::QXmat4* transforms = count > 0 ? (Math::QXmat4*)_frameData.Allocate(count * sizeof(Math::QXmat4), offset) : nullptr;
+		QXbool complete = count == 0 || transforms != nullptr;
+		if (transforms == nullptr)
+			count = 0;
+
+		for (QXsizei i = 0; i < count; ++i)
+			transforms[i] = meshes[_drawOrder[i]]->trs;
+		if (count > 0)
+			_frameData.BindStorage(1, offset, count * sizeof(Math::QXmat4));
+
+		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+		glClear(GL_DEPTH_BUFFER_BIT);
+		glEnable(GL_CULL_FACE);
+		glEnable(GL_DEPTH_TEST);
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+
+		_depthProgram->Use();
+		QXuint first_instance = _depthProgram->GetLocation("firstInstance");
+
+		QXsizei first = 0;
+		while (first < count)
+		{
+			const RenderMesh* mesh = meshes[_drawOrder[first]];
+			QXuint lod = lods[_drawOrder[first]];
+
+			QXsizei last = first + 1;
+			while (last < count && meshes[_drawOrder[last]]->model == mesh->model && lods[_drawOrder[last]] == lod)
+				++last;
+
+			Resources::Model* model = mesh->model;
+			glUniform1ui(first_instance, (GLuint)first);
+			glBindVertexArray(model->GetDepthVAO());
+
+			glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)model->GetLODIndices(lod).size(), model->GetIndexType(),
+				(void*)model->GetLODOffset(lod), (GLsizei)(last - first));
+
+			first = last;
+		}
+
+		// The cubes of a batch are a range of the batch transforms
+		if (!batches.empty())
+			_frameData.BindStorage(1, _batchOffset, _batchSize);
+
+		for (const RenderBatch& batch : batches)
+		{
+			glUniform1ui(first_instance, batch.first);
+			glBindVertexArray(batch.model->GetDepthVAO());
+
+			glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)batch.model->GetLODIndices(0).size(), batch.model->GetIndexType(),
+				(void*)batch.model->GetLODOffset(0), (GLsizei)batch.count);
+		}
+
+		glBindVertexArray(0);
+		_depthProgram->Unuse();
+
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+		return complete;
+	}
+
+	void Renderer::RenderMeshes(const std::vector<const RenderMesh*>& mesh, const std::vector<QXuint>& lods, const std::vector<RenderBatch>& batches,
+		const std::vector<RenderMaterial>& materials, const std::vector<Core::Components::Light>& lights, const RenderView& camera, QXuint FBO, QXbool depthPrepass, QXbool depthComplete) noexcept
+	{
+		QXbyte last_shader_id = -1;
+
+		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+
+		// Clear, the depth of the prepass is kept
+		glClearColor(0.0f, 0.0f, 0.0f, 1.f);
+		glClear(depthPrepass ? GL_COLOR_BUFFER_BIT : GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glEnable(GL_CULL_FACE);
+		glEnable(GL_DEPTH_TEST);
+
+		// Only the nearest fragment of each pixel passes, it is shaded once. The meshes missing from the prepass write
+		// their depth here, over the one of the batches
+		if (depthPrepass && depthComplete)
+		{
+			glDepthFunc(GL_EQUAL);
+			glDepthMask(GL_FALSE);
+		}
+		else if (depthPrepass)
+			glDepthFunc(GL_LEQUAL);
+
+		// Texture units are shared by every program, they are bound once for the pass
+		glBindTextureUnit(0, _uniShadowBuffer.texture);
+		if (lights.size() >= 2)
+			glBindTextureUnit(1, _omniShadowBuffer.texture);
+
+		UploadMaterials(materials);
+		_texturePool.Bind();
+
+		InstanceData instance;
+		ReserveInstances(mesh.size() + batches.size(), sizeof(InstanceData));
+
+		// Compare Meshes key for binding each shader one time, only the program of the material is used
+		auto use_shader = [&](const RenderMaterial& copy, QXuint shaderID)
+		{
+			if (shaderID == last_shader_id)
+				return;
+
+			Resources::Material* material = copy.shader;
+			material->UseShader();
+			material->SetFloat3("viewPos", camera.position.e);
+			material->SendEnvironment(_environment);
+
+			if (lights.size() >= 2)
+			{
+				material->SetFloat("farPlane", 100.f);
+				material->SetFloat3("lightPos", lights[1].position.e);
 			}
+			last_shader_id = shaderID;
+		};
+
+		for (QXuint i = 0; i < mesh.size(); i++)
+		{
+			use_shader(materials[mesh[i]->material], mesh[i]->shaderID);
 
-			// Draw current mesh
-			obj = (Quantix::Core::DataStructure::GameObject3D*)mesh[i]->GetObject();
+			// Draw current mesh, the material is selected in the storage buffer
+			instance.trs = mesh[i]->trs;
+			instance.materialIndex = mesh[i]->material;
+			BindInstance(i, &instance, sizeof(InstanceData));
 
-			material->SetMat4("TRS", obj->GetTransform()->GetTRS());
-			glBindVertexArray(mesh[i]->GetVAO());
+			Resources::Model* model = mesh[i]->model;
+			glBindVertexArray(model->GetVAO());
 
-			glDrawElements(GL_TRIANGLES, (GLsizei)mesh[i]->GetIndices().size(), GL_UNSIGNED_INT, 0);
+			glDrawElements(GL_TRIANGLES, (GLsizei)model->GetLODIndices(lods[i]).size(), model->GetIndexType(), (void*)model->GetLODOffset(lods[i]));
 
 			glBindVertexArray(0);
 		}
 
-		if (displayColliders)
+		// The cubes of a batch are placed by the transforms of the storage buffer
+		if (!batches.empty())
+			_frameData.BindStorage(1, _batchOffset, _batchSize);
+
+		instance.instanced = 1;
+		for (QXsizei i = 0; i < batches.size(); ++i)
 		{
-			RenderColliders(colliders);
+			const RenderBatch& batch = batches[i];
+			use_shader(materials[batch.material], batch.shaderID);
+
+			instance.materialIndex = batch.material;
+			instance.firstInstance = batch.first;
+			BindInstance(mesh.size() + i, &instance, sizeof(InstanceData));
+
+			glBindVertexArray(batch.model->GetVAO());
+
+			glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)batch.model->GetLODIndices(0).size(), batch.model->GetIndexType(),
+				(void*)batch.model->GetLODOffset(0), (GLsizei)batch.count);
+
+			glBindVertexArray(0);
 		}
 
-		for (QXsizei i = 0; i < _effects.size(); ++i)
+		if (depthPrepass)
 		{
-			if (_effects[i]->enable)
-				_effects[i]->Render(info, buffer.texture[0], buffer.texture[1], buffer.FBO);
+			glDepthFunc(GL_LESS);
+			glDepthMask(GL_TRUE);
+		}
+	}
+
+	void Renderer::ReserveInstances(QXsizei count, QXsizei size) noexcept
+	{
+		QXsizei alignment = _frameData.GetAlignment();
+		_instanceStride = (size + alignment - 1) / alignment * alignment;
 
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		// A full frame data grows on the next frame, until then the draws upload their block one by one
+		_instanceBlocks = count > 0 ? (QXbyte*)_frameData.Allocate(count * _instanceStride, _instanceOffset) : nullptr;
+	}
+
+	void Renderer::BindInstance(QXsizei draw, const void* data, QXsizei size) noexcept
+	{
+		if (_instanceBlocks)
+		{
+			memcpy(_instanceBlocks + draw * _instanceStride, data, size);
+			_frameData.BindRange(4, (QXuint)(_instanceOffset + draw * _instanceStride), size);
+			return;
 		}
 
+		glNamedBufferSubData(_instanceFallback, 0, size, data);
+		glBindBufferRange(GL_UNIFORM_BUFFER, 4, _instanceFallback, 0, size);
+	}
 
-		STOP_PROFILING("draw");
+	void Renderer::UploadMaterials(const std::vector<RenderMaterial>& materials) noexcept
+	{
+		_materialData.resize(materials.size());
 
-		return buffer.texture[0];
+		for (QXsizei i = 0; i < materials.size(); ++i)
+		{
+			const RenderMaterial& material = materials[i];
+			Resources::MaterialData& data = _materialData[i];
+			data = material.data;
+
+			TextureSlot diffuse = _texturePool.GetSlot(material.diffuse);
+			TextureSlot emissive = _texturePool.GetSlot(material.emissive);
+
+			data.diffuseSlot[0] = diffuse.array;
+			data.diffuseSlot[1] = diffuse.layer;
+
+			// The emissive texture is only used on textured materials
+			if (diffuse.array != -1)
+			{
+				data.emissiveSlot[0] = emissive.array;
+				data.emissiveSlot[1] = emissive.layer;
+			}
+		}
+
+		if (_materialData.empty())
+			return;
+
+		QXuint offset;
+		QXsizei size = _materialData.size() * sizeof(Resources::MaterialData);
+		void* data = _frameData.Allocate(size, offset);
+
+		if (data == nullptr)
+			return;
+
+		memcpy(data, _materialData.data(), size);
+		_frameData.BindStorage(0, offset, size);
 	}
 
-	void Renderer::Resize(QXuint width, QXuint height)
+	void Renderer::Upscale(const RenderFramebuffer& source, const RenderFramebuffer& destination) noexcept
 	{
-		_needResize = true;
+		// Only the post processed color is kept, the bright color and the depth are not used anymore
+		glNamedFramebufferReadBuffer(source.FBO, GL_COLOR_ATTACHMENT0);
+		glBlitNamedFramebuffer(source.FBO, destination.FBO, 0, 0, source.width, source.height, 0, 0, destination.width, destination.height,
+			GL_COLOR_BUFFER_BIT, GL_LINEAR);
 
-		((PostProcess::Bloom*)_effects[1])->Resize(width, height);
+		glViewport(0, 0, destination.width, destination.height);
+	}
+
+	void Renderer::Resize(QXuint width, QXuint height)
+	{
+		// Targets of the old size are not reused anymore
+		_frameGraph.GetPool().Trim();
 	}
 
 	void Renderer::ResizeFrameBuffer(QXuint width, QXuint height, RenderFramebuffer& FBO)
@@ -395,6 +749,10 @@ namespace Quantix::Core::Render
 
 		glBindFramebuffer(GL_FRAMEBUFFER, FBO.FBO);
 
+		// Release the attachments of the old size
+		glDeleteTextures(2, FBO.texture);
+		glDeleteRenderbuffers(1, &FBO.depthBuffer);
+
 		// Create texture that will be used as color attachment
 		QXuint texture[2];
 		glGenTextures(2, texture);
@@ -433,10 +791,12 @@ namespace Quantix::Core::Render
 		FBO.texture[0] = texture[0];
 		FBO.texture[1] = texture[1];
 		FBO.depthBuffer = depth_stencil_renderbuffer;
+		FBO.width = width;
+		FBO.height = height;
 	}
 	
-	void Renderer::RenderShadows(std::vector<Core::Components::Mesh*>& meshes, Quantix::Core::Platform::AppInfo& info,
-		std::vector<Core::Components::Light>& lights) noexcept
+	void Renderer::RenderShadows(const std::vector<RenderMesh>& meshes, Quantix::Core::Platform::AppInfo& info,
+		const std::vector<Core::Components::Light>& lights) noexcept
 	{
 		if (lights.size() >= 2)
 		{
@@ -471,7 +831,7 @@ namespace Quantix::Core::Render
 
 			glBindVertexArray(meshes[i]->GetVAO());
 
-			glDrawElements(GL_TRIANGLES, (GLsizei)meshes[i]->GetIndices().size(), GL_UNSIGNED_INT, 0);
+			glDrawElements(GL_TRIANGLES, (GLsizei)meshes[i]->GetIndices().size(), meshes[i]->GetModel()->GetIndexType(), 0);
 			
 			glBindVertexArray(0);
 		}
@@ -484,8 +844,8 @@ namespace Quantix::Core::Render
 		_uniShadowProgram->Unuse();*/
 	}
 
-	void Renderer::RenderPointLightsShadows(std::vector<Core::Components::Mesh*>& meshes, Quantix::Core::Platform::AppInfo& info,
-		std::vector<Core::Components::Light>& lights) noexcept
+	void Renderer::RenderPointLightsShadows(const std::vector<RenderMesh>& meshes, Quantix::Core::Platform::AppInfo& info,
+		const std::vector<Core::Components::Light>& lights) noexcept
 	{
 		Math::QXmat4 views[] = {
 			Math::QXmat4::CreateLookAtMatrix(lights[1].position, lights[1].position + Math::QXvec3{1, 0, 0}, {0, -1, 0}),
@@ -495,6 +855,28 @@ namespace Quantix::Core::Render
 			Math::QXmat4::CreateLookAtMatrix(lights[1].position, lights[1].position + Math::QXvec3{0, 0, 1}, {0, -1, 0}),
 			Math::QXmat4::CreateLookAtMatrix(lights[1].position, lights[1].position + Math::QXvec3{0, 0, -1}, {0, -1, 0}),
 		};
+		Math::QXmat4 proj = Math::QXmat4::CreateProjectionMatrix(20, 20, 0.01f, 100.f, 90.f);
+
+		// A caster is kept if it is visible from one of the faces of the light, every caster is drawn without the culling
+		_visibleShadowCasters.assign(meshes.size(), !_shadowOcclusion);
+		if (_shadowOcclusion)
+		{
+			START_PROFILING("ShadowOcclusionCulling");
+			std::chrono::steady_clock::time_point occlusion_begin = std::chrono::steady_clock::now();
+			for (QXuint face = 0; face < 6; ++face)
+			{
+				_occlusion.Update(proj * views[face], meshes);
+
+				for (QXsizei i = 0; i < meshes.size(); ++i)
+				{
+					if (!_visibleShadowCasters[i])
+						_visibleShadowCasters[i] = _occlusion.IsVisible(meshes[i]);
+				}
+			}
+			_occlusionTime += std::chrono::duration<QXdouble>(std::chrono::steady_clock::now() - occlusion_begin).count();
+			STOP_PROFILING("ShadowOcclusionCulling");
+		}
+
 		_omniShadowProgram->Use();
 
 		glBindFramebuffer(GL_FRAMEBUFFER, _omniShadowBuffer.FBO);
@@ -502,7 +884,7 @@ namespace Quantix::Core::Render
 		glClear(GL_DEPTH_BUFFER_BIT);
 		glViewport(0, 0, 1024, 1024);
 
-		glUniformMatrix4fv(_omniShadowProgram->GetLocation("projection"), 1, GL_FALSE, Math::QXmat4::CreateProjectionMatrix(20, 20, 0.01f, 100.f, 90.f).array);
+		glUniformMatrix4fv(_omniShadowProgram->GetLocation("projection"), 1, GL_FALSE, proj.array);
 
 		for (QXuint i = 0; i < 6; ++i)
 			glUniformMatrix4fv(_omniShadowProgram->GetLocation(QXstring("viewShadows[") + std::to_string(i) + "]"), 1, GL_FALSE, views[i].array);
@@ -512,20 +894,25 @@ namespace Quantix::Core::Render
 
 		QXbyte last_shader_id = -1;
 
-		Quantix::Core::DataStructure::GameObject3D* obj;
+		QXsizei casters = std::count(_visibleShadowCasters.begin(), _visibleShadowCasters.end(), true);
+		ReserveInstances(casters, sizeof(Math::QXmat4));
 
+		QXsizei draw = 0;
 		for (QXuint i = 0; i < meshes.size(); i++)
 		{
-			if (!meshes[i]->IsEnable())
+			if (!_visibleShadowCasters[i])
 				continue;
 
-			obj = (Quantix::Core::DataStructure::GameObject3D*)meshes[i]->GetObject();
+			BindInstance(draw++, meshes[i].trs.array, sizeof(Math::QXmat4));
 
-			glUniformMatrix4fv(_omniShadowProgram->GetLocation("model"), 1, false, obj->GetTransform()->GetTRS().array);
+			Resources::Model* model = meshes[i].model;
+			glBindVertexArray(model->GetVAO());
 
-			glBindVertexArray(meshes[i]->GetVAO());
+			// Shadows use a coarser level than the one seen from the light
+			QXuint lod = std::min(LODSelector::ComputeLOD(LODSelector::ComputeScreenSize(meshes[i], lights[1].position, proj.array[5]), model->GetLODCount()) + SHADOW_LOD_BIAS,
+				model->GetLODCount() - 1);
 
-			glDrawElements(GL_TRIANGLES, (GLsizei)meshes[i]->GetIndices().size(), GL_UNSIGNED_INT, 0);
+			glDrawElements(GL_TRIANGLES, (GLsizei)model->GetLODIndices(lod).size(), model->GetIndexType(), (void*)model->GetLODOffset(lod));
 
 			glBindVertexArray(0);
 		}
@@ -538,75 +925,141 @@ namespace Quantix::Core::Render
 		_omniShadowProgram->Unuse();
 	}
 
-	void Renderer::RenderColliders(std::vector<Components::ICollider*>& colliders) noexcept
+	void Renderer::RenderDebug(const DebugDrawList& debug, const DebugDrawList* colliders) noexcept
 	{
+		QXsizei debug_count = debug.GetVertices().size();
+		QXsizei collider_count = colliders ? colliders->GetVertices().size() : 0;
+
+		if (debug_count + collider_count == 0)
+			return;
+
+		QXuint offset;
+		QXbyte* data = (QXbyte*)_frameData.Allocate((debug_count + collider_count) * sizeof(DebugVertex), offset);
+		if (data == nullptr)
+			return;
+
+		// Both lists are written next to each other and drawn together
+		if (debug_count)
+			memcpy(data, debug.GetVertices().data(), debug_count * sizeof(DebugVertex));
+		if (collider_count)
+			memcpy(data + debug_count * sizeof(DebugVertex), colliders->GetVertices().data(), collider_count * sizeof(DebugVertex));
+
+		glVertexArrayVertexBuffer(_debugVAO, 0, _frameData.GetId(), offset, sizeof(DebugVertex));
+
 		_wireFrameProgram->Use();
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+		glBindVertexArray(_debugVAO);
+
+		glDrawArrays(GL_LINES, 0, (GLsizei)(debug_count + collider_count));
 
-		Math::QXmat4					trs;
-		DataStructure::GameObject3D*	obj;
+		glBindVertexArray(0);
+		_wireFrameProgram->Unuse();
+	}
+
+	void Renderer::RenderSprites(const std::vector<RenderSprite>& sprites, QXuint width, QXuint height, QXuint FBO) noexcept
+	{
+		QXsizei count = sprites.size();
 
-		for (QXuint i = 0; i < colliders.size(); ++i)
+		// The atlas is filled on the render thread, once per run of sprites sharing a texture
+		_spriteRects.resize(count);
+		for (QXsizei i = 0; i < count; ++i)
 		{
-			obj = (Quantix::Core::DataStructure::GameObject3D*)colliders[i]->GetObject();
-			trs = Math::QXmat4::CreateTRSMatrix(obj->GetGlobalPosition() + colliders[i]->GetPosition(), obj->GetGlobalRotation().ConjugateQuaternion() * colliders[i]->GetRotation(),
-				colliders[i]->scale);
+			if (i > 0 && sprites[i].texture == sprites[i - 1].texture)
+				_spriteRects[i] = _spriteRects[i - 1];
+			else
+				_spriteRects[i] = _spriteAtlas.GetRect(sprites[i].texture);
+		}
 
-			glUniformMatrix4fv(_wireFrameProgram->GetLocation("TRS"), 1, false, trs.array);
+		QXuint offset;
+		SpriteVertex* vertices = (SpriteVertex*)_frameData.Allocate(count * 4 * sizeof(SpriteVertex), offset);
+		if (vertices == nullptr)
+			return;
 
-			if (colliders[i]->typeShape == Components::ETypeShape::CUBE && _cube->IsReady())
+		Threading::JobSystem::GetInstance()->ParallelFor(count, SPRITE_VERTEX_GRAIN, [this, &sprites, vertices](QXsizei begin, QXsizei end)
 			{
-				glBindVertexArray(_cube->GetVAO());
+				for (QXsizei i = begin; i < end; ++i)
+				{
+					const RenderSprite& sprite = sprites[i];
+					const SpriteRect& rect = _spriteRects[i];
+					SpriteVertex* quad = vertices + i * 4;
+
+					for (QXuint c = 0; c < 4; ++c)
+					{
+						quad[c].position[0] = sprite.corners[c][0];
+						quad[c].position[1] = sprite.corners[c][1];
+						quad[c].uv[0] = rect.uv[c == 1 || c == 2 ? 2 : 0];
+						quad[c].uv[1] = rect.uv[c >= 2 ? 3 : 1];
+						quad[c].uv[2] = (QXfloat)rect.page;
+						quad[c].color = sprite.color;
+					}
+				}
+			});
 
-				glDrawElements(GL_TRIANGLES, (GLsizei)_cube->GetIndices().size(), GL_UNSIGNED_INT, 0);
+		// The indices of the quads only change when there are more sprites than ever
+		if (count > _spriteCapacity)
+		{
+			_spriteCapacity = std::max(count, _spriteCapacity * 2);
 
-				glBindVertexArray(0);
-			}
-			else if (colliders[i]->typeShape == Components::ETypeShape::SPHERE && _sphere->IsReady())
+			std::vector<QXuint> indices(_spriteCapacity * 6);
+			for (QXsizei i = 0; i < _spriteCapacity; ++i)
 			{
-				glBindVertexArray(_sphere->GetVAO());
+				QXuint first = (QXuint)i * 4;
+				QXuint quad[6] = { first, first + 1, first + 2, first + 2, first + 3, first };
+				memcpy(&indices[i * 6], quad, sizeof(quad));
+			}
 
-				glDrawElements(GL_TRIANGLES, (GLsizei)_sphere->GetIndices().size(), GL_UNSIGNED_INT, 0);
+			glDeleteBuffers(1, &_spriteIBO);
+			glCreateBuffers(1, &_spriteIBO);
+			glNamedBufferStorage(_spriteIBO, indices.size() * sizeof(QXuint), indices.data(), 0);
+			glVertexArrayElementBuffer(_spriteVAO, _spriteIBO);
+		}
 
-				glBindVertexArray(0);
-			}
-			else if (colliders[i]->typeShape == Components::ETypeShape::CAPSULE && _caps->IsReady())
-			{
-				glBindVertexArray(_caps->GetVAO());
+		glVertexArrayVertexBuffer(_spriteVAO, 0, _frameData.GetId(), offset, sizeof(SpriteVertex));
 
-				glDrawElements(GL_TRIANGLES, (GLsizei)_caps->GetIndices().size(), GL_UNSIGNED_INT, 0);
+		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+		glViewport(0, 0, width, height);
+		glDisable(GL_DEPTH_TEST);
+		glDisable(GL_CULL_FACE);
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-				glBindVertexArray(0);
-			}
-		}
+		_spriteProgram->Use();
+		glUniform2f(_spriteProgram->GetLocation("screenSize"), (QXfloat)width, (QXfloat)height);
+		glUniform1i(_spriteProgram->GetLocation("atlas"), SPRITE_ATLAS_UNIT);
+		_spriteAtlas.Bind();
 
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+		// Every page is a layer of the atlas, the sorted sprites are drawn with one call whatever their page
+		glBindVertexArray(_spriteVAO);
+		glDrawElements(GL_TRIANGLES, (GLsizei)(count * 6), GL_UNSIGNED_INT, nullptr);
+		glBindVertexArray(0);
 
-		glActiveTexture(GL_TEXTURE0);
+		_spriteProgram->Unuse();
+
+		glDisable(GL_BLEND);
+		glEnable(GL_CULL_FACE);
+		glEnable(GL_DEPTH_TEST);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
 	}
 
-	void Renderer::SendUniformBuffer(std::vector<Core::Components::Light>& lights, Core::Platform::AppInfo& info, Components::Camera* cam) noexcept
+	void Renderer::SendUniformBuffer(const std::vector<Core::Components::Light>& lights, Core::Platform::AppInfo& info, const RenderView& camera) noexcept
 	{
-		QXuint	light_size = (QXuint)lights.size();
+		QXuint	light_size = (QXuint)std::min(lights.size(), (QXsizei)10);
+		QXuint	offset;
 
-		glBindBuffer(GL_UNIFORM_BUFFER, _viewProjMatrixUBO);
-		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Math::QXmat4), cam->GetLookAt().array);
-		glBufferSubData(GL_UNIFORM_BUFFER, sizeof(Math::QXmat4), sizeof(Math::QXmat4), info.proj.array);
-		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		Math::QXmat4 view_proj[2] = { camera.lookAt, info.proj };
+		_frameData.BindUniform(0, view_proj, sizeof(view_proj));
+
+		// Written in place, the block is read whole so the unused lights are cleared
+		QXsizei light_block = sizeof(QXuint) * 2 + 10 * sizeof(Core::Components::Light);
+		QXbyte* data = (QXbyte*)_frameData.Allocate(light_block, offset);
+		if (data == nullptr)
+			return;
 
+		memset(data, 0, light_block);
+		memcpy(data, &light_size, sizeof(QXuint));
 		if (light_size)
-		{
-			glBindBuffer(GL_UNIFORM_BUFFER, _lightUBO);
-			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(QXuint), &light_size);
-			glBufferSubData(GL_UNIFORM_BUFFER, sizeof(QXuint) * 2, light_size * sizeof(Core::Components::Light), &lights[0]);
-			glBindBuffer(GL_UNIFORM_BUFFER, 0);
-		}
-		else
-		{
-			float val = 0.0f;
-			glClearNamedBufferData(_lightUBO, GL_R32F, GL_RED, GL_FLOAT, &val);
-			glClearNamedBufferData(_viewProjShadowMatrixUBO, GL_R32F, GL_RED, GL_FLOAT, &val);
-		}
+			memcpy(data + sizeof(QXuint) * 2, &lights[0], light_size * sizeof(Core::Components::Light));
+
+		_frameData.BindRange(2, offset, light_block);
 	}
 
 #pragma endregion
@@ -0,0 +1,154 @@
+#include "Core/Render/SpriteAtlas.h"
+
+#include <glad/glad.h>
+
+#include "Core/Debugger/Logger.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	SpriteAtlas::~SpriteAtlas() noexcept
+	{
+		glDeleteTextures(1, &_id);
+		glDeleteFramebuffers(1, &_readFBO);
+		glDeleteFramebuffers(1, &_drawFBO);
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXbool SpriteAtlas::Place(QXint width, QXint height, QXint& page, QXint& x, QXint& y) noexcept
+	{
+		if (width > SPRITE_ATLAS_SIZE || height > SPRITE_ATLAS_SIZE)
+			return false;
+
+		for (QXsizei i = 0; i < _pages.size(); ++i)
+		{
+			Page& current = _pages[i];
+
+			// The lowest shelf the texture fits in wastes the least height
+			Shelf* best = nullptr;
+			for (QXsizei j = 0; j < current.shelves.size(); ++j)
+			{
+				Shelf& shelf = current.shelves[j];
+				if (shelf.height >= height && shelf.x + width <= SPRITE_ATLAS_SIZE && (best == nullptr || shelf.height < best->height))
+					best = &shelf;
+			}
+
+			if (best == nullptr && current.top + height <= SPRITE_ATLAS_SIZE)
+			{
+				current.shelves.push_back({ current.top, height, 0 });
+				current.top += height;
+				best = &current.shelves.back();
+			}
+
+			if (best)
+			{
+				page = (QXint)i;
+				x = best->x;
+				y = best->y;
+				best->x += width;
+
+				return true;
+			}
+		}
+
+		if ((QXint)_pages.size() == _capacity)
+			Grow();
+
+		_pages.emplace_back();
+		_pages.back().shelves.push_back({ 0, height, width });
+		_pages.back().top = height;
+
+		page = (QXint)_pages.size() - 1;
+		x = 0;
+		y = 0;
+
+		return true;
+	}
+
+	void SpriteAtlas::Grow() noexcept
+	{
+		QXint capacity = _capacity ? _capacity * 2 : SPRITE_ATLAS_PAGES;
+		QXuint id;
+
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &id);
+		glTextureStorage3D(id, 1, GL_RGBA8, SPRITE_ATLAS_SIZE, SPRITE_ATLAS_SIZE, capacity);
+
+		glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		// The padding is read by the filtering, it stays transparent
+		QXbyte clear[4] = { 0, 0, 0, 0 };
+		glClearTexImage(id, 0, GL_RGBA, GL_UNSIGNED_BYTE, clear);
+
+		if (_id)
+		{
+			glCopyImageSubData(_id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+				SPRITE_ATLAS_SIZE, SPRITE_ATLAS_SIZE, (QXint)_pages.size());
+			glDeleteTextures(1, &_id);
+		}
+		else
+		{
+			glCreateFramebuffers(1, &_readFBO);
+			glCreateFramebuffers(1, &_drawFBO);
+		}
+
+		_id = id;
+		_capacity = capacity;
+	}
+
+	SpriteRect SpriteAtlas::GetRect(Resources::Texture* texture) noexcept
+	{
+		if (texture == nullptr || !texture->IsReady())
+			return {};
+
+		std::unordered_map<QXuint, SpriteRect>::iterator it = _rects.find(texture->GetId());
+		if (it != _rects.end())
+			return it->second;
+
+		SpriteRect rect;
+		QXint width = texture->GetWidth();
+		QXint height = texture->GetHeight();
+		QXint page, x, y;
+
+		if (!Place(width + SPRITE_ATLAS_PADDING * 2, height + SPRITE_ATLAS_PADDING * 2, page, x, y))
+		{
+			LOG(ERROR, "texture is too large for the sprite atlas");
+			_rects[texture->GetId()] = rect;
+
+			return rect;
+		}
+
+		x += SPRITE_ATLAS_PADDING;
+		y += SPRITE_ATLAS_PADDING;
+
+		// A blit converts the texture to the format of the atlas, unlike a copy of the image
+		glNamedFramebufferTexture(_readFBO, GL_COLOR_ATTACHMENT0, texture->GetId(), 0);
+		glNamedFramebufferTextureLayer(_drawFBO, GL_COLOR_ATTACHMENT0, _id, 0, page);
+		glNamedFramebufferReadBuffer(_readFBO, GL_COLOR_ATTACHMENT0);
+		glNamedFramebufferDrawBuffer(_drawFBO, GL_COLOR_ATTACHMENT0);
+		glBlitNamedFramebuffer(_readFBO, _drawFBO, 0, 0, width, height, x, y, x + width, y + height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+		rect.uv[0] = (QXfloat)x / SPRITE_ATLAS_SIZE;
+		rect.uv[1] = (QXfloat)y / SPRITE_ATLAS_SIZE;
+		rect.uv[2] = (QXfloat)(x + width) / SPRITE_ATLAS_SIZE;
+		rect.uv[3] = (QXfloat)(y + height) / SPRITE_ATLAS_SIZE;
+		rect.page = page;
+
+		_rects[texture->GetId()] = rect;
+
+		return rect;
+	}
+
+	void SpriteAtlas::Bind() const noexcept
+	{
+		glBindTextureUnit(SPRITE_ATLAS_UNIT, _id);
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,114 @@
+#include "Core/Render/TexturePool.h"
+
+#include <glad/glad.h>
+
+#include "Core/Debugger/Logger.h"
+
+namespace Quantix::Core::Render
+{
+#pragma region Constructors
+
+	TexturePool::~TexturePool() noexcept
+	{
+		for (QXsizei i = 0; i < _arrays.size(); ++i)
+			glDeleteTextures(1, &_arrays[i].id);
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	QXint TexturePool::FindArray(QXuint format, QXint width, QXint height) noexcept
+	{
+		for (QXsizei i = 0; i < _arrays.size(); ++i)
+		{
+			if (_arrays[i].format == format && _arrays[i].width == width && _arrays[i].height == height)
+				return (QXint)i;
+		}
+
+		if (_arrays.size() == TEXTURE_POOL_ARRAYS)
+			return -1;
+
+		TextureArray array;
+		array.format = format;
+		array.width = width;
+		array.height = height;
+
+		Grow(array);
+		_arrays.push_back(array);
+
+		return (QXint)_arrays.size() - 1;
+	}
+
+	void TexturePool::Grow(TextureArray& array) noexcept
+	{
+		QXint capacity = array.capacity ? array.capacity * 2 : TEXTURE_POOL_LAYERS;
+		QXuint id;
+
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &id);
+		glTextureStorage3D(id, 1, array.format, array.width, array.height, capacity);
+
+		// Same sampling as the textures that are copied in it
+		glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		if (array.id)
+		{
+			glCopyImageSubData(array.id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+				array.width, array.height, array.layerCount);
+			glDeleteTextures(1, &array.id);
+		}
+
+		array.id = id;
+		array.capacity = capacity;
+	}
+
+	TextureSlot TexturePool::GetSlot(Resources::Texture* texture) noexcept
+	{
+		if (texture == nullptr || !texture->IsReady())
+			return {};
+
+		std::unordered_map<QXuint, TextureSlot>::iterator it = _slots.find(texture->GetId());
+		if (it != _slots.end())
+			return it->second;
+
+		TextureSlot slot;
+		QXuint format = texture->GetChannel() == RGBA_CHANNEL ? GL_RGBA8 : GL_RGB8;
+
+		// Textures of an unknown layout keep the slot invalid, the material is drawn untextured
+		if (!texture->IsHDR() && (texture->GetChannel() == RGB_CHANNEL || texture->GetChannel() == RGBA_CHANNEL))
+			slot.array = FindArray(format, texture->GetWidth(), texture->GetHeight());
+
+		if (slot.array == -1)
+		{
+			LOG(ERROR, "texture can not be added to the texture pool");
+			_slots[texture->GetId()] = slot;
+
+			return slot;
+		}
+
+		TextureArray& array = _arrays[slot.array];
+		if (array.layerCount == array.capacity)
+			Grow(array);
+
+		slot.layer = array.layerCount++;
+
+		// The texture keeps its own storage for the editor, the copy stays on the gpu
+		glCopyImageSubData(texture->GetId(), GL_TEXTURE_2D, 0, 0, 0, 0, array.id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, slot.layer,
+			array.width, array.height, 1);
+
+		_slots[texture->GetId()] = slot;
+
+		return slot;
+	}
+
+	void TexturePool::Bind() const noexcept
+	{
+		for (QXsizei i = 0; i < _arrays.size(); ++i)
+			glBindTextureUnit(TEXTURE_POOL_UNIT + (QXuint)i, _arrays[i].id);
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,159 @@
+#include "Core/Threading/JobSystem.h"
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+namespace Quantix::Core::Threading
+{
+	// Index of the worker running the thread
+	static thread_local QXint worker_index = -1;
+
+#pragma region Constructors
+
+	JobSystem::JobSystem() noexcept
+	{
+		QXuint hardware = std::thread::hardware_concurrency();
+		QXuint count = hardware > 1 ? hardware - 1 : 0;
+
+		for (QXuint i = 0; i < count; ++i)
+			_workers.emplace_back(&JobSystem::Run, this, i);
+	}
+
+	JobSystem::~JobSystem() noexcept
+	{
+		Destroy();
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void JobSystem::Run(QXuint index) noexcept
+	{
+		worker_index = (QXint)index;
+
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		while (true)
+		{
+			_condition.wait(lock, [this] { return !_jobs.empty() || _quit; });
+
+			if (_jobs.empty())
+				return;
+
+			std::function<void()> job = std::move(_jobs.front());
+			_jobs.pop_front();
+
+			lock.unlock();
+			job();
+			lock.lock();
+		}
+	}
+
+	void JobSystem::Submit(std::function<void()> job) noexcept
+	{
+		if (_workers.empty())
+		{
+			job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_jobs.push_back(std::move(job));
+		}
+
+		_condition.notify_one();
+	}
+
+	void JobSystem::ParallelFor(QXsizei count, QXsizei grain, const std::function<void(QXsizei, QXsizei)>& func) noexcept
+	{
+		if (count == 0)
+			return;
+
+		grain = std::max(grain, (QXsizei)1);
+		QXsizei chunks = (count + grain - 1) / grain;
+
+		if (chunks == 1 || _workers.empty())
+		{
+			func(0, count);
+			return;
+		}
+
+		struct Loop
+		{
+			std::atomic<QXsizei>								next { 0 };
+			std::atomic<QXsizei>								done { 0 };
+			QXsizei												count;
+			QXsizei												grain;
+			QXsizei												chunks;
+			const std::function<void(QXsizei, QXsizei)>*		func;
+		};
+
+		// Shared with the workers, a worker starting after the end of the loop finds no chunk left
+		std::shared_ptr<Loop> loop = std::make_shared<Loop>();
+		loop->count = count;
+		loop->grain = grain;
+		loop->chunks = chunks;
+		loop->func = &func;
+
+		auto work = [loop]
+		{
+			QXsizei chunk;
+			while ((chunk = loop->next.fetch_add(1)) < loop->chunks)
+			{
+				QXsizei begin = chunk * loop->grain;
+				(*loop->func)(begin, std::min(begin + loop->grain, loop->count));
+				loop->done.fetch_add(1, std::memory_order_release);
+			}
+		};
+
+		QXsizei helpers = std::min(chunks - 1, _workers.size());
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (QXsizei i = 0; i < helpers; ++i)
+				_jobs.push_back(work);
+		}
+		_condition.notify_all();
+
+		// The caller takes chunks too, then only waits for the chunks still running on the workers
+		work();
+
+		while (loop->done.load(std::memory_order_acquire) < chunks)
+			std::this_thread::yield();
+	}
+
+	void JobSystem::Destroy() noexcept
+	{
+		JobSystem* system = GetInstance();
+
+		{
+			std::lock_guard<std::mutex> lock(system->_mutex);
+			system->_quit = true;
+		}
+		system->_condition.notify_all();
+
+		for (QXsizei i = 0; i < system->_workers.size(); ++i)
+		{
+			if (system->_workers[i].joinable())
+				system->_workers[i].join();
+		}
+
+		system->_workers.clear();
+	}
+
+	QXint JobSystem::GetWorkerIndex() noexcept
+	{
+		return worker_index;
+	}
+
+	JobSystem* JobSystem::GetInstance() noexcept
+	{
+		static JobSystem system;
+
+		return &system;
+	}
+
+#pragma endregion
+}
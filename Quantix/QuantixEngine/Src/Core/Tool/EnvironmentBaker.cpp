@@ -0,0 +1,400 @@
+#include "Core/Tool/EnvironmentBaker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <MathDefines.h>
+
+namespace Quantix::Core::Tool
+{
+	/**
+	 * @brief Run a function on the six faces, five of them on their own thread
+	 */
+	template<typename Func>
+	static void ForEachFace(Func func) noexcept
+	{
+		std::vector<std::thread> workers;
+		for (QXuint face = 1; face < 6; ++face)
+			workers.emplace_back(func, face);
+
+		func(0);
+
+		for (QXsizei i = 0; i < workers.size(); ++i)
+			workers[i].join();
+	}
+
+	/**
+	 * @brief Direction of a point of a face, from the cubemap selection table of the OpenGL specification
+	 *
+	 * @param face index of the face
+	 * @param s horizontal coordinate in [-1, 1]
+	 * @param t vertical coordinate in [-1, 1], -1 on the first row
+	 * @param dir result, not normalized
+	 */
+	static void FaceDirection(QXuint face, QXfloat s, QXfloat t, QXfloat dir[3]) noexcept
+	{
+		switch (face)
+		{
+		case 0: dir[0] = 1.f; dir[1] = -t; dir[2] = -s; break;
+		case 1: dir[0] = -1.f; dir[1] = -t; dir[2] = s; break;
+		case 2: dir[0] = s; dir[1] = 1.f; dir[2] = t; break;
+		case 3: dir[0] = s; dir[1] = -1.f; dir[2] = -t; break;
+		case 4: dir[0] = s; dir[1] = -t; dir[2] = 1.f; break;
+		default: dir[0] = -s; dir[1] = -t; dir[2] = -1.f; break;
+		}
+	}
+
+	/**
+	 * @brief Bilinear sample of a cubemap, the faces are clamped on their edges
+	 *
+	 * @param cube cubemap to sample
+	 * @param dir direction to sample, not normalized
+	 * @param color result
+	 */
+	static void SampleCube(const CubeMapData& cube, const QXfloat dir[3], QXfloat color[3]) noexcept
+	{
+		QXfloat ax = std::abs(dir[0]), ay = std::abs(dir[1]), az = std::abs(dir[2]);
+		QXuint face;
+		QXfloat sc, tc, ma;
+
+		if (ax >= ay && ax >= az)
+		{
+			face = dir[0] > 0.f ? 0 : 1;
+			sc = dir[0] > 0.f ? -dir[2] : dir[2];
+			tc = -dir[1];
+			ma = ax;
+		}
+		else if (ay >= az)
+		{
+			face = dir[1] > 0.f ? 2 : 3;
+			sc = dir[0];
+			tc = dir[1] > 0.f ? dir[2] : -dir[2];
+			ma = ay;
+		}
+		else
+		{
+			face = dir[2] > 0.f ? 4 : 5;
+			sc = dir[2] > 0.f ? dir[0] : -dir[0];
+			tc = -dir[1];
+			ma = az;
+		}
+
+		const QXint size = (QXint)cube.size;
+		QXfloat x = std::clamp((sc / ma + 1.f) * 0.5f * size - 0.5f, 0.f, (QXfloat)(size - 1));
+		QXfloat y = std::clamp((tc / ma + 1.f) * 0.5f * size - 0.5f, 0.f, (QXfloat)(size - 1));
+
+		QXint x0 = (QXint)x, y0 = (QXint)y;
+		QXint x1 = std::min(x0 + 1, size - 1), y1 = std::min(y0 + 1, size - 1);
+		QXfloat fx = x - x0, fy = y - y0;
+
+		const QXfloat* texels = cube.faces[face].data();
+		for (QXuint c = 0; c < 3; ++c)
+		{
+			QXfloat top = texels[(y0 * size + x0) * 3 + c] * (1.f - fx) + texels[(y0 * size + x1) * 3 + c] * fx;
+			QXfloat bottom = texels[(y1 * size + x0) * 3 + c] * (1.f - fx) + texels[(y1 * size + x1) * 3 + c] * fx;
+			color[c] = top * (1.f - fy) + bottom * fy;
+		}
+	}
+
+	/**
+	 * @brief Trilinear sample of a mip chain
+	 */
+	static void SampleCubeLod(const std::vector<CubeMapData>& mips, const QXfloat dir[3], QXfloat lod, QXfloat color[3]) noexcept
+	{
+		lod = std::clamp(lod, 0.f, (QXfloat)(mips.size() - 1));
+
+		QXuint level = (QXuint)lod;
+		QXfloat blend = lod - level;
+
+		SampleCube(mips[level], dir, color);
+
+		if (blend > 0.f && level + 1 < mips.size())
+		{
+			QXfloat next[3];
+			SampleCube(mips[level + 1], dir, next);
+
+			for (QXuint c = 0; c < 3; ++c)
+				color[c] = color[c] * (1.f - blend) + next[c] * blend;
+		}
+	}
+
+	/**
+	 * @brief Van der Corput sequence, second coordinate of the Hammersley set
+	 */
+	static QXfloat RadicalInverse(QXuint bits) noexcept
+	{
+		bits = (bits << 16u) | (bits >> 16u);
+		bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+		bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+		bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+		bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+
+		return bits * 2.3283064365386963e-10f;
+	}
+
+#pragma region Functions
+
+	CubeMapData EnvironmentBaker::FromEquirectangular(const QXfloat* image, QXint width, QXint height, QXint channels, QXuint size) noexcept
+	{
+		CubeMapData cube;
+		cube.size = size;
+
+		ForEachFace([&](QXuint face)
+			{
+				std::vector<QXfloat>& texels = cube.faces[face];
+				texels.resize(size * size * 3);
+
+				for (QXuint y = 0; y < size; ++y)
+				{
+					for (QXuint x = 0; x < size; ++x)
+					{
+						QXfloat dir[3];
+						FaceDirection(face, (x + 0.5f) / size * 2.f - 1.f, (y + 0.5f) / size * 2.f - 1.f, dir);
+
+						QXfloat length = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+
+						// Same mapping as the spherical sampling of the old capture shader
+						QXfloat u = std::atan2(dir[2], dir[0]) / (2.f * Q_PI) + 0.5f;
+						QXfloat v = std::asin(dir[1] / length) / Q_PI + 0.5f;
+
+						QXfloat px = u * width - 0.5f;
+						QXfloat py = std::clamp(v * height - 0.5f, 0.f, (QXfloat)(height - 1));
+
+						QXint x0 = (QXint)std::floor(px), y0 = (QXint)py;
+						QXfloat fx = px - x0, fy = py - y0;
+						QXint x1 = (x0 + 1 + width) % width, y1 = std::min(y0 + 1, height - 1);
+						x0 = (x0 + width) % width;
+
+						for (QXuint c = 0; c < 3; ++c)
+						{
+							QXfloat bottom = image[(y0 * width + x0) * channels + c] * (1.f - fx) + image[(y0 * width + x1) * channels + c] * fx;
+							QXfloat top = image[(y1 * width + x0) * channels + c] * (1.f - fx) + image[(y1 * width + x1) * channels + c] * fx;
+							texels[(y * size + x) * 3 + c] = bottom * (1.f - fy) + top * fy;
+						}
+					}
+				}
+			});
+
+		return cube;
+	}
+
+	CubeMapData EnvironmentBaker::Downsample(const CubeMapData& cube) noexcept
+	{
+		CubeMapData result;
+		result.size = std::max(cube.size / 2, 1u);
+
+		for (QXuint face = 0; face < 6; ++face)
+		{
+			const std::vector<QXfloat>& source = cube.faces[face];
+			std::vector<QXfloat>& texels = result.faces[face];
+			texels.resize(result.size * result.size * 3);
+
+			for (QXuint y = 0; y < result.size; ++y)
+			{
+				QXuint y0 = std::min(y * 2, cube.size - 1), y1 = std::min(y * 2 + 1, cube.size - 1);
+
+				for (QXuint x = 0; x < result.size; ++x)
+				{
+					QXuint x0 = std::min(x * 2, cube.size - 1), x1 = std::min(x * 2 + 1, cube.size - 1);
+
+					for (QXuint c = 0; c < 3; ++c)
+					{
+						texels[(y * result.size + x) * 3 + c] = (source[(y0 * cube.size + x0) * 3 + c] + source[(y0 * cube.size + x1) * 3 + c]
+							+ source[(y1 * cube.size + x0) * 3 + c] + source[(y1 * cube.size + x1) * 3 + c]) * 0.25f;
+					}
+				}
+			}
+		}
+
+		return result;
+	}
+
+	void EnvironmentBaker::ComputeIrradianceSH(const CubeMapData& cube, QXfloat sh[ENVIRONMENT_SH_COUNT * 3]) noexcept
+	{
+		QXdouble coefficients[ENVIRONMENT_SH_COUNT * 3] = { 0 };
+		QXdouble total_weight = 0;
+
+		const QXfloat texel_area = (2.f / cube.size) * (2.f / cube.size);
+
+		for (QXuint face = 0; face < 6; ++face)
+		{
+			for (QXuint y = 0; y < cube.size; ++y)
+			{
+				for (QXuint x = 0; x < cube.size; ++x)
+				{
+					QXfloat s = (x + 0.5f) / cube.size * 2.f - 1.f, t = (y + 0.5f) / cube.size * 2.f - 1.f;
+					QXfloat dir[3];
+					FaceDirection(face, s, t, dir);
+
+					// Solid angle of the texel, the faces are further from the center on their corners
+					QXfloat distance_sq = 1.f + s * s + t * t;
+					QXfloat weight = texel_area / (distance_sq * std::sqrt(distance_sq));
+
+					QXfloat length = std::sqrt(distance_sq);
+					QXfloat nx = dir[0] / length, ny = dir[1] / length, nz = dir[2] / length;
+
+					QXfloat basis[ENVIRONMENT_SH_COUNT] = {
+						0.282095f,
+						0.488603f * ny, 0.488603f * nz, 0.488603f * nx,
+						1.092548f * nx * ny, 1.092548f * ny * nz, 0.315392f * (3.f * nz * nz - 1.f), 1.092548f * nx * nz, 0.546274f * (nx * nx - ny * ny)
+					};
+
+					const QXfloat* color = &cube.faces[face][(y * cube.size + x) * 3];
+					for (QXuint i = 0; i < ENVIRONMENT_SH_COUNT; ++i)
+					{
+						coefficients[i * 3] += color[0] * basis[i] * weight;
+						coefficients[i * 3 + 1] += color[1] * basis[i] * weight;
+						coefficients[i * 3 + 2] += color[2] * basis[i] * weight;
+					}
+
+					total_weight += weight;
+				}
+			}
+		}
+
+		// Convolution of each band with the cosine lobe, divided by pi for the lambert brdf
+		const QXdouble band_scale[3] = { 1.0, 2.0 / 3.0, 0.25 };
+		const QXdouble normalization = 4.0 * Q_PI / total_weight;
+
+		for (QXuint i = 0; i < ENVIRONMENT_SH_COUNT; ++i)
+		{
+			QXuint band = i == 0 ? 0 : (i < 4 ? 1 : 2);
+
+			for (QXuint c = 0; c < 3; ++c)
+				sh[i * 3 + c] = (QXfloat)(coefficients[i * 3 + c] * normalization * band_scale[band]);
+		}
+	}
+
+	std::vector<CubeMapData> EnvironmentBaker::PrefilterSpecular(const std::vector<CubeMapData>& mips, QXuint size, QXuint levelCount) noexcept
+	{
+		std::vector<CubeMapData> levels(levelCount);
+		for (QXuint level = 0; level < levelCount; ++level)
+			levels[level].size = std::max(size >> level, 1u);
+
+		const QXfloat source_size = (QXfloat)mips[0].size;
+		const QXfloat texel_solid_angle = 4.f * Q_PI / (6.f * source_size * source_size);
+
+		ForEachFace([&](QXuint face)
+			{
+				for (QXuint level = 0; level < levelCount; ++level)
+				{
+					const QXuint level_size = levels[level].size;
+					const QXfloat roughness = levelCount > 1 ? level / (QXfloat)(levelCount - 1) : 0.f;
+					const QXfloat alpha = roughness * roughness;
+
+					std::vector<QXfloat>& texels = levels[level].faces[face];
+					texels.resize(level_size * level_size * 3);
+
+					for (QXuint y = 0; y < level_size; ++y)
+					{
+						for (QXuint x = 0; x < level_size; ++x)
+						{
+							QXfloat n[3];
+							FaceDirection(face, (x + 0.5f) / level_size * 2.f - 1.f, (y + 0.5f) / level_size * 2.f - 1.f, n);
+
+							QXfloat length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+							n[0] /= length; n[1] /= length; n[2] /= length;
+
+							QXfloat* color = &texels[(y * level_size + x) * 3];
+
+							// A mirror only needs the source at the size of the level
+							if (roughness == 0.f)
+							{
+								SampleCubeLod(mips, n, std::log2(source_size / level_size), color);
+								continue;
+							}
+
+							// Tangent frame around the normal, the view is the normal
+							QXfloat up[3] = { 0.f, 0.f, 0.f };
+							up[std::abs(n[2]) < 0.999f ? 2 : 0] = 1.f;
+
+							QXfloat tx[3] = { up[1] * n[2] - up[2] * n[1], up[2] * n[0] - up[0] * n[2], up[0] * n[1] - up[1] * n[0] };
+							QXfloat tl = std::sqrt(tx[0] * tx[0] + tx[1] * tx[1] + tx[2] * tx[2]);
+							tx[0] /= tl; tx[1] /= tl; tx[2] /= tl;
+							QXfloat ty[3] = { n[1] * tx[2] - n[2] * tx[1], n[2] * tx[0] - n[0] * tx[2], n[0] * tx[1] - n[1] * tx[0] };
+
+							QXfloat sum[3] = { 0.f, 0.f, 0.f };
+							QXfloat total_weight = 0.f;
+
+							for (QXuint i = 0; i < ENVIRONMENT_SPECULAR_SAMPLES; ++i)
+							{
+								// GGX importance sampling of the half vector
+								QXfloat xi_x = i / (QXfloat)ENVIRONMENT_SPECULAR_SAMPLES, xi_y = RadicalInverse(i);
+								QXfloat phi = 2.f * Q_PI * xi_x;
+								QXfloat cos_theta = std::sqrt((1.f - xi_y) / (1.f + (alpha * alpha - 1.f) * xi_y));
+								QXfloat sin_theta = std::sqrt(1.f - cos_theta * cos_theta);
+
+								QXfloat hx = sin_theta * std::cos(phi), hy = sin_theta * std::sin(phi);
+								QXfloat h[3] = { tx[0] * hx + ty[0] * hy + n[0] * cos_theta, tx[1] * hx + ty[1] * hy + n[1] * cos_theta,
+									tx[2] * hx + ty[2] * hy + n[2] * cos_theta };
+
+								QXfloat l[3] = { 2.f * cos_theta * h[0] - n[0], 2.f * cos_theta * h[1] - n[1], 2.f * cos_theta * h[2] - n[2] };
+								QXfloat n_dot_l = n[0] * l[0] + n[1] * l[1] + n[2] * l[2];
+
+								if (n_dot_l <= 0.f)
+									continue;
+
+								// Filtered importance sampling, each sample reads the level covering its solid angle
+								QXfloat d = alpha * alpha / (Q_PI * std::pow(cos_theta * cos_theta * (alpha * alpha - 1.f) + 1.f, 2.f));
+								QXfloat pdf = d * 0.25f;
+								QXfloat sample_solid_angle = 1.f / (ENVIRONMENT_SPECULAR_SAMPLES * pdf + 0.0001f);
+								QXfloat lod = 0.5f * std::log2(sample_solid_angle / texel_solid_angle) + 1.f;
+
+								QXfloat sample[3];
+								SampleCubeLod(mips, l, lod, sample);
+
+								sum[0] += sample[0] * n_dot_l;
+								sum[1] += sample[1] * n_dot_l;
+								sum[2] += sample[2] * n_dot_l;
+								total_weight += n_dot_l;
+							}
+
+							for (QXuint c = 0; c < 3; ++c)
+								color[c] = total_weight > 0.f ? sum[c] / total_weight : 0.f;
+						}
+					}
+				}
+			});
+
+		return levels;
+	}
+
+	void EnvironmentBaker::PackRGB9E5(const std::vector<QXfloat>& face, std::vector<QXuint>& packed) noexcept
+	{
+		// Max value of the format, (2^9 - 1) / 2^9 * 2^(31 - 15)
+		const QXfloat max_value = 65408.f;
+
+		packed.resize(face.size() / 3);
+
+		for (QXsizei i = 0; i < packed.size(); ++i)
+		{
+			QXfloat r = std::clamp(face[i * 3], 0.f, max_value);
+			QXfloat g = std::clamp(face[i * 3 + 1], 0.f, max_value);
+			QXfloat b = std::clamp(face[i * 3 + 2], 0.f, max_value);
+			QXfloat max_channel = std::max({ r, g, b });
+
+			if (max_channel == 0.f || std::isnan(max_channel))
+			{
+				packed[i] = 0;
+				continue;
+			}
+
+			QXint exponent = std::max(-16, (QXint)std::floor(std::log2(max_channel))) + 16;
+			QXfloat scale = std::exp2((QXfloat)(exponent - 15 - 9));
+
+			if ((QXuint)std::floor(max_channel / scale + 0.5f) == 512)
+			{
+				exponent++;
+				scale *= 2.f;
+			}
+
+			QXuint rm = (QXuint)std::floor(r / scale + 0.5f);
+			QXuint gm = (QXuint)std::floor(g / scale + 0.5f);
+			QXuint bm = (QXuint)std::floor(b / scale + 0.5f);
+
+			packed[i] = rm | (gm << 9) | (bm << 18) | ((QXuint)exponent << 27);
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,310 @@
+#include "Core/Tool/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Scoring constants from Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_TRIANGLE_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.f
+#define VALENCE_BOOST_POWER 0.5f
+
+namespace Quantix::Core::Tool
+{
+	/**
+	 * @brief Score of a vertex, high when it is in the cache or used by few remaining triangles
+	 *
+	 * @param cachePosition position in the cache, -1 if not in the cache
+	 * @param liveTriangles number of triangles using the vertex not emitted yet
+	 * @return QXfloat score of the vertex
+	 */
+	static QXfloat VertexScore(QXint cachePosition, QXuint liveTriangles) noexcept
+	{
+		if (liveTriangles == 0)
+			return -1.f;
+
+		QXfloat score = 0.f;
+
+		if (cachePosition >= 0)
+		{
+			// Vertices of the last triangle get a fixed score so the next triangle does not reuse the same edge
+			if (cachePosition < 3)
+				score = LAST_TRIANGLE_SCORE;
+			else
+				score = std::pow(1.f - (cachePosition - 3) / (QXfloat)(VERTEX_CACHE_SIZE - 3), CACHE_DECAY_POWER);
+		}
+
+		return score + VALENCE_BOOST_SCALE * std::pow((QXfloat)liveTriangles, -VALENCE_BOOST_POWER);
+	}
+
+	struct Cluster
+	{
+		QXsizei		first;
+		QXsizei		count;
+		QXfloat		sortKey;
+	};
+
+#pragma region Functions
+
+	void MeshOptimizer::OptimizeVertexCache(std::vector<QXuint>& indices, QXsizei vertexCount) noexcept
+	{
+		const QXsizei triangle_count = indices.size() / 3;
+		if (triangle_count == 0)
+			return;
+
+		// Triangles of each vertex, the live ones are kept at the start of each range
+		std::vector<QXuint> live_count(vertexCount, 0);
+		for (QXsizei i = 0; i < indices.size(); ++i)
+			live_count[indices[i]]++;
+
+		std::vector<QXuint> adjacency_offset(vertexCount + 1, 0);
+		for (QXsizei i = 0; i < vertexCount; ++i)
+			adjacency_offset[i + 1] = adjacency_offset[i] + live_count[i];
+
+		std::vector<QXuint> adjacency(indices.size());
+		{
+			std::vector<QXuint> fill(adjacency_offset.begin(), adjacency_offset.end() - 1);
+			for (QXsizei i = 0; i < indices.size(); ++i)
+				adjacency[fill[indices[i]]++] = (QXuint)(i / 3);
+		}
+
+		std::vector<QXint>		cache_position(vertexCount, -1);
+		std::vector<QXfloat>	vertex_score(vertexCount);
+		for (QXsizei i = 0; i < vertexCount; ++i)
+			vertex_score[i] = VertexScore(-1, live_count[i]);
+
+		std::vector<QXfloat>	triangle_score(triangle_count);
+		std::vector<QXbool>		emitted(triangle_count, false);
+		for (QXsizei i = 0; i < triangle_count; ++i)
+			triangle_score[i] = vertex_score[indices[i * 3]] + vertex_score[indices[i * 3 + 1]] + vertex_score[indices[i * 3 + 2]];
+
+		std::vector<QXuint> output;
+		output.reserve(indices.size());
+
+		std::vector<QXuint> cache, new_cache;
+		cache.reserve(VERTEX_CACHE_SIZE + 3);
+		new_cache.reserve(VERTEX_CACHE_SIZE + 3);
+
+		QXint best_triangle = (QXint)(std::max_element(triangle_score.begin(), triangle_score.end()) - triangle_score.begin());
+		QXsizei scan_cursor = 0;
+
+		while (output.size() < indices.size())
+		{
+			// No candidate around the cache, restart from the first triangle not emitted
+			if (best_triangle < 0)
+			{
+				while (emitted[scan_cursor])
+					scan_cursor++;
+				best_triangle = (QXint)scan_cursor;
+			}
+
+			const QXuint* triangle = &indices[best_triangle * 3];
+			emitted[best_triangle] = true;
+
+			new_cache.clear();
+			for (QXuint i = 0; i < 3; ++i)
+			{
+				QXuint vertex = triangle[i];
+				output.push_back(vertex);
+				new_cache.push_back(vertex);
+
+				// Remove the triangle from the live ones of the vertex
+				QXuint* begin = &adjacency[adjacency_offset[vertex]];
+				QXuint* end = begin + live_count[vertex];
+				*std::find(begin, end, (QXuint)best_triangle) = *(end - 1);
+				live_count[vertex]--;
+			}
+
+			for (QXsizei i = 0; i < cache.size(); ++i)
+			{
+				if (cache[i] != triangle[0] && cache[i] != triangle[1] && cache[i] != triangle[2])
+					new_cache.push_back(cache[i]);
+			}
+
+			// Vertices pushed out of the cache lose their cache score
+			for (QXsizei i = VERTEX_CACHE_SIZE; i < new_cache.size(); ++i)
+			{
+				cache_position[new_cache[i]] = -1;
+				vertex_score[new_cache[i]] = VertexScore(-1, live_count[new_cache[i]]);
+			}
+
+			if (new_cache.size() > VERTEX_CACHE_SIZE)
+				new_cache.resize(VERTEX_CACHE_SIZE);
+
+			for (QXsizei i = 0; i < new_cache.size(); ++i)
+			{
+				cache_position[new_cache[i]] = (QXint)i;
+				vertex_score[new_cache[i]] = VertexScore((QXint)i, live_count[new_cache[i]]);
+			}
+
+			// Only the triangles around the cache changed of score, the best one is the next to emit
+			best_triangle = -1;
+			QXfloat best_score = -1.f;
+
+			for (QXsizei i = 0; i < new_cache.size(); ++i)
+			{
+				QXuint vertex = new_cache[i];
+
+				for (QXuint j = 0; j < live_count[vertex]; ++j)
+				{
+					QXuint t = adjacency[adjacency_offset[vertex] + j];
+					triangle_score[t] = vertex_score[indices[t * 3]] + vertex_score[indices[t * 3 + 1]] + vertex_score[indices[t * 3 + 2]];
+
+					if (triangle_score[t] > best_score)
+					{
+						best_score = triangle_score[t];
+						best_triangle = (QXint)t;
+					}
+				}
+			}
+
+			cache.swap(new_cache);
+		}
+
+		indices.swap(output);
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(std::vector<QXuint>& indices, const std::vector<Resources::Vertex>& vertices) noexcept
+	{
+		const QXsizei triangle_count = indices.size() / 3;
+		if (triangle_count == 0)
+			return;
+
+		// Split the list where a triangle misses all its vertices, reordering clusters there keeps the cache locality
+		std::vector<Cluster> clusters;
+		{
+			std::vector<QXsizei> cache_time(vertices.size(), 0);
+			QXsizei time = VERTEX_CACHE_SIZE + 1;
+
+			for (QXsizei i = 0; i < triangle_count; ++i)
+			{
+				QXuint misses = 0;
+				for (QXuint j = 0; j < 3; ++j)
+				{
+					QXuint vertex = indices[i * 3 + j];
+					if (time - cache_time[vertex] > VERTEX_CACHE_SIZE)
+					{
+						cache_time[vertex] = time++;
+						misses++;
+					}
+				}
+
+				if (clusters.empty() || misses == 3)
+					clusters.push_back({ i, 0, 0.f });
+				clusters.back().count++;
+			}
+		}
+
+		if (clusters.size() == 1)
+			return;
+
+		QXfloat mesh_center[3] = { 0.f, 0.f, 0.f };
+		for (QXsizei i = 0; i < vertices.size(); ++i)
+		{
+			mesh_center[0] += vertices[i].position.x;
+			mesh_center[1] += vertices[i].position.y;
+			mesh_center[2] += vertices[i].position.z;
+		}
+		for (QXuint i = 0; i < 3; ++i)
+			mesh_center[i] /= (QXfloat)vertices.size();
+
+		// Clusters facing away from the center are drawn first, they hide the inner ones
+		for (QXsizei c = 0; c < clusters.size(); ++c)
+		{
+			QXfloat center[3] = { 0.f, 0.f, 0.f }, normal[3] = { 0.f, 0.f, 0.f };
+			QXfloat total_area = 0.f;
+
+			for (QXsizei i = clusters[c].first; i < clusters[c].first + clusters[c].count; ++i)
+			{
+				const Math::QXvec3& p0 = vertices[indices[i * 3]].position;
+				const Math::QXvec3& p1 = vertices[indices[i * 3 + 1]].position;
+				const Math::QXvec3& p2 = vertices[indices[i * 3 + 2]].position;
+
+				QXfloat e1[3] = { p1.x - p0.x, p1.y - p0.y, p1.z - p0.z };
+				QXfloat e2[3] = { p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+				QXfloat n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+				QXfloat area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+				center[0] += (p0.x + p1.x + p2.x) / 3.f * area;
+				center[1] += (p0.y + p1.y + p2.y) / 3.f * area;
+				center[2] += (p0.z + p1.z + p2.z) / 3.f * area;
+				normal[0] += n[0];
+				normal[1] += n[1];
+				normal[2] += n[2];
+				total_area += area;
+			}
+
+			QXfloat normal_length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+			if (total_area == 0.f || normal_length == 0.f)
+				continue;
+
+			for (QXuint i = 0; i < 3; ++i)
+				center[i] = center[i] / total_area - mesh_center[i];
+
+			clusters[c].sortKey = (center[0] * normal[0] + center[1] * normal[1] + center[2] * normal[2]) / normal_length;
+		}
+
+		std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+		std::vector<QXuint> output;
+		output.reserve(indices.size());
+
+		for (QXsizei c = 0; c < clusters.size(); ++c)
+			output.insert(output.end(), indices.begin() + clusters[c].first * 3, indices.begin() + (clusters[c].first + clusters[c].count) * 3);
+
+		indices.swap(output);
+	}
+
+	void MeshOptimizer::OptimizeVertexFetch(std::vector<Resources::Vertex>& vertices, const std::vector<std::vector<QXuint>*>& indexLists) noexcept
+	{
+		const QXuint unused = ~0u;
+
+		std::vector<QXuint> remap(vertices.size(), unused);
+		QXuint vertex_count = 0;
+
+		for (QXsizei l = 0; l < indexLists.size(); ++l)
+		{
+			std::vector<QXuint>& indices = *indexLists[l];
+
+			for (QXsizei i = 0; i < indices.size(); ++i)
+			{
+				if (remap[indices[i]] == unused)
+					remap[indices[i]] = vertex_count++;
+
+				indices[i] = remap[indices[i]];
+			}
+		}
+
+		std::vector<Resources::Vertex> output(vertex_count);
+		for (QXsizei i = 0; i < vertices.size(); ++i)
+		{
+			if (remap[i] != unused)
+				output[remap[i]] = vertices[i];
+		}
+
+		vertices.swap(output);
+	}
+
+	QXfloat MeshOptimizer::ComputeACMR(const std::vector<QXuint>& indices, QXsizei vertexCount, QXuint cacheSize) noexcept
+	{
+		if (indices.empty())
+			return 0.f;
+
+		std::vector<QXsizei> cache_time(vertexCount, 0);
+		QXsizei time = cacheSize + 1;
+		QXsizei misses = 0;
+
+		for (QXsizei i = 0; i < indices.size(); ++i)
+		{
+			if (time - cache_time[indices[i]] > cacheSize)
+			{
+				cache_time[indices[i]] = time++;
+				misses++;
+			}
+		}
+
+		return misses / (QXfloat)(indices.size() / 3);
+	}
+
+#pragma endregion
+}
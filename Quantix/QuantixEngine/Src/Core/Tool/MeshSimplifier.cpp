@@ -0,0 +1,340 @@
+#include "Core/Tool/MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+namespace Quantix::Core::Tool
+{
+	/**
+	 * @brief Symmetric 4x4 matrix accumulating the squared distance to a set of planes
+	 */
+	struct Quadric
+	{
+		QXdouble a00 { 0 }, a01 { 0 }, a02 { 0 }, a03 { 0 };
+		QXdouble a11 { 0 }, a12 { 0 }, a13 { 0 };
+		QXdouble a22 { 0 }, a23 { 0 };
+		QXdouble a33 { 0 };
+
+		/**
+		 * @brief Add the plane n.p + d = 0
+		 */
+		void AddPlane(QXdouble nx, QXdouble ny, QXdouble nz, QXdouble d) noexcept
+		{
+			a00 += nx * nx; a01 += nx * ny; a02 += nx * nz; a03 += nx * d;
+			a11 += ny * ny; a12 += ny * nz; a13 += ny * d;
+			a22 += nz * nz; a23 += nz * d;
+			a33 += d * d;
+		}
+
+		/**
+		 * @brief Add another quadric
+		 */
+		void Add(const Quadric& q) noexcept
+		{
+			a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+			a11 += q.a11; a12 += q.a12; a13 += q.a13;
+			a22 += q.a22; a23 += q.a23;
+			a33 += q.a33;
+		}
+
+		/**
+		 * @brief Squared distance of a point to the planes
+		 */
+		QXdouble Evaluate(QXdouble x, QXdouble y, QXdouble z) const noexcept
+		{
+			return x * x * a00 + y * y * a11 + z * z * a22 + a33
+				+ 2 * (x * y * a01 + x * z * a02 + y * z * a12 + x * a03 + y * a13 + z * a23);
+		}
+	};
+
+	struct Collapse
+	{
+		QXuint		from;
+		QXuint		to;
+		QXdouble	cost;
+	};
+
+	/**
+	 * @brief Hash of a position, vertices sharing a position are welded for the topology
+	 */
+	struct PositionHash
+	{
+		size_t operator()(const Math::QXvec3& pos) const noexcept
+		{
+			QXuint bits[3];
+			memcpy(&bits[0], &pos.x, sizeof(QXuint));
+			memcpy(&bits[1], &pos.y, sizeof(QXuint));
+			memcpy(&bits[2], &pos.z, sizeof(QXuint));
+
+			return ((size_t)bits[0] * 73856093) ^ ((size_t)bits[1] * 19349663) ^ ((size_t)bits[2] * 83492791);
+		}
+	};
+
+	struct PositionEqual
+	{
+		bool operator()(const Math::QXvec3& a, const Math::QXvec3& b) const noexcept
+		{
+			return a.x == b.x && a.y == b.y && a.z == b.z;
+		}
+	};
+
+	/**
+	 * @brief Normal of a triangle, not normalized
+	 */
+	static void TriangleNormal(const Math::QXvec3& p0, const Math::QXvec3& p1, const Math::QXvec3& p2, QXdouble normal[3]) noexcept
+	{
+		QXdouble e1[3] = { (QXdouble)p1.x - p0.x, (QXdouble)p1.y - p0.y, (QXdouble)p1.z - p0.z };
+		QXdouble e2[3] = { (QXdouble)p2.x - p0.x, (QXdouble)p2.y - p0.y, (QXdouble)p2.z - p0.z };
+
+		normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+		normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+		normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+	}
+
+	/**
+	 * @brief Check if two vertices of a position can be drawn with each other's uv and normal
+	 */
+	static QXbool SameAttributes(const Resources::Vertex& a, const Resources::Vertex& b) noexcept
+	{
+		return a.uv.x == b.uv.x && a.uv.y == b.uv.y && a.normal.x == b.normal.x && a.normal.y == b.normal.y && a.normal.z == b.normal.z;
+	}
+
+#pragma region Functions
+
+	std::vector<QXuint> MeshSimplifier::Simplify(const std::vector<Resources::Vertex>& vertices, const std::vector<QXuint>& indices,
+		QXsizei targetIndexCount, QXfloat maxError) noexcept
+	{
+		const QXsizei vertex_count = vertices.size();
+
+		std::vector<QXuint> result = indices;
+		if (vertex_count == 0 || indices.size() <= targetIndexCount)
+			return result;
+
+		// Weld vertices by position, the first vertex of a position is the canonical one
+		std::vector<QXuint> remap(vertex_count);
+		{
+			std::unordered_map<Math::QXvec3, QXuint, PositionHash, PositionEqual> positions;
+			positions.reserve(vertex_count);
+
+			for (QXuint i = 0; i < vertex_count; ++i)
+			{
+				auto it = positions.emplace(vertices[i].position, i).first;
+				remap[i] = it->second;
+			}
+		}
+
+		// Seams (one position with different uvs or normals) and open borders stay in place, copies of a vertex
+		// with the same attributes move together
+		std::vector<QXbool> locked(vertex_count, false);
+		for (QXuint i = 0; i < vertex_count; ++i)
+		{
+			if (!SameAttributes(vertices[i], vertices[remap[i]]))
+				locked[remap[i]] = true;
+		}
+
+		{
+			std::unordered_map<uint64_t, QXuint> edges;
+			for (QXsizei i = 0; i < indices.size(); i += 3)
+			{
+				for (QXuint j = 0; j < 3; ++j)
+				{
+					QXuint a = remap[indices[i + j]], b = remap[indices[i + (j + 1) % 3]];
+					edges[((uint64_t)std::min(a, b) << 32) | std::max(a, b)]++;
+				}
+			}
+
+			for (auto it = edges.begin(); it != edges.end(); ++it)
+			{
+				if (it->second == 1)
+				{
+					locked[(QXuint)(it->first >> 32)] = true;
+					locked[(QXuint)(it->first & 0xFFFFFFFF)] = true;
+				}
+			}
+		}
+
+		// Min and max of the bounding box give the scale of the error
+		QXdouble extent = 0;
+		{
+			Math::QXvec3 bounds_min = vertices[0].position, bounds_max = vertices[0].position;
+			for (QXsizei i = 1; i < vertex_count; ++i)
+			{
+				bounds_min.x = std::min(bounds_min.x, vertices[i].position.x);
+				bounds_min.y = std::min(bounds_min.y, vertices[i].position.y);
+				bounds_min.z = std::min(bounds_min.z, vertices[i].position.z);
+				bounds_max.x = std::max(bounds_max.x, vertices[i].position.x);
+				bounds_max.y = std::max(bounds_max.y, vertices[i].position.y);
+				bounds_max.z = std::max(bounds_max.z, vertices[i].position.z);
+			}
+			extent = std::max({ bounds_max.x - bounds_min.x, bounds_max.y - bounds_min.y, bounds_max.z - bounds_min.z });
+		}
+		const QXdouble max_cost = (maxError * extent) * (maxError * extent);
+
+		std::vector<Quadric> quadrics(vertex_count);
+		for (QXsizei i = 0; i < indices.size(); i += 3)
+		{
+			QXuint c0 = remap[indices[i]], c1 = remap[indices[i + 1]], c2 = remap[indices[i + 2]];
+			const Math::QXvec3& p0 = vertices[c0].position;
+
+			QXdouble normal[3];
+			TriangleNormal(p0, vertices[c1].position, vertices[c2].position, normal);
+
+			QXdouble length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+			if (length == 0)
+				continue;
+
+			normal[0] /= length; normal[1] /= length; normal[2] /= length;
+			QXdouble d = -(normal[0] * p0.x + normal[1] * p0.y + normal[2] * p0.z);
+
+			quadrics[c0].AddPlane(normal[0], normal[1], normal[2], d);
+			quadrics[c1].AddPlane(normal[0], normal[1], normal[2], d);
+			quadrics[c2].AddPlane(normal[0], normal[1], normal[2], d);
+		}
+
+		// Position a collapsed position moved on, and the vertex of that position its triangles now use
+		std::vector<QXuint> collapsed_to(vertex_count);
+		std::vector<QXuint> wedge(vertex_count);
+		for (QXuint i = 0; i < vertex_count; ++i)
+		{
+			collapsed_to[i] = i;
+			wedge[i] = i;
+		}
+
+		std::vector<Collapse>				collapses;
+		std::vector<QXbool>					touched(vertex_count);
+		std::vector<std::vector<QXuint>>	adjacency(vertex_count);
+
+		// Each pass collapses the cheapest independent edges, then rebuilds the triangle list
+		while (result.size() > targetIndexCount)
+		{
+			collapses.clear();
+			for (QXsizei i = 0; i < vertex_count; ++i)
+				adjacency[i].clear();
+
+			for (QXsizei i = 0; i < result.size(); i += 3)
+			{
+				for (QXuint j = 0; j < 3; ++j)
+				{
+					QXuint a = remap[result[i + j]], b = remap[result[i + (j + 1) % 3]];
+					adjacency[a].push_back((QXuint)i);
+
+					// Each edge is seen from its two triangles, keep one
+					if (a > b)
+						continue;
+
+					Quadric q = quadrics[a];
+					q.Add(quadrics[b]);
+
+					const Math::QXvec3& pa = vertices[a].position;
+					const Math::QXvec3& pb = vertices[b].position;
+
+					QXdouble cost_ab = locked[a] ? HUGE_VAL : q.Evaluate(pb.x, pb.y, pb.z);
+					QXdouble cost_ba = locked[b] ? HUGE_VAL : q.Evaluate(pa.x, pa.y, pa.z);
+
+					if (cost_ab == HUGE_VAL && cost_ba == HUGE_VAL)
+						continue;
+
+					if (cost_ab <= cost_ba)
+						collapses.push_back({ a, b, cost_ab });
+					else
+						collapses.push_back({ b, a, cost_ba });
+				}
+			}
+
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+			std::fill(touched.begin(), touched.end(), false);
+
+			QXsizei triangle_count = result.size() / 3;
+			const QXsizei target_triangles = targetIndexCount / 3;
+			QXuint collapse_count = 0;
+
+			for (QXsizei i = 0; i < collapses.size() && triangle_count > target_triangles; ++i)
+			{
+				const Collapse& collapse = collapses[i];
+				if (collapse.cost > max_cost)
+					break;
+
+				if (touched[collapse.from] || touched[collapse.to])
+					continue;
+
+				// Reject the collapse if a triangle around the moved vertex flips
+				const Math::QXvec3& target = vertices[collapse.to].position;
+				const std::vector<QXuint>& around = adjacency[collapse.from];
+				QXbool flip = false;
+				QXsizei removed = 0;
+				QXuint target_vertex = collapse.to;
+
+				for (QXsizei j = 0; j < around.size() && !flip; ++j)
+				{
+					QXuint c[3] = { remap[result[around[j]]], remap[result[around[j] + 1]], remap[result[around[j] + 2]] };
+
+					// The moved position is not a seam, its triangles are on the side of the vertex the edge uses
+					if (c[0] == collapse.to || c[1] == collapse.to || c[2] == collapse.to)
+					{
+						target_vertex = result[around[j] + (c[0] == collapse.to ? 0 : c[1] == collapse.to ? 1 : 2)];
+						removed++;
+						continue;
+					}
+
+					QXdouble before[3], after[3];
+					TriangleNormal(vertices[c[0]].position, vertices[c[1]].position, vertices[c[2]].position, before);
+					TriangleNormal(c[0] == collapse.from ? target : vertices[c[0]].position,
+						c[1] == collapse.from ? target : vertices[c[1]].position,
+						c[2] == collapse.from ? target : vertices[c[2]].position, after);
+
+					flip = before[0] * after[0] + before[1] * after[1] + before[2] * after[2] <= 0;
+				}
+
+				if (flip)
+					continue;
+
+				collapsed_to[collapse.from] = collapse.to;
+				wedge[collapse.from] = target_vertex;
+				quadrics[collapse.to].Add(quadrics[collapse.from]);
+
+				// Triangles around the collapse changed, their vertices wait for the next pass
+				for (QXsizei j = 0; j < around.size(); ++j)
+				{
+					touched[remap[result[around[j]]]] = true;
+					touched[remap[result[around[j] + 1]]] = true;
+					touched[remap[result[around[j] + 2]]] = true;
+				}
+
+				triangle_count -= removed;
+				collapse_count++;
+			}
+
+			if (collapse_count == 0)
+				break;
+
+			// Move the indices on their collapsed vertex and remove the degenerated triangles
+			QXsizei write = 0;
+			for (QXsizei i = 0; i < result.size(); i += 3)
+			{
+				QXuint tri[3];
+				for (QXuint j = 0; j < 3; ++j)
+				{
+					QXuint v = result[i + j];
+					while (collapsed_to[remap[v]] != remap[v])
+						v = wedge[remap[v]];
+					tri[j] = v;
+				}
+
+				if (remap[tri[0]] == remap[tri[1]] || remap[tri[1]] == remap[tri[2]] || remap[tri[0]] == remap[tri[2]])
+					continue;
+
+				result[write++] = tri[0];
+				result[write++] = tri[1];
+				result[write++] = tri[2];
+			}
+			result.resize(write);
+		}
+
+		return result;
+	}
+
+#pragma endregion
+}
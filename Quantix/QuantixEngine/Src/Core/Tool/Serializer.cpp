@@ -7,6 +7,7 @@
 #include "Core/Components/SphereCollider.h"
 #include "Core/Components/Behaviours/CubeGenerator.h"
 #include "Core/Components/DeformableMesh.h"
+#include "Core/Components/FractureMesh.h"
 
 namespace Quantix::Core::Tool
 {
@@ -32,6 +33,11 @@ namespace Quantix::Core::Tool
 		rapidjson::Value::MemberIterator ret = doc.FindMember("Scene");
 		scene->Rename(ret->value.FindMember("name")->value.GetString());
 
+		// Older scenes have no render settings
+		rapidjson::Value::MemberIterator depth_prepass = ret->value.FindMember("depthPrepass");
+		if (depth_prepass != ret->value.MemberEnd())
+			scene->SetDepthPrepass(depth_prepass->value.GetBool());
+
 		_currScene = scene;
 
 		rapidjson::Value& root = ret->value.FindMember("GameObject0")->value;
@@ -55,6 +61,8 @@ namespace Quantix::Core::Tool
 		writer.StartObject();
 		writer.String("name");
 		writer.String(scene->GetName().c_str());
+		writer.String("depthPrepass");
+		writer.Bool(scene->GetDepthPrepass());
 
 		QXbool isDeformable = false;
 
@@ -119,6 +127,10 @@ namespace Quantix::Core::Tool
 				{
 					type.invoke("Generate", comp, {_currScene, manager, true});
 				}
+				if (type == rttr::type::get<Core::Components::FractureMesh>() || type.get_raw_type() == rttr::type::get<Core::Components::FractureMesh>())
+				{
+					type.invoke("Generate", comp, {_currScene, manager, true});
+				}
 			}
 		}
 	}
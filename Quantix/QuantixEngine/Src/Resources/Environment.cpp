@@ -0,0 +1,215 @@
+#include "Resources/Environment.h"
+
+#include <stb_image.h>
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdio>
+
+#include "Core/Debugger/Logger.h"
+
+// "QXEV", first bytes of an environment cache
+#define ENVIRONMENT_CACHE_MAGIC 0x56455851
+
+namespace Quantix::Resources
+{
+#pragma region Constructors
+
+	Environment::~Environment() noexcept
+	{
+		if (_cubemap)
+			glDeleteTextures(1, &_cubemap);
+		if (_specularMap)
+			glDeleteTextures(1, &_specularMap);
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void Environment::Load(const QXstring& file) noexcept
+	{
+		if (LoadFromCache(file))
+		{
+			_status.store(EResourceStatus::LOADED);
+			return;
+		}
+
+		if (!Bake(file))
+		{
+			_status.store(EResourceStatus::FAILED);
+			return;
+		}
+
+		SaveToCache(file);
+
+		_status.store(EResourceStatus::LOADED);
+	}
+
+	QXbool Environment::Bake(const QXstring& file) noexcept
+	{
+		QXint width, height, channel;
+		QXfloat* image = stbi_loadf(file.c_str(), &width, &height, &channel, 0);
+
+		if (image == nullptr || channel < 3)
+		{
+			LOG(ERROR, "failed to load environment:  " + file);
+			if (image)
+				stbi_image_free(image);
+
+			return false;
+		}
+
+		Core::Tool::CubeMapData sky = Core::Tool::EnvironmentBaker::FromEquirectangular(image, width, height, channel, ENVIRONMENT_SIZE);
+		stbi_image_free(image);
+
+		// Mip chain of the sky for the filtered importance sampling of the specular levels
+		std::vector<Core::Tool::CubeMapData> mips;
+		mips.push_back(std::move(sky));
+		while (mips.back().size > 1)
+			mips.push_back(Core::Tool::EnvironmentBaker::Downsample(mips.back()));
+
+		for (QXsizei i = 0; i < mips.size(); ++i)
+		{
+			if (mips[i].size == ENVIRONMENT_IRRADIANCE_SIZE)
+				Core::Tool::EnvironmentBaker::ComputeIrradianceSH(mips[i], _irradianceSH);
+		}
+
+		std::vector<Core::Tool::CubeMapData> specular = Core::Tool::EnvironmentBaker::PrefilterSpecular(mips, ENVIRONMENT_SPECULAR_SIZE, ENVIRONMENT_SPECULAR_MIPS);
+
+		_skySize = mips[0].size;
+		_specularSize = ENVIRONMENT_SPECULAR_SIZE;
+
+		for (QXuint face = 0; face < 6; ++face)
+		{
+			Core::Tool::EnvironmentBaker::PackRGB9E5(mips[0].faces[face], _skyFaces[face]);
+
+			for (QXuint level = 0; level < ENVIRONMENT_SPECULAR_MIPS; ++level)
+				Core::Tool::EnvironmentBaker::PackRGB9E5(specular[level].faces[face], _specularFaces[level][face]);
+		}
+
+		return true;
+	}
+
+	QXbool Environment::LoadFromCache(const QXstring& filePath) noexcept
+	{
+		QXstring cache_file = filePath + ".quantix";
+		FILE* file;
+
+		fopen_s(&file, cache_file.c_str(), "rb");
+
+		if (file == nullptr)
+			return false;
+
+		QXuint header[5];
+		if (fread(header, sizeof(QXuint), 5, file) != 5 || header[0] != ENVIRONMENT_CACHE_MAGIC || header[1] != ENVIRONMENT_CACHE_VERSION
+			|| header[2] != ENVIRONMENT_SIZE || header[3] != ENVIRONMENT_SPECULAR_SIZE || header[4] != ENVIRONMENT_SPECULAR_MIPS)
+		{
+			fclose(file);
+			return false;
+		}
+
+		_skySize = header[2];
+		_specularSize = header[3];
+
+		QXbool complete = fread(_irradianceSH, sizeof(QXfloat), ENVIRONMENT_SH_COUNT * 3, file) == ENVIRONMENT_SH_COUNT * 3;
+
+		for (QXuint face = 0; face < 6 && complete; ++face)
+		{
+			_skyFaces[face].resize(_skySize * _skySize);
+			complete = fread(_skyFaces[face].data(), sizeof(QXuint), _skyFaces[face].size(), file) == _skyFaces[face].size();
+		}
+
+		for (QXuint level = 0; level < ENVIRONMENT_SPECULAR_MIPS && complete; ++level)
+		{
+			QXuint size = std::max(_specularSize >> level, 1u);
+
+			for (QXuint face = 0; face < 6 && complete; ++face)
+			{
+				_specularFaces[level][face].resize(size * size);
+				complete = fread(_specularFaces[level][face].data(), sizeof(QXuint), _specularFaces[level][face].size(), file) == _specularFaces[level][face].size();
+			}
+		}
+
+		fclose(file);
+
+		return complete;
+	}
+
+	void Environment::SaveToCache(const QXstring& filePath) noexcept
+	{
+		QXstring cache_file = filePath + ".quantix";
+		FILE* file;
+
+		fopen_s(&file, cache_file.c_str(), "wb");
+
+		if (file == nullptr)
+		{
+			LOG(ERROR, "failed to write environment cache:  " + cache_file);
+			return;
+		}
+
+		QXuint header[5] = { ENVIRONMENT_CACHE_MAGIC, ENVIRONMENT_CACHE_VERSION, _skySize, _specularSize, ENVIRONMENT_SPECULAR_MIPS };
+		fwrite(header, sizeof(QXuint), 5, file);
+		fwrite(_irradianceSH, sizeof(QXfloat), ENVIRONMENT_SH_COUNT * 3, file);
+
+		for (QXuint face = 0; face < 6; ++face)
+			fwrite(_skyFaces[face].data(), sizeof(QXuint), _skyFaces[face].size(), file);
+
+		for (QXuint level = 0; level < ENVIRONMENT_SPECULAR_MIPS; ++level)
+		{
+			for (QXuint face = 0; face < 6; ++face)
+				fwrite(_specularFaces[level][face].data(), sizeof(QXuint), _specularFaces[level][face].size(), file);
+		}
+
+		fclose(file);
+	}
+
+	QXuint Environment::CreateCubemap(const std::vector<QXuint> (*faces)[6], QXuint size, QXuint levelCount) noexcept
+	{
+		QXuint id;
+		glGenTextures(1, &id);
+		glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+
+		for (QXuint level = 0; level < levelCount; ++level)
+		{
+			QXuint level_size = std::max(size >> level, 1u);
+
+			for (QXuint face = 0; face < 6; ++face)
+				glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, GL_RGB9_E5, level_size, level_size, 0, GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV,
+					faces[level][face].data());
+		}
+
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+
+		return id;
+	}
+
+	void Environment::Init() noexcept
+	{
+		// Rough levels are sampled across the faces
+		glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+		_cubemap = CreateCubemap(&_skyFaces, _skySize, 1);
+		_specularMap = CreateCubemap(_specularFaces, _specularSize, ENVIRONMENT_SPECULAR_MIPS);
+
+		glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+
+		for (QXuint face = 0; face < 6; ++face)
+		{
+			std::vector<QXuint>().swap(_skyFaces[face]);
+
+			for (QXuint level = 0; level < ENVIRONMENT_SPECULAR_MIPS; ++level)
+				std::vector<QXuint>().swap(_specularFaces[level][face]);
+		}
+
+		_status.store(EResourceStatus::READY);
+	}
+
+#pragma endregion
+}
@@ -1,4 +1,5 @@
 #include "Resources/Material.h"
+#include "Core/Render/TexturePool.h"
 
 #include<glad/glad.h>
 
@@ -25,13 +26,7 @@ namespace Quantix::Resources
 	Material::Material(ShaderProgram* program) noexcept :
 		_program {program},
 		_diffuse {nullptr}
-	{
-		program->Use();
-		SetInt("material.shadowMap", 0);
-		SetInt("material.pointShadowMap", 1);
-		SetInt("material.diffuseTexture", 2);
-		SetInt("material.emissiveTexture", 3);
-	}
+	{}
 
 	Material::~Material() noexcept
 	{}
@@ -40,6 +35,24 @@ namespace Quantix::Resources
 
 #pragma region Functions
 
+	void Material::UseShader() noexcept
+	{
+		_program->Use();
+
+		// Materials can be created by the game thread, the program is only touched on the render thread
+		if (!_samplersSet)
+		{
+			SetInt("material.shadowMap", 0);
+			SetInt("material.pointShadowMap", 1);
+			SetInt("environmentMap", 4);
+
+			for (QXuint i = 0; i < TEXTURE_POOL_ARRAYS; ++i)
+				SetInt("textureArrays[" + std::to_string(i) + "]", TEXTURE_POOL_UNIT + i);
+
+			_samplersSet = true;
+		}
+	}
+
 	QXbool	Material::IsReady() noexcept
 	{
 		if (!_diffuse)
@@ -47,51 +60,47 @@ namespace Quantix::Resources
 		return _diffuse->IsReady();
 	}
 	
-	void Material::SendData(QXuint shadowTexture, QXbool isPointLight) noexcept
+	void Material::FillData(MaterialData& data) noexcept
 	{
-		SetFloat3("material.ambient", ambient.e);
-		SetFloat3("material.diffuse", diffuse.e);
-		SetFloat3("material.specular", specular.e);
-		SetFloat("material.shininess", shininess);
-
-		SetFloat2("tile", tile.e);
-
-		if (isPointLight)
+		for (QXuint i = 0; i < 3; ++i)
 		{
-			glActiveTexture(GL_TEXTURE1);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, shadowTexture);
-			SetFloat("farPlane", 100.f);
+			data.ambient[i] = ambient.e[i];
+			data.diffuse[i] = diffuse.e[i];
+			data.specular[i] = specular.e[i];
 		}
-		else
+		data.ambient[3] = 0.f;
+		data.diffuse[3] = 0.f;
+		data.shininess = shininess;
+
+		data.tile[0] = tile.e[0];
+		data.tile[1] = tile.e[1];
+
+		for (QXuint i = 0; i < 2; ++i)
 		{
-			SetInt("material.shadowMap", 0);
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, shadowTexture);
+			data.diffuseSlot[i] = -1;
+			data.emissiveSlot[i] = -1;
+			data.padding[i] = 0;
 		}
 	}
 
-	void Material::SendTextures() noexcept
+	void Material::SendEnvironment(Environment* environment) noexcept
 	{
-		if (_diffuse && _diffuse->IsReady())
-		{
-			SetInt("material.isTextured", 1);
-
-			glActiveTexture(GL_TEXTURE2);
-			glBindTexture(GL_TEXTURE_2D, _diffuse->GetId());
-			if (_emissive && _emissive->IsReady())
-			{
-				SetInt("material.hasEmissive", 1);
-				glActiveTexture(GL_TEXTURE3);
-				glBindTexture(GL_TEXTURE_2D, _emissive->GetId());
-			}
-			else
-				SetInt("material.hasEmissive", 0);
-		}
-		else
+		if (!environment || !environment->IsReady())
 		{
-			SetInt("material.hasEmissive", 0);
-			SetInt("material.isTextured", 0);
+			SetInt("hasEnvironment", 0);
+			return;
 		}
+
+		SetInt("hasEnvironment", 1);
+
+		QXuint location_id {_program->GetLocation("irradianceSH")};
+		if (location_id != -1)
+			glUniform3fv(location_id, ENVIRONMENT_SH_COUNT, environment->GetIrradianceSH());
+
+		SetFloat("environmentMaxLevel", ENVIRONMENT_SPECULAR_MIPS - 1);
+
+		glActiveTexture(GL_TEXTURE4);
+		glBindTexture(GL_TEXTURE_CUBE_MAP, environment->GetSpecularMap());
 	}
 
 	void Material::SetFloat(QXstring location, QXfloat value) noexcept
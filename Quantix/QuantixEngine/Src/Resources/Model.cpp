@@ -2,10 +2,16 @@
 
 #include <glad/glad.h>
 #include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
 #include "Core/Debugger/Logger.h"
+#include "Core/Tool/MeshOptimizer.h"
+#include "Core/Tool/MeshSimplifier.h"
 
 RTTR_PLUGIN_REGISTRATION
 {
@@ -17,12 +23,93 @@ RTTR_PLUGIN_REGISTRATION
 
 namespace Quantix::Resources
 {
+	/**
+	 * @brief Vertex layout sent to the gpu, 20 bytes instead of 32
+	 */
+	struct PackedVertex
+	{
+		QXfloat		position[3];
+		uint16_t	uv[2];
+		int16_t		normal[2];
+	};
+
+	/**
+	 * @brief Convert a float to a half float, rounded to the nearest
+	 *
+	 * @param value float to convert
+	 * @return uint16_t bits of the half float
+	 */
+	static uint16_t FloatToHalf(QXfloat value) noexcept
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(uint32_t));
+
+		uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+		int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+		uint32_t mantissa = bits & 0x7FFFFF;
+
+		// NaN and infinity
+		if (((bits >> 23) & 0xFF) == 0xFF)
+			return sign | 0x7C00 | (mantissa ? 0x200 : 0);
+
+		// Too big for a half, clamp to infinity
+		if (exponent >= 31)
+			return sign | 0x7C00;
+
+		// Too small for a normal half, becomes a denormal or zero
+		if (exponent <= 0)
+		{
+			if (exponent < -10)
+				return sign;
+
+			mantissa |= 0x800000;
+			QXuint shift = 14 - exponent;
+			return sign | (uint16_t)((mantissa + (1 << (shift - 1))) >> shift);
+		}
+
+		// The rounding carry can go up into the exponent, which stays a valid half
+		return sign | (uint16_t)((((uint32_t)exponent << 10) | (mantissa >> 13)) + ((mantissa >> 12) & 1));
+	}
+
+	/**
+	 * @brief Encode a unit normal on the octahedron, in two normalized shorts
+	 *
+	 * @param normal normal to encode
+	 * @param encoded result
+	 */
+	static void EncodeOctahedral(const Math::QXvec3& normal, int16_t encoded[2]) noexcept
+	{
+		QXfloat length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+		if (length == 0.f)
+		{
+			encoded[0] = 0;
+			encoded[1] = 0;
+			return;
+		}
+
+		QXfloat x = normal.x / length, y = normal.y / length;
+
+		// The lower half is folded on the corners of the square
+		if (normal.z < 0.f)
+		{
+			QXfloat fx = (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f);
+			QXfloat fy = (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f);
+			x = fx;
+			y = fy;
+		}
+
+		encoded[0] = (int16_t)std::round(std::clamp(x, -1.f, 1.f) * 32767.f);
+		encoded[1] = (int16_t)std::round(std::clamp(y, -1.f, 1.f) * 32767.f);
+	}
+
 #pragma region Constructors
 
 	Model::Model(const std::vector<Vertex>& vertices, const std::vector<QXuint>& indices) noexcept :
 		_vertices {vertices},
 		_indices {indices}
-	{}
+	{
+		ComputeBounds();
+	}
 
 #pragma endregion
 
@@ -30,6 +117,17 @@ namespace Quantix::Resources
 
 	void Model::Init() noexcept
 	{
+		std::vector<PackedVertex> packed(_vertices.size());
+		for (QXsizei i = 0; i < _vertices.size(); ++i)
+		{
+			packed[i].position[0] = _vertices[i].position.x;
+			packed[i].position[1] = _vertices[i].position.y;
+			packed[i].position[2] = _vertices[i].position.z;
+			packed[i].uv[0] = FloatToHalf(_vertices[i].uv.x);
+			packed[i].uv[1] = FloatToHalf(_vertices[i].uv.y);
+			EncodeOctahedral(_vertices[i].normal, packed[i].normal);
+		}
+
 		QXuint VBO, EBO;
 		glGenVertexArrays(1, &_VAO);
 		glBindVertexArray(_VAO);
@@ -37,28 +135,77 @@ namespace Quantix::Resources
 		/* bind VBO */
 		glBindBuffer(GL_ARRAY_BUFFER, VBO);
 		/* send data */
-		glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex)
-			* _vertices.size(), (QXfloat*)_vertices.data(), GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex)
+			* packed.size(), packed.data(), GL_STATIC_DRAW);
 
-		/* set VBO properties */
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(QXfloat),
-			(void*)0);
+		/* set VBO properties, normals are decoded in the vertex shader */
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(PackedVertex),
+			(void*)offsetof(PackedVertex, position));
 		glEnableVertexAttribArray(0);
 
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(QXfloat),
-			(void*)(3 * sizeof(QXfloat)));
+		glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex),
+			(void*)offsetof(PackedVertex, uv));
 		glEnableVertexAttribArray(1);
 
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(QXfloat),
-			(void*)(5 * sizeof(QXfloat)));
+		glVertexAttribPointer(2, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex),
+			(void*)offsetof(PackedVertex, normal));
 		glEnableVertexAttribArray(2);
 		/* create EBO */
 		glGenBuffers(1, &EBO);
 
-		/* set EBO */
+		/* set EBO, levels of detail follow the source indices */
+		QXsizei index_count = _indices.size();
+		for (QXsizei i = 0; i < _lodIndices.size(); ++i)
+			index_count += _lodIndices[i].size();
+
+		QXbool short_indices = _vertices.size() <= MODEL_SHORT_INDEX_LIMIT;
+		QXsizei index_size = short_indices ? sizeof(uint16_t) : sizeof(QXuint);
+		_indexType = short_indices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_size * index_count, nullptr, GL_STATIC_DRAW);
+
+		_lodOffsets.clear();
+		QXsizei offset = 0;
+		std::vector<uint16_t> short_lod;
+		for (QXuint i = 0; i < GetLODCount(); ++i)
+		{
+			const std::vector<QXuint>& lod = GetLODIndices(i);
+
+			if (short_indices)
+			{
+				short_lod.assign(lod.begin(), lod.end());
+				glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, index_size * lod.size(), short_lod.data());
+			}
+			else
+				glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, index_size * lod.size(), lod.data());
+
+			_lodOffsets.push_back(offset);
+			offset += index_size * lod.size();
+		}
+
+		glBindVertexArray(0);
+
+		/* tightly packed positions for the depth prepass, the indices are shared */
+		std::vector<QXfloat> positions(_vertices.size() * 3);
+		for (QXsizei i = 0; i < _vertices.size(); ++i)
+		{
+			positions[i * 3] = packed[i].position[0];
+			positions[i * 3 + 1] = packed[i].position[1];
+			positions[i * 3 + 2] = packed[i].position[2];
+		}
+
+		QXuint position_VBO;
+		glGenVertexArrays(1, &_depthVAO);
+		glBindVertexArray(_depthVAO);
+		glGenBuffers(1, &position_VBO);
+		glBindBuffer(GL_ARRAY_BUFFER, position_VBO);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(QXfloat) * positions.size(), positions.data(), GL_STATIC_DRAW);
+
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(QXfloat) * 3, (void*)0);
+		glEnableVertexAttribArray(0);
+
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(QXuint) * _indices.size(),
-			_indices.data(), GL_STATIC_DRAW);
 
 		glBindVertexArray(0);
 
@@ -93,13 +240,73 @@ namespace Quantix::Resources
 		_indices.resize(index_count);
 		fread(_indices.data(), sizeof(QXuint), index_count, file);
 
+		ComputeBounds();
+
+		// Caches written before levels of detail end after the source indices
+		QXsizei lod_count;
+		QXbool upgrade = fread(&lod_count, sizeof(QXsizei), 1, file) != 1;
+		if (!upgrade)
+		{
+			_lodIndices.resize(lod_count);
+			for (QXsizei i = 0; i < lod_count; ++i)
+			{
+				fread(&index_count, sizeof(QXsizei), 1, file);
+				_lodIndices[i].resize(index_count);
+				fread(_lodIndices[i].data(), sizeof(QXuint), index_count, file);
+			}
+		}
+
 		fclose(file);
 
+		// The levels are generated once, the next loads read them from the rewritten cache
+		if (upgrade)
+		{
+			GenerateLODs();
+			Optimize();
+			SaveToCache(filePath);
+		}
+
 		_status.store(EResourceStatus::LOADED);
 
 		return true;
 	}
 
+	void Model::SaveToCache(const QXstring& filePath) noexcept
+	{
+		QXstring cache_file = filePath + ".quantix";
+		FILE* file;
+
+		fopen_s(&file, cache_file.c_str(), "wb");
+
+		if (file == nullptr)
+		{
+			LOG(ERROR, "failed to write model cache:  " + cache_file);
+			return;
+		}
+
+		QXsizei vertex_count = _vertices.size();
+		QXsizei index_count = _indices.size();
+
+		fwrite(&vertex_count, sizeof(QXsizei), 1, file);
+		fwrite(_vertices.data(), sizeof(Vertex), vertex_count, file);
+
+		fwrite(&index_count, sizeof(QXsizei), 1, file);
+		fwrite(_indices.data(), sizeof(QXuint), index_count, file);
+
+		QXsizei lod_count = _lodIndices.size();
+		fwrite(&lod_count, sizeof(QXsizei), 1, file);
+
+		for (QXsizei i = 0; i < lod_count; ++i)
+		{
+			index_count = _lodIndices[i].size();
+
+			fwrite(&index_count, sizeof(QXsizei), 1, file);
+			fwrite(_lodIndices[i].data(), sizeof(QXuint), index_count, file);
+		}
+
+		fclose(file);
+	}
+
 	void Model::LoadWithLib(const QXstring& file) noexcept
 	{
 		Assimp::Importer Importer;
@@ -129,9 +336,72 @@ namespace Quantix::Resources
 			_indices.push_back(Face.mIndices[1]);
 			_indices.push_back(Face.mIndices[2]);
 		}
+
+		ComputeBounds();
+		GenerateLODs();
+		Optimize();
 		
 		_status.store(EResourceStatus::LOADED);
 	}
 
+	void Model::ComputeBounds() noexcept
+	{
+		if (_vertices.empty())
+			return;
+
+		_boundsMin = _vertices[0].position;
+		_boundsMax = _vertices[0].position;
+
+		for (QXsizei i = 1; i < _vertices.size(); ++i)
+		{
+			const Math::QXvec3& pos = _vertices[i].position;
+
+			_boundsMin.x = std::min(_boundsMin.x, pos.x);
+			_boundsMin.y = std::min(_boundsMin.y, pos.y);
+			_boundsMin.z = std::min(_boundsMin.z, pos.z);
+			_boundsMax.x = std::max(_boundsMax.x, pos.x);
+			_boundsMax.y = std::max(_boundsMax.y, pos.y);
+			_boundsMax.z = std::max(_boundsMax.z, pos.z);
+		}
+	}
+
+	void Model::GenerateLODs() noexcept
+	{
+		_lodIndices.clear();
+		_lodIndices.reserve(MODEL_MAX_LOD - 1);
+
+		const std::vector<QXuint>* previous = &_indices;
+
+		for (QXuint i = 1; i < MODEL_MAX_LOD; ++i)
+		{
+			QXsizei target = (QXsizei)(previous->size() / 3 * MODEL_LOD_RATIO) * 3;
+			std::vector<QXuint> lod = Core::Tool::MeshSimplifier::Simplify(_vertices, *previous, target, MODEL_LOD_MAX_ERROR);
+
+			// Stop when the error does not allow a real reduction anymore
+			if (lod.empty() || lod.size() > previous->size() * 0.8f)
+				break;
+
+			_lodIndices.push_back(std::move(lod));
+			previous = &_lodIndices.back();
+		}
+	}
+
+	void Model::Optimize() noexcept
+	{
+		std::vector<std::vector<QXuint>*> index_lists;
+		index_lists.push_back(&_indices);
+		for (QXsizei i = 0; i < _lodIndices.size(); ++i)
+			index_lists.push_back(&_lodIndices[i]);
+
+		for (QXsizei i = 0; i < index_lists.size(); ++i)
+		{
+			Core::Tool::MeshOptimizer::OptimizeVertexCache(*index_lists[i], _vertices.size());
+			Core::Tool::MeshOptimizer::OptimizeOverdraw(*index_lists[i], _vertices);
+		}
+
+		// The source level gives the order of the vertices, the other levels mostly use a subset of it
+		Core::Tool::MeshOptimizer::OptimizeVertexFetch(_vertices, index_lists);
+	}
+
 #pragma endregion
 }
\ No newline at end of file
@@ -2,7 +2,9 @@
 #include "Mat4.h"
 
 #include "Core/DataStructure/ResourcesManager.h"
+#include "Core/DataStructure/ObjectPool.h"
 #include "Core/Components/CubeCollider.h"
+#include "Core/Threading/JobSystem.h"
 
 namespace Quantix::Resources
 {
@@ -29,7 +31,8 @@ namespace Quantix::Resources
 		_root3D {copy._root3D},
 		_root2D{ copy._root2D },
 		_rootComponent{ copy._rootComponent },
-		_id {copy._id}
+		_id {copy._id},
+		_depthPrepass { copy._depthPrepass }
 	{}
 
 	Scene::Scene(Scene&& copy) noexcept :
@@ -37,7 +40,8 @@ namespace Quantix::Resources
 		_root3D{ std::move(copy._root3D) },
 		_root2D{ std::move(copy._root2D) },
 		_rootComponent{ std::move(copy._rootComponent) },
-		_id{ std::move(copy._id) }
+		_id{ std::move(copy._id) },
+		_depthPrepass { copy._depthPrepass }
 	{}
 
 	Scene::~Scene() noexcept
@@ -49,6 +53,7 @@ namespace Quantix::Resources
 		for (auto it = _objectsComponent.begin(); it != _objectsComponent.end();)
 			it = _objectsComponent.erase(it);
 
+		delete _pool;
 		delete _root3D;
 		delete _root2D;
 		delete _rootComponent;
@@ -152,7 +157,56 @@ namespace Quantix::Resources
 		if (_root3D)
 			_root3D->Update(meshes, colliders, lights, info, isPlaying);
 		if (_root2D)
-			_root2D->Update();
+			Update2D();
+	}
+
+	void	Scene::Update2D() noexcept
+	{
+		_nodes2D.clear();
+		_depths2D.clear();
+		_sprites.clear();
+
+		for (Core::Physic::Transform2D* child : _root2D->GetTransform()->GetChilds())
+			_nodes2D.push_back({ child, _root2D->GetTransform() });
+
+		// Breadth first, the nodes of a depth follow the nodes of the depth above
+		QXsizei begin = 0;
+		while (begin < _nodes2D.size())
+		{
+			QXsizei end = _nodes2D.size();
+			_depths2D.push_back(end);
+
+			for (QXsizei i = begin; i < end; ++i)
+			{
+				Core::Physic::Transform2D* transform = _nodes2D[i].transform;
+				for (Core::Physic::Transform2D* child : transform->GetChilds())
+					_nodes2D.push_back({ child, transform });
+
+				Core::DataStructure::GameObject2D* object = transform->GetObject();
+				if (!object->GetRender())
+					continue;
+
+				Core::Components::Sprite* sprite = object->GetComponent<Core::Components::Sprite>();
+				if (sprite && sprite->IsEnable())
+					_sprites.push_back(sprite);
+			}
+
+			begin = end;
+		}
+
+		Core::Threading::JobSystem* jobs = Core::Threading::JobSystem::GetInstance();
+
+		begin = 0;
+		for (QXsizei i = 0; i < _depths2D.size(); ++i)
+		{
+			jobs->ParallelFor(_depths2D[i] - begin, SCENE_2D_GRAIN, [this, begin](QXsizei first, QXsizei last)
+				{
+					for (QXsizei j = begin + first; j < begin + last; ++j)
+						_nodes2D[j].transform->Update(_nodes2D[j].parent);
+				});
+
+			begin = _depths2D[i];
+		}
 	}
 
 	void Scene::CheckDestroy(Core::Platform::AppInfo& info) noexcept
@@ -222,6 +276,14 @@ namespace Quantix::Resources
 		return nullptr;
 	}
 
+	Core::DataStructure::ObjectPool& Scene::GetPool() noexcept
+	{
+		if (_pool == nullptr)
+			_pool = new Core::DataStructure::ObjectPool(this);
+
+		return *_pool;
+	}
+
 	#pragma endregion
 
 	#pragma region Operators
@@ -12,25 +12,24 @@ namespace Quantix::Resources
 
 	Shader::Shader(const Shader& shader) noexcept :
 		_id {shader._id},
-		_type {shader._type}
+		_type {shader._type},
+		_defines {shader._defines},
+		_code {shader._code}
 	{}
 
 	Shader::Shader(Shader&& shader) noexcept :
 		_id {std::move(shader._id)},
-		_type {std::move(shader._type)}
+		_type {std::move(shader._type)},
+		_defines {std::move(shader._defines)},
+		_code {std::move(shader._code)}
 	{}
 
-	Shader::Shader(QXstring file, EShaderType type) noexcept :
-		_id {(QXuint)-1},
-		_type {type}
+	Shader::Shader(QXstring file, EShaderType type, const QXstring& defines) noexcept :
+		_id {0},
+		_type {type},
+		_defines {defines}
 	{
-		switch (_type)
-		{
-			case EShaderType::VERTEX: CreateVertexShader(file);	break;
-			case EShaderType::GEOMETRY: CreateGeometryShader(file); break;
-			case EShaderType::FRAGMENT: CreateFragmentShader(file); break;
-			default: break;
-		}
+		_code = ReadFile(file);
 	}
 
 	Shader::~Shader() noexcept
@@ -40,12 +39,27 @@ namespace Quantix::Resources
 
 #pragma region Functions
 
-	void Shader::CreateFragmentShader(QXstring file) noexcept
+	void Shader::Compile() noexcept
 	{
-		QXstring code = ReadFile(file);
+		if (_id != 0)
+			return;
 
+		switch (_type)
+		{
+			case EShaderType::VERTEX: CreateVertexShader();	break;
+			case EShaderType::GEOMETRY: CreateGeometryShader(); break;
+			case EShaderType::FRAGMENT: CreateFragmentShader(); break;
+			default: break;
+		}
+
+		// The code is not needed once compiled
+		QXstring().swap(_code);
+	}
+
+	void Shader::CreateFragmentShader() noexcept
+	{
 		_id = glCreateShader(GL_FRAGMENT_SHADER);
-		const char* str = code.c_str();
+		const char* str = _code.c_str();
 		glShaderSource(_id, 1, &str, nullptr);
 		glCompileShader(_id);
 
@@ -59,11 +73,10 @@ namespace Quantix::Resources
 		}
 	}
 
-	void Shader::CreateVertexShader(QXstring file) noexcept
+	void Shader::CreateVertexShader() noexcept
 	{
-		QXstring code = ReadFile(file);
 		_id = glCreateShader(GL_VERTEX_SHADER);
-		const char* str = code.c_str();
+		const char* str = _code.c_str();
 		glShaderSource(_id, 1, &str, nullptr);
 		glCompileShader(_id);
 
@@ -77,11 +90,10 @@ namespace Quantix::Resources
 		}
 	}
 
-	void Shader::CreateGeometryShader(QXstring file) noexcept
+	void Shader::CreateGeometryShader() noexcept
 	{
-		QXstring code = ReadFile(file);
 		_id = glCreateShader(GL_GEOMETRY_SHADER);
-		const char* str = code.c_str();
+		const char* str = _code.c_str();
 		glShaderSource(_id, 1, &str, nullptr);
 		glCompileShader(_id);
 
@@ -110,7 +122,21 @@ namespace Quantix::Resources
 
 		buffer[file_size] = '\0';
 
-		const QXchar* code = buffer.c_str();
+		QXstring code = buffer.c_str();
+
+		// Defines have to come after the #version directive
+		if (!_defines.empty())
+		{
+			QXsizei version = code.find("#version");
+			QXsizei version_end = version == QXstring::npos ? QXstring::npos : code.find('\n', version);
+
+			if (version == QXstring::npos)
+				code.insert(0, _defines);
+			else if (version_end == QXstring::npos)
+				code += "\n" + _defines;
+			else
+				code.insert(version_end + 1, _defines);
+		}
 
 		return code;
 	}
@@ -11,22 +11,51 @@ namespace Quantix::Resources
 #pragma region Constructors
 
 	ShaderProgram::ShaderProgram(const ShaderProgram& program) noexcept :
-		_id {program._id}
+		_id {program._id},
+		_vertexShader {program._vertexShader},
+		_fragmentShader {program._fragmentShader},
+		_geometryShader {program._geometryShader}
 	{}
 
 	ShaderProgram::ShaderProgram(ShaderProgram&& program) noexcept :
-		_id {std::move(program._id)}
+		_id {std::move(program._id)},
+		_vertexShader {std::move(program._vertexShader)},
+		_fragmentShader {std::move(program._fragmentShader)},
+		_geometryShader {std::move(program._geometryShader)}
 	{}
 
 	ShaderProgram::ShaderProgram(Shader* vertexShader, Shader* fragmentShader, Shader* geometryShader) noexcept :
-		_id { (QXuint)-1}
+		_id { 0 },
+		_vertexShader { vertexShader },
+		_fragmentShader { fragmentShader },
+		_geometryShader { geometryShader }
+	{}
+
+	ShaderProgram::~ShaderProgram() noexcept
+	{
+		glDeleteProgram(_id);
+	}
+
+#pragma endregion
+
+#pragma region Functions
+
+	void ShaderProgram::Link() noexcept
 	{
+		if (_id != 0)
+			return;
+
+		_vertexShader->Compile();
+		_fragmentShader->Compile();
+		if (_geometryShader)
+			_geometryShader->Compile();
+
 		_id = glCreateProgram();
 
-		glAttachShader(_id, vertexShader->GetId());
-		if (geometryShader)
-			glAttachShader(_id, geometryShader->GetId());
-		glAttachShader(_id, fragmentShader->GetId());
+		glAttachShader(_id, _vertexShader->GetId());
+		if (_geometryShader)
+			glAttachShader(_id, _geometryShader->GetId());
+		glAttachShader(_id, _fragmentShader->GetId());
 
 		glLinkProgram(_id);
 
@@ -40,17 +69,10 @@ namespace Quantix::Resources
 		}
 	}
 
-	ShaderProgram::~ShaderProgram() noexcept
-	{
-		glDeleteProgram(_id);
-	}
-
-#pragma endregion
-
-#pragma region Functions
-
 	QXuint ShaderProgram::GetLocation(QXstring location) noexcept
 	{
+		Link();
+
 		if (_locations.count(location) == 0)
 		{
 			QXuint new_id { (QXuint)glGetUniformLocation(_id, location.c_str()) };
@@ -68,6 +90,7 @@ namespace Quantix::Resources
 
 	void ShaderProgram::Use() noexcept
 	{
+		Link();
 		glUseProgram(_id);
 	}
 
@@ -92,6 +92,7 @@ namespace Quantix::Resources
 		stbi_set_flip_vertically_on_load(true);
 		/* load image */
 		_HDRImage = stbi_loadf(file.c_str(), &_width, &_height, &_channel, 0);
+		_isHDR = true;
 
 		if (_HDRImage == nullptr)
 		{